@@ -0,0 +1,7 @@
+#! /bin/bash
+
+cd "$(dirname "$0")"
+
+g++ outline.cpp ../src/ps2tt.cpp ../src/tt2ps.cpp ../src/outline-cache.cpp ../src/mapped-file.cpp ../src/transform.cpp ../src/trace.cpp -I../src/ -std=c++17 -O3 -o outline-bench
+g++ pipeline.cpp ../src/merge.cpp ../src/batch.cpp ../src/merge-name.cpp ../src/glyph-order.cpp ../src/glyph-store.cpp ../src/packed-glyph.cpp ../src/alloc-profile.cpp ../src/phase-stats.cpp ../src/trace.cpp ../src/ps2tt.cpp ../src/tt2ps.cpp ../src/outline-cache.cpp ../src/mapped-file.cpp ../src/simplify.cpp ../src/skeleton.cpp ../src/source-selector.cpp ../src/subset.cpp ../src/transform.cpp ../src/iostream.cpp -I../src/ -std=c++17 -O3 -o pipeline-bench
+g++ ../src/merge-otd.cpp ../src/daemon.cpp ../src/merge.cpp ../src/batch.cpp ../src/merge-name.cpp ../src/glyph-order.cpp ../src/glyph-store.cpp ../src/packed-glyph.cpp ../src/alloc-profile.cpp ../src/phase-stats.cpp ../src/trace.cpp ../src/ps2tt.cpp ../src/tt2ps.cpp ../src/outline-cache.cpp ../src/mapped-file.cpp ../src/simplify.cpp ../src/skeleton.cpp ../src/source-selector.cpp ../src/subset.cpp ../src/transform.cpp ../src/iostream.cpp -I../src/ -std=c++17 -O2 -o merge-otd-bench
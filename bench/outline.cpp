@@ -0,0 +1,392 @@
+/* outline conversion benchmark.
+
+   runs Tt2Ps, Ps2Tt and the round trip over TrueType OTD dumps and reports
+   speed, point counts and a sampled Hausdorff distance per glyph as JSON.
+   with --check-exact, checks instead that the integer Tt2Ps kernel gives the
+   same contours as the double precision one.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "point.hpp"
+#include "ps2tt.h"
+#include "tt2ps.h"
+
+using nlohmann::json;
+
+const char *usage =
+    "usage: %s [--error-bound=e] [--spline] [--sample=n] [--repeat=n] "
+    "font.otd ...\n"
+    "       %s --check-exact font.otd ...\n"
+    "  --error-bound  Ps2Tt error bound (default 1)\n"
+    "  --spline       Ps2Tt spline mode\n"
+    "  --sample       measure deviation of every n-th glyph (default 10)\n"
+    "  --repeat       timing runs, the median is reported (default 3)\n"
+    "  --check-exact  compare the Tt2Ps kernels, exit 1 on any mismatch\n";
+
+// mismatches printed per font
+const size_t maxReported = 5;
+
+// samples per segment when flattening outlines
+const int segmentSamples = 8;
+
+static void SampleQuadContour(const json &contour, std::vector<Point> &out)
+{
+	size_t n = contour.size();
+	auto on = [&](size_t i) { return bool(contour[i % n]["on"]); };
+	auto at = [&](size_t i) { return Point(contour[i % n]); };
+
+	size_t start = 0;
+	while (start < n && !on(start))
+		start++;
+	size_t k = 1, last = n;
+	Point p0;
+	if (start < n)
+		p0 = at(start);
+	else
+	{
+		// all off-curve: start at the implied point before the first one
+		start = 0;
+		k = 0;
+		last = n - 1;
+		p0 = (at(n - 1) + at(0)) / 2;
+	}
+
+	for (; k <= last; k++)
+	{
+		size_t i = start + k;
+		if (on(i))
+		{
+			for (int s = 0; s < segmentSamples; s++)
+				out.push_back(p0 + (at(i) - p0) * (double(s) / segmentSamples));
+			p0 = at(i);
+		}
+		else
+		{
+			Point c = at(i);
+			Point p1 = on(i + 1) ? at(i + 1) : (c + at(i + 1)) / 2;
+			for (int s = 0; s < segmentSamples; s++)
+			{
+				double t = double(s) / segmentSamples;
+				out.push_back((1 - t) * (1 - t) * p0 + 2 * t * (1 - t) * c +
+				              t * t * p1);
+			}
+			p0 = p1;
+			if (on(i + 1))
+				k++;
+		}
+	}
+}
+
+static void SampleCubicContour(const json &contour, std::vector<Point> &out)
+{
+	size_t n = contour.size();
+	auto at = [&](size_t i) { return Point(contour[i % n]); };
+	Point p0 = at(0);
+	for (size_t i = 1; i <= n;)
+	{
+		if (contour[i % n]["on"])
+		{
+			for (int s = 0; s < segmentSamples; s++)
+				out.push_back(p0 + (at(i) - p0) * (double(s) / segmentSamples));
+			p0 = at(i);
+			i++;
+		}
+		else
+		{
+			Point c1 = at(i), c2 = at(i + 1), p1 = at(i + 2);
+			for (int s = 0; s < segmentSamples; s++)
+			{
+				double t = double(s) / segmentSamples, u = 1 - t;
+				out.push_back(u * u * u * p0 + 3 * t * u * u * c1 +
+				              3 * t * t * u * c2 + t * t * t * p1);
+			}
+			p0 = p1;
+			i += 3;
+		}
+	}
+}
+
+static double DistanceToSegment(Point p, Point a, Point b)
+{
+	Point ab = b - a;
+	double len = ab * ab;
+	double t = len ? std::clamp((p - a) * ab / len, 0.0, 1.0) : 0;
+	return abs(a + t * ab - p);
+}
+
+// max over samples of a of the distance to the closed polyline b
+static double DirectedDeviation(const std::vector<Point> &a,
+                                const std::vector<Point> &b)
+{
+	double result = 0;
+	for (Point p : a)
+	{
+		double d = 1e9;
+		for (size_t i = 0; i < b.size() && d > result; i++)
+			d = std::min(d, DistanceToSegment(p, b[i], b[(i + 1) % b.size()]));
+		result = std::max(result, d);
+	}
+	return result;
+}
+
+// sampled Hausdorff distance, contours are compared pairwise
+static double Deviation(const json &from, bool fromCubic, const json &to,
+                        bool toCubic)
+{
+	if (from.find("contours") == from.end() || !from["contours"].is_array())
+		return 0;
+	const json &a = from["contours"], &b = to["contours"];
+	if (a.size() != b.size())
+		return -1;
+	double result = 0;
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		if (a[i].size() <= 1 || b[i].size() <= 1)
+			continue;
+		std::vector<Point> sa, sb;
+		fromCubic ? SampleCubicContour(a[i], sa) : SampleQuadContour(a[i], sa);
+		toCubic ? SampleCubicContour(b[i], sb) : SampleQuadContour(b[i], sb);
+		result = std::max(
+		    {result, DirectedDeviation(sa, sb), DirectedDeviation(sb, sa)});
+	}
+	return result;
+}
+
+static size_t CountPoints(const json &glyf)
+{
+	size_t n = 0;
+	for (const auto &glyph : glyf)
+		if (glyph.find("contours") != glyph.end())
+			for (const auto &contour : glyph["contours"])
+				n += contour.size();
+	return n;
+}
+
+static double Median(std::vector<double> v)
+{
+	std::sort(v.begin(), v.end());
+	return v[v.size() / 2];
+}
+
+struct Options
+{
+	double errorBound = 1;
+	bool spline = false;
+	size_t sample = 10;
+	int repeat = 3;
+	bool checkExact = false;
+};
+
+/* deviation summary over sampled glyphs. composite glyphs are skipped since
+   Tt2Ps flattens them.
+*/
+static json Measure(const json &from, bool fromCubic, const json &to,
+                    bool toCubic, const Options &options)
+{
+	std::vector<double> deviations;
+	size_t i = 0, mismatched = 0;
+	for (const auto &[name, glyph] : from.items())
+	{
+		if (i++ % options.sample)
+			continue;
+		if (glyph.find("references") != glyph.end() ||
+		    to.find(name) == to.end())
+			continue;
+		double d = Deviation(glyph, fromCubic, to[name], toCubic);
+		if (d < 0)
+			mismatched++;
+		else
+			deviations.push_back(d);
+	}
+	std::sort(deviations.begin(), deviations.end());
+	json result = {{"glyphs", deviations.size()},
+	               {"contourMismatch", mismatched}};
+	if (deviations.size())
+	{
+		double sum = 0;
+		for (double d : deviations)
+			sum += d;
+		result["mean"] = sum / deviations.size();
+		result["p50"] = deviations[deviations.size() / 2];
+		result["p95"] = deviations[deviations.size() * 95 / 100];
+		result["max"] = deviations.back();
+	}
+	return result;
+}
+
+template <typename F>
+static json Time(const json &input, json &output, size_t glyphs,
+                 const Options &options, F convert)
+{
+	std::vector<double> seconds;
+	for (int r = 0; r < options.repeat; r++)
+	{
+		json copy = input;
+		auto start = std::chrono::steady_clock::now();
+		output = convert(std::move(copy));
+		seconds.push_back(std::chrono::duration<double>(
+		                      std::chrono::steady_clock::now() - start)
+		                      .count());
+	}
+	double median = Median(seconds);
+	size_t pointsIn = CountPoints(input), pointsOut = CountPoints(output);
+	return {{"seconds", median},
+	        {"glyphsPerSecond", glyphs / median},
+	        {"pointsIn", pointsIn},
+	        {"pointsOut", pointsOut},
+	        {"pointsPerGlyph", double(pointsOut) / glyphs}};
+}
+
+static json LoadGlyf(const std::string &path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		throw std::runtime_error("cannot open " + path);
+	std::string s{std::istreambuf_iterator<char>(file),
+	              std::istreambuf_iterator<char>()};
+	json font = json::parse(s);
+	if (font.find("CFF_") != font.end() || font.find("CFF2") != font.end())
+		throw std::runtime_error(path + " is not a TrueType dump");
+	return std::move(font["glyf"]);
+}
+
+// number of contours on which the Tt2Ps kernels disagree
+static size_t CheckFont(const std::string &path)
+{
+	json glyf = LoadGlyf(path);
+	size_t contours = 0, exact = 0, mismatched = 0;
+	for (const auto &[name, glyph] : glyf.items())
+	{
+		if (glyph.find("contours") == glyph.end())
+			continue;
+		for (const auto &contour : glyph["contours"])
+		{
+			contours++;
+			json result, reference;
+			if (!Tt2PsKernelsAgree(contour, result, reference))
+			{
+				if (mismatched++ < maxReported)
+					fprintf(stderr,
+					        "  %s: %s\n"
+					        "    float: %s\n    exact: %s\n",
+					        name.c_str(), contour.dump().c_str(),
+					        reference.dump().c_str(), result.dump().c_str());
+			}
+			if (!result.is_null())
+				exact++;
+		}
+	}
+	fprintf(stderr,
+	        "  %zu contours, %zu through the exact kernel, %zu mismatched\n",
+	        contours, exact, mismatched);
+	return mismatched;
+}
+
+static json BenchFont(const std::string &path, const Options &options)
+{
+	json glyf = LoadGlyf(path);
+	size_t glyphs = glyf.size();
+
+	json cubic, quad;
+	json tt2ps = Time(glyf, cubic, glyphs, options, [](json &&g) {
+		return Tt2Ps(std::move(g));
+	});
+	json ps2tt = Time(cubic, quad, glyphs, options, [&options](json &&g) {
+		return Ps2Tt(std::move(g), options.errorBound, nullptr, nullptr,
+		             options.spline);
+	});
+	tt2ps["deviation"] = Measure(glyf, false, cubic, true, options);
+	ps2tt["deviation"] = Measure(cubic, true, quad, false, options);
+
+	double seconds =
+	    tt2ps["seconds"].get<double>() + ps2tt["seconds"].get<double>();
+	json roundTrip = {
+	    {"seconds", seconds},
+	    {"glyphsPerSecond", glyphs / seconds},
+	    {"pointsIn", CountPoints(glyf)},
+	    {"pointsOut", CountPoints(quad)},
+	    {"deviation", Measure(glyf, false, quad, false, options)}};
+
+	return {{"file", path},
+	        {"glyphs", glyphs},
+	        {"tt2ps", tt2ps},
+	        {"ps2tt", ps2tt},
+	        {"roundTrip", roundTrip}};
+}
+
+int main(int argc, char *argv[])
+{
+	Options options;
+	std::vector<std::string> files;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg.substr(0, 14) == "--error-bound=")
+			options.errorBound = std::stod(arg.substr(14));
+		else if (arg == "--spline")
+			options.spline = true;
+		else if (arg.substr(0, 9) == "--sample=")
+			options.sample = std::max(1, std::stoi(arg.substr(9)));
+		else if (arg.substr(0, 9) == "--repeat=")
+			options.repeat = std::max(1, std::stoi(arg.substr(9)));
+		else if (arg == "--check-exact")
+			options.checkExact = true;
+		else
+			files.push_back(arg);
+	}
+	if (files.empty())
+	{
+		fprintf(stderr, usage, argv[0], argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (options.checkExact)
+	{
+		size_t mismatched = 0;
+		try
+		{
+			for (auto &f : files)
+			{
+				fprintf(stderr, "%s\n", f.c_str());
+				mismatched += CheckFont(f);
+			}
+		}
+		catch (const std::exception &e)
+		{
+			fprintf(stderr, "%s\n", e.what());
+			return EXIT_FAILURE;
+		}
+		return mismatched ? EXIT_FAILURE : 0;
+	}
+
+	json report = {{"errorBound", options.errorBound},
+	               {"spline", options.spline},
+	               {"sample", options.sample},
+	               {"repeat", options.repeat},
+	               {"fonts", json::array()}};
+	try
+	{
+		for (auto &f : files)
+		{
+			fprintf(stderr, "%s\n", f.c_str());
+			report["fonts"].push_back(BenchFont(f, options));
+		}
+	}
+	catch (const std::exception &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	std::cout << report.dump(2) << std::endl;
+	return 0;
+}
@@ -0,0 +1,360 @@
+/* merge pipeline benchmark.
+
+   times the steps of a merge over OTD dumps: loading, blank glyph removal,
+   glyph renaming, outline conversion, transform, merging a font into the
+   first one, name table merging and serialization. every step runs on a
+   fresh copy of its input, which is not timed. reports timing percentiles
+   and allocation counts per step as JSON, and compares two reports.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "alloc-profile.h"
+#include "merge-name.h"
+#include "merge.h"
+#include "ps2tt.h"
+#include "source-selector.h"
+#include "transform.h"
+#include "tt2ps.h"
+
+using nlohmann::json;
+
+const char *usage =
+    "usage: %s [--repeat=n] [--filter=step] font.otd ...\n"
+    "       %s --compare=old.json new.json\n"
+    "  --repeat   runs per step (default 5)\n"
+    "  --filter   only steps whose name contains step\n"
+    "  --compare  change of median time and allocations per step\n"
+    "the first font is the base of mergeFont, the others are merged into it.\n";
+
+/* built with -DWFM_ALLOC_PROFILE, alloc-profile.cpp replaces operator new
+   and delete and counts allocations per thread, which is enough as every
+   step runs on the calling thread. otherwise the benchmark counts them.
+*/
+#ifndef WFM_ALLOC_PROFILE
+
+// every allocation of the process, by any thread
+static std::atomic<size_t> allocations{0}, allocatedBytes{0};
+
+static void *Allocate(std::size_t size) noexcept
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	return malloc(size ? size : 1);
+}
+
+static void *AllocateOrThrow(std::size_t size)
+{
+	if (void *p = Allocate(size))
+		return p;
+	throw std::bad_alloc();
+}
+
+/* every allocating form but the over-aligned ones, with the matching
+   deallocations, so that new and delete always pair with malloc and free
+*/
+void *operator new(std::size_t size)
+{
+	return AllocateOrThrow(size);
+}
+
+void *operator new[](std::size_t size)
+{
+	return AllocateOrThrow(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return Allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return Allocate(size);
+}
+
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+	free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+	free(p);
+}
+
+#endif
+
+static void CountAllocations(size_t &count, size_t &bytes)
+{
+#ifdef WFM_ALLOC_PROFILE
+	ThreadAllocations(count, bytes);
+#else
+	count = allocations;
+	bytes = allocatedBytes;
+#endif
+}
+
+struct BenchOptions
+{
+	int repeat = 5;
+	std::string filter;
+};
+
+template <typename T> static T Percentile(std::vector<T> v, int p)
+{
+	std::sort(v.begin(), v.end());
+	return v[std::min(v.size() - 1, v.size() * p / 100)];
+}
+
+/* time run(setup()) options.repeat times. what setup returns and what run
+   returns are destroyed after the timing.
+*/
+template <typename Setup, typename Run>
+static void Bench(json &report, const std::string &step,
+                  const std::string &fixture, size_t items,
+                  const BenchOptions &options, Setup setup, Run run)
+{
+	if (step.find(options.filter) == std::string::npos)
+		return;
+	fprintf(stderr, "%s %s\n", step.c_str(), fixture.c_str());
+	std::vector<double> seconds;
+	std::vector<size_t> counts, bytes;
+	for (int r = 0; r < options.repeat; r++)
+	{
+		auto input = setup();
+		size_t count, size;
+		CountAllocations(count, size);
+		auto start = std::chrono::steady_clock::now();
+		[[maybe_unused]] auto output = run(input);
+		seconds.push_back(std::chrono::duration<double>(
+		                      std::chrono::steady_clock::now() - start)
+		                      .count());
+		size_t countAfter, sizeAfter;
+		CountAllocations(countAfter, sizeAfter);
+		counts.push_back(countAfter - count);
+		bytes.push_back(sizeAfter - size);
+	}
+	double sum = 0;
+	for (double s : seconds)
+		sum += s;
+	report["steps"].push_back(
+	    {{"step", step},
+	     {"fixture", fixture},
+	     {"items", items},
+	     {"seconds",
+	      {{"median", Percentile(seconds, 50)},
+	       {"p10", Percentile(seconds, 10)},
+	       {"p90", Percentile(seconds, 90)},
+	       {"min", Percentile(seconds, 0)},
+	       {"max", Percentile(seconds, 100)},
+	       {"mean", sum / seconds.size()}}},
+	     {"itemsPerSecond", items / Percentile(seconds, 50)},
+	     {"allocations", Percentile(counts, 50)},
+	     {"allocatedBytes", Percentile(bytes, 50)}});
+}
+
+static std::string Name(const std::string &path)
+{
+	size_t slash = path.find_last_of("/\\");
+	return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static json Run(const std::vector<std::string> &files, const BenchOptions &options)
+{
+	json report = {{"repeat", options.repeat}, {"steps", json::array()}};
+	std::vector<json> fonts;
+	for (auto &file : files)
+	{
+		std::string fixture = Name(file);
+		fonts.push_back(json::parse(LoadFile(file.c_str())));
+		const json &font = fonts.back();
+		size_t glyphs = font["glyf"].size();
+
+		Bench(
+		    report, "load", fixture, glyphs, options, [] { return 0; },
+		    [&](int) { return json::parse(LoadFile(file.c_str())); });
+
+		Bench(
+		    report, "removeBlankGlyph", fixture, font["cmap"].size(), options,
+		    [&] { return font; },
+		    [](json &copy) {
+			    RemoveBlankGlyph(copy);
+			    return 0;
+		    });
+		Bench(
+		    report, "fixGlyphName", fixture, glyphs, options,
+		    [&] { return font; },
+		    [&](json &copy) {
+			    FixGlyphName(copy, fixture + ":");
+			    return 0;
+		    });
+		Bench(
+		    report, "transform", fixture, glyphs, options,
+		    [&] { return font["glyf"]; },
+		    [](json &glyf) {
+			    std::vector<json *> glyphs;
+			    for (auto &glyph : glyf)
+				    glyphs.push_back(&glyph);
+			    TransformGlyphs(glyphs,
+			                    Affine::Translate(10, -20) *
+			                        Affine::Scale(0.9, 0.9),
+			                    true);
+			    return glyphs.size();
+		    });
+		Bench(
+		    report, "tt2ps", fixture, glyphs, options,
+		    [&] { return font["glyf"]; },
+		    [](json &glyf) { return Tt2Ps(std::move(glyf)); });
+		json cubic = Tt2Ps(font["glyf"]);
+		Bench(
+		    report, "ps2tt", fixture, glyphs, options, [&] { return cubic; },
+		    [](json &glyf) { return Ps2Tt(std::move(glyf)); });
+		Bench(
+		    report, "dump", fixture, glyphs, options, [] { return 0; },
+		    [&](int) { return font.dump(); });
+	}
+
+	// as Merge prepares fonts, then each of the others into the first
+	for (auto &font : fonts)
+		RemoveBlankGlyph(font);
+	for (size_t i = 1; i < fonts.size(); i++)
+	{
+		std::string prefix = Name(files[i]) + ":";
+		FixGlyphName(fonts[i], prefix);
+		SourceSelector selector;
+		selector.Select(fonts[0]["cmap"], 0);
+		auto selected = selector.Select(fonts[i]["cmap"], 1);
+		Bench(
+		    report, "mergeFont", Name(files[i]), selected.size(), options,
+		    [&] { return std::make_pair(fonts[0], fonts[i]); },
+		    [&](std::pair<json, json> &copies) {
+			    return MergeFont(copies.first, copies.second, selected, prefix,
+			                     Affine(), true);
+		    });
+	}
+	Bench(
+	    report, "mergeNameTable", "all", fonts.size(), options,
+	    [&] {
+		    std::vector<json> nametables;
+		    for (auto &font : fonts)
+			    nametables.push_back(font["name"]);
+		    return nametables;
+	    },
+	    [](std::vector<json> &nametables) {
+		    return MergeNameTable(nametables);
+	    });
+	return report;
+}
+
+static bool Read(const std::string &path, json &report)
+{
+	std::ifstream file(path);
+	if (!file)
+		return false;
+	report = json::parse(file, nullptr, false);
+	return report.is_object() && report["steps"].is_array();
+}
+
+// one line per step found in both reports
+static int Compare(const std::string &oldPath, const std::string &newPath)
+{
+	json before, after;
+	if (!Read(oldPath, before) || !Read(newPath, after))
+	{
+		fprintf(stderr, "cannot read %s or %s\n", oldPath.c_str(),
+		        newPath.c_str());
+		return EXIT_FAILURE;
+	}
+	std::map<std::pair<std::string, std::string>, json> old;
+	for (auto &step : before["steps"])
+		old[{step["step"], step["fixture"]}] = step;
+	printf("%-18s %-36s %10s %10s %8s %12s %8s\n", "step", "fixture",
+	       "old ms", "new ms", "time", "allocations", "change");
+	for (auto &step : after["steps"])
+	{
+		auto it = old.find({step["step"], step["fixture"]});
+		if (it == old.end())
+			continue;
+		double t0 = it->second["seconds"]["median"],
+		       t1 = step["seconds"]["median"];
+		double a0 = it->second["allocations"], a1 = step["allocations"];
+		printf("%-18s %-36s %10.2f %10.2f %+7.1f%% %12.0f %+7.1f%%\n",
+		       step["step"].get<std::string>().c_str(),
+		       step["fixture"].get<std::string>().c_str(), t0 * 1000,
+		       t1 * 1000, t0 ? (t1 / t0 - 1) * 100 : 0, a1,
+		       a0 ? (a1 / a0 - 1) * 100 : 0);
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	BenchOptions options;
+	std::string compare;
+	std::vector<std::string> files;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg.substr(0, 9) == "--repeat=")
+			options.repeat = std::max(1, std::stoi(arg.substr(9)));
+		else if (arg.substr(0, 9) == "--filter=")
+			options.filter = arg.substr(9);
+		else if (arg.substr(0, 10) == "--compare=")
+			compare = arg.substr(10);
+		else
+			files.push_back(arg);
+	}
+	if (!compare.empty() && files.size() == 1)
+		return Compare(compare, files[0]);
+	if (!compare.empty() || files.empty())
+	{
+		fprintf(stderr, usage, argv[0], argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	json report;
+	try
+	{
+		report = Run(files, options);
+	}
+	catch (const std::exception &e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+		return EXIT_FAILURE;
+	}
+	std::cout << report.dump(2) << std::endl;
+	return 0;
+}
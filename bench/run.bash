@@ -0,0 +1,42 @@
+#! /bin/bash
+
+# usage: ./run.bash [outline|pipeline] [report.json] [benchmark options]
+#        ./run.bash check
+
+cd "$(dirname "$0")"
+
+bench=outline
+case $1 in
+	outline|pipeline) bench=$1 ; shift ;;
+	check) bench=check ; shift ;;
+esac
+
+case "$(uname -s)" in
+	Darwin) otfccdump=../bin-mac64/otfccdump ;;
+	*) otfccdump=../bin-linux64/otfccdump ;;
+esac
+
+if [[ $bench != check ]] ; then
+	report=${1:-$bench.json}
+	shift
+fi
+
+mkdir -p fixtures
+for file in ../font/*.ttf ; do
+	otd=fixtures/$(basename "${file/ttf/otd}")
+	[[ -f $otd ]] || $otfccdump --ignore-hints -o "$otd" "$file"
+done
+
+if [[ $bench == check ]] ; then
+	[[ -x outline-bench ]] || ./build.bash
+	./outline-bench --check-exact fixtures/*.otd
+	exit
+fi
+
+[[ -x $bench-bench ]] || ./build.bash
+if [[ $bench == pipeline ]] ; then
+	# the base font first
+	./pipeline-bench "$@" fixtures/Nowar-Sans-LCG-Apache-Regular.otd fixtures/Nowar-Sans-LCG-Medium.otd fixtures/Nowar-Sans-CJK-XS-Regular.otd > "$report"
+else
+	./outline-bench "$@" fixtures/*.otd > "$report"
+fi
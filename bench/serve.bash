@@ -0,0 +1,86 @@
+#! /bin/bash
+
+# integration test of merge-otd --serve and --connect on this machine:
+# merged files and --output=- must equal a standalone merge, a malformed
+# input must fail its job only, a silent client must not hold the only
+# worker, and SIGTERM must stop the server cleanly.
+# usage: ./serve.bash
+
+cd "$(dirname "$0")"
+
+case "$(uname -s)" in
+	Darwin) otfccdump=../bin-mac64/otfccdump ;;
+	*) otfccdump=../bin-linux64/otfccdump ;;
+esac
+
+mkdir -p fixtures
+for file in ../font/*.ttf ; do
+	otd=fixtures/$(basename "${file/ttf/otd}")
+	[[ -f $otd ]] || $otfccdump --ignore-hints -o "$otd" "$file"
+done
+
+[[ -x merge-otd-bench ]] || ./build.bash
+
+# absolute, as the server resolves them: renamed glyphs carry the path
+base=$PWD/fixtures/Nowar-Sans-LCG-Apache-Regular.otd
+ext=$PWD/fixtures/Nowar-Sans-LCG-Medium.otd
+tmp=$(mktemp -d)
+socket=$tmp/wfm.sock
+server=
+cleanup() {
+	[[ -n $server ]] && kill $server 2> /dev/null
+	rm -rf "$tmp"
+}
+trap cleanup EXIT
+
+fail() {
+	echo "FAIL: $*" >&2
+	exit 1
+}
+
+./merge-otd-bench --output="$tmp/expected.otd" "$base" "$ext" || fail "standalone merge"
+
+# one worker, so that a stuck request would stall every job
+./merge-otd-bench --serve="$socket" --jobs=1 "$base" &
+server=$!
+for i in {1..100} ; do
+	[[ -S $socket ]] && break
+	sleep 0.1
+done
+[[ -S $socket ]] || fail "server did not listen on $socket"
+
+./merge-otd-bench --connect="$socket" --output="$tmp/file.otd" "$base" "$ext" || fail "job with --output=<file>"
+cmp "$tmp/expected.otd" "$tmp/file.otd" || fail "--output=<file> differs from standalone merge"
+
+./merge-otd-bench --connect="$socket" --output=- "$base" "$ext" > "$tmp/stdout.otd" || fail "job with --output=-"
+cmp "$tmp/expected.otd" "$tmp/stdout.otd" || fail "--output=- differs from standalone merge"
+
+head -c 10000 "$ext" > "$tmp/malformed.otd"
+./merge-otd-bench --connect="$socket" --output="$tmp/malformed-out.otd" "$base" "$tmp/malformed.otd" 2> /dev/null && fail "malformed input did not fail"
+kill -0 $server 2> /dev/null || fail "server died on malformed input"
+./merge-otd-bench --connect="$socket" --output=- "$base" "$ext" > "$tmp/after.otd" || fail "job after malformed input"
+cmp "$tmp/expected.otd" "$tmp/after.otd" || fail "merge after malformed input differs"
+
+# connects and never sends its request, until the server gives up on it
+python3 -c 'import socket, sys, time
+s = socket.socket(socket.AF_UNIX)
+s.connect(sys.argv[1])
+time.sleep(60)' "$socket" &
+silent=$!
+sleep 0.5
+timeout 30 ./merge-otd-bench --connect="$socket" --output=- "$base" "$ext" > "$tmp/silent.otd"
+status=$?
+kill $silent 2> /dev/null
+[[ $status == 0 ]] || fail "job behind a silent client"
+cmp "$tmp/expected.otd" "$tmp/silent.otd" || fail "merge behind a silent client differs"
+
+kill -TERM $server
+for i in {1..100} ; do
+	kill -0 $server 2> /dev/null || break
+	sleep 0.1
+done
+kill -0 $server 2> /dev/null && fail "server still running 10 seconds after SIGTERM"
+wait $server || fail "server exited with status $? on SIGTERM"
+server=
+[[ -e $socket ]] && fail "socket left behind"
+echo "ok"
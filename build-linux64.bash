@@ -4,7 +4,8 @@ source ./version.bash
 
 VERSION=$VERSION-linux64
 
-g++ src/merge-otd.cpp src/merge-name.cpp src/ps2tt.cpp src/tt2ps.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -o bin-linux64/merge-otd
+g++ src/merge-otd.cpp src/batch.cpp src/daemon.cpp src/merge.cpp src/merge-name.cpp src/glyph-order.cpp src/glyph-store.cpp src/packed-glyph.cpp src/alloc-profile.cpp src/phase-stats.cpp src/trace.cpp src/ps2tt.cpp src/tt2ps.cpp src/outline-cache.cpp src/mapped-file.cpp src/simplify.cpp src/skeleton.cpp src/source-selector.cpp src/subset.cpp src/transform.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -o bin-linux64/merge-otd
+g++ src/wfm.cpp src/batch.cpp src/merge.cpp src/merge-name.cpp src/glyph-order.cpp src/glyph-store.cpp src/packed-glyph.cpp src/alloc-profile.cpp src/phase-stats.cpp src/trace.cpp src/ps2tt.cpp src/tt2ps.cpp src/outline-cache.cpp src/mapped-file.cpp src/simplify.cpp src/skeleton.cpp src/source-selector.cpp src/subset.cpp src/transform.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -o bin-linux64/wfm
 
 mkdir -p release
 cd release
@@ -15,7 +16,7 @@ R=字体合并补全工具-简体中文压缩字库-$VERSION
 mkdir -p $R
 
 cp ../script-unix/link.url $R/主页-使用说明.url
-cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd} $R/
+cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd,wfm} $R/
 cp ../script-unix/comp.sh $R/补全.sh
 cp ../script-unix/merge.sh $R/合并.sh
 cp ../script-unix/merge+comp.sh $R/合并补全.sh
@@ -32,7 +33,7 @@ R=字体合并补全工具-简体中文标准字库-$VERSION
 mkdir -p $R
 
 cp ../script-unix/link.url $R/主页-使用说明.url
-cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd} $R/
+cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd,wfm} $R/
 cp ../script-unix/comp.sh $R/补全.sh
 cp ../script-unix/merge.sh $R/合并.sh
 cp ../script-unix/merge+comp.sh $R/合并补全.sh
@@ -49,7 +50,7 @@ R=字体合并补全工具-简体中文大字库-$VERSION
 mkdir -p $R
 
 cp ../script-unix/link.url $R/主页-使用说明.url
-cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd} $R/
+cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd,wfm} $R/
 cp ../script-unix/comp.sh $R/补全.sh
 cp ../script-unix/merge.sh $R/合并.sh
 cp ../script-unix/merge+comp.sh $R/合并补全.sh
@@ -66,7 +67,7 @@ R=字型合併補全工具-繁體中文大字庫-$VERSION
 mkdir -p $R
 
 cp ../script-unix/link.url $R/主頁-使用說明\(簡體\).url
-cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd} $R/
+cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd,wfm} $R/
 cp ../script-unix/comp.sh $R/補全.sh
 cp ../script-unix/merge.sh $R/合併.sh
 cp ../script-unix/merge+comp.sh $R/合併補全.sh
@@ -83,7 +84,7 @@ R=字型合併補全工具-傳統字形大字庫-$VERSION
 mkdir -p $R
 
 cp ../script-unix/link.url $R/主頁-使用說明\(簡體\).url
-cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd} $R/
+cp ../bin-linux64/{otfccbuild,otfccdump,merge-otd,wfm} $R/
 cp ../script-unix/comp.sh $R/補全.sh
 cp ../script-unix/merge.sh $R/合併.sh
 cp ../script-unix/merge+comp.sh $R/合併補全.sh
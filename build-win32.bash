@@ -4,7 +4,15 @@ source ./version.bash
 
 VERSION=$VERSION-win32
 
-i686-w64-mingw32-g++ src/merge-otd.cpp src/merge-name.cpp src/ps2tt.cpp src/tt2ps.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -Wl,--large-address-aware -o bin-win32/merge-otd.exe
+# std::thread and std::mutex need the posix thread model
+CXX=i686-w64-mingw32-g++-posix
+if ! command -v $CXX > /dev/null ; then
+	echo "$CXX not found: a MinGW-w64 with the posix thread model is required" >&2
+	exit 1
+fi
+
+$CXX src/merge-otd.cpp src/batch.cpp src/daemon.cpp src/merge.cpp src/merge-name.cpp src/glyph-order.cpp src/glyph-store.cpp src/packed-glyph.cpp src/alloc-profile.cpp src/phase-stats.cpp src/trace.cpp src/ps2tt.cpp src/tt2ps.cpp src/outline-cache.cpp src/mapped-file.cpp src/simplify.cpp src/skeleton.cpp src/source-selector.cpp src/subset.cpp src/transform.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -Wl,--large-address-aware -o bin-win32/merge-otd.exe
+$CXX src/wfm.cpp src/batch.cpp src/merge.cpp src/merge-name.cpp src/glyph-order.cpp src/glyph-store.cpp src/packed-glyph.cpp src/alloc-profile.cpp src/phase-stats.cpp src/trace.cpp src/ps2tt.cpp src/tt2ps.cpp src/outline-cache.cpp src/mapped-file.cpp src/simplify.cpp src/skeleton.cpp src/source-selector.cpp src/subset.cpp src/transform.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -Wl,--large-address-aware -o bin-win32/wfm.exe
 
 mkdir -p release
 cd release
@@ -15,7 +23,7 @@ R=字体合并补全工具-简体中文压缩字库-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主页-使用说明.url
-cp ../bin-win32/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win32/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/补全.bat
 cp ../script-windows/merge.bat $R/合并.bat
 cp ../script-windows/merge+comp.bat $R/合并补全.bat
@@ -32,7 +40,7 @@ R=字体合并补全工具-简体中文标准字库-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主页-使用说明.url
-cp ../bin-win32/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win32/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/补全.bat
 cp ../script-windows/merge.bat $R/合并.bat
 cp ../script-windows/merge+comp.bat $R/合并补全.bat
@@ -4,7 +4,15 @@ source ./version.bash
 
 VERSION=$VERSION-win64
 
-x86_64-w64-mingw32-g++ src/merge-otd.cpp src/merge-name.cpp src/ps2tt.cpp src/tt2ps.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -o bin-win64/merge-otd.exe
+# std::thread and std::mutex need the posix thread model
+CXX=x86_64-w64-mingw32-g++-posix
+if ! command -v $CXX > /dev/null ; then
+	echo "$CXX not found: a MinGW-w64 with the posix thread model is required" >&2
+	exit 1
+fi
+
+$CXX src/merge-otd.cpp src/batch.cpp src/daemon.cpp src/merge.cpp src/merge-name.cpp src/glyph-order.cpp src/glyph-store.cpp src/packed-glyph.cpp src/alloc-profile.cpp src/phase-stats.cpp src/trace.cpp src/ps2tt.cpp src/tt2ps.cpp src/outline-cache.cpp src/mapped-file.cpp src/simplify.cpp src/skeleton.cpp src/source-selector.cpp src/subset.cpp src/transform.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -o bin-win64/merge-otd.exe
+$CXX src/wfm.cpp src/batch.cpp src/merge.cpp src/merge-name.cpp src/glyph-order.cpp src/glyph-store.cpp src/packed-glyph.cpp src/alloc-profile.cpp src/phase-stats.cpp src/trace.cpp src/ps2tt.cpp src/tt2ps.cpp src/outline-cache.cpp src/mapped-file.cpp src/simplify.cpp src/skeleton.cpp src/source-selector.cpp src/subset.cpp src/transform.cpp src/iostream.cpp -Isrc/ -std=c++17 -O3 -static -s -o bin-win64/wfm.exe
 
 mkdir -p release
 cd release
@@ -15,7 +23,7 @@ R=字体合并补全工具-简体中文压缩字库-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主页-使用说明.url
-cp ../bin-win64/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win64/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/补全.bat
 cp ../script-windows/merge.bat $R/合并.bat
 cp ../script-windows/merge+comp.bat $R/合并补全.bat
@@ -32,7 +40,7 @@ R=字体合并补全工具-简体中文标准字库-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主页-使用说明.url
-cp ../bin-win64/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win64/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/补全.bat
 cp ../script-windows/merge.bat $R/合并.bat
 cp ../script-windows/merge+comp.bat $R/合并补全.bat
@@ -49,7 +57,7 @@ R=字体合并补全工具-简体中文大字库-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主页-使用说明.url
-cp ../bin-win64/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win64/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/补全.bat
 cp ../script-windows/merge.bat $R/合并.bat
 cp ../script-windows/merge+comp.bat $R/合并补全.bat
@@ -66,7 +74,7 @@ R=字型合併補全工具-繁體中文大字庫-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主頁-使用說明\(簡體\).url
-cp ../bin-win64/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win64/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/補全.bat
 cp ../script-windows/merge.bat $R/合併.bat
 cp ../script-windows/merge+comp.bat $R/合併補全.bat
@@ -83,7 +91,7 @@ R=字型合併補全工具-傳統字形大字庫-$VERSION
 mkdir -p $R
 
 cp ../script-windows/link.url $R/主頁-使用說明\(簡體\).url
-cp ../bin-win64/{otfccbuild,otfccdump,merge-otd}.exe $R/
+cp ../bin-win64/{otfccbuild,otfccdump,merge-otd,wfm}.exe $R/
 cp ../script-windows/comp.bat $R/補全.bat
 cp ../script-windows/merge.bat $R/合併.bat
 cp ../script-windows/merge+comp.bat $R/合併補全.bat
@@ -0,0 +1,50 @@
+# generate ../src/charset-table.hpp, built-in charsets of merge-otd
+# usage: python charset-table.py > ../src/charset-table.hpp
+
+def Encodable(codec, maxBytes = 4):
+	result = set()
+	for u in range(0x10000):
+		# surrogates and private use area
+		if 0xD800 <= u < 0xF900:
+			continue
+		try:
+			if len(chr(u).encode(codec)) <= maxBytes:
+				result.add(u)
+		except UnicodeEncodeError:
+			pass
+	return result
+
+def Ranges(charset):
+	ranges = []
+	for u in sorted(charset):
+		if ranges and ranges[-1][1] == u - 1:
+			ranges[-1][1] = u
+		else:
+			ranges.append([u, u])
+	return ranges
+
+Charsets = [
+	('Gb2312', 'GB 2312', Encodable('gb2312')),
+	('Gbk', 'GBK', Encodable('gbk')),
+	# 2-byte region and CJK Extension A
+	('Gb18030', 'GB 18030', Encodable('gb18030', 2) | set(range(0x3400, 0x4DC0))),
+	('Big5', 'Big5', Encodable('big5')),
+]
+
+if __name__ == '__main__':
+	print('#pragma once')
+	print()
+	print('// generated by font-builder/charset-table.py')
+	print()
+	print('struct CodepointRange {')
+	print('\tint first;')
+	print('\tint last;')
+	print('};')
+	for (name, comment, charset) in Charsets:
+		ranges = Ranges(charset)
+		print()
+		print('// {}, {} characters'.format(comment, len(charset)))
+		print('constexpr static CodepointRange {}Ranges[] = {{'.format(name))
+		for i in range(0, len(ranges), 6):
+			print('    ' + ' '.join('{{0x{:04X}, 0x{:04X}}},'.format(*r) for r in ranges[i:i + 6]))
+		print('};')
@@ -0,0 +1,165 @@
+#include "alloc-profile.h"
+
+#ifdef WFM_ALLOC_PROFILE
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace {
+
+constexpr unsigned maxPhases = 64;
+
+/* zero-initialized before any constructor runs, so that allocations of
+   static initialization are counted too. tag 0 is "other".
+*/
+struct Counters {
+	std::atomic<size_t> allocations, bytes, frees, live, peakLive;
+};
+Counters counters[maxPhases];
+const char *names[maxPhases];
+std::atomic<unsigned> phaseCount{1};
+std::mutex namesMutex;
+
+thread_local unsigned currentPhase;
+thread_local size_t threadAllocations, threadBytes;
+
+// before each block: its size and phase, keeping malloc's alignment
+struct alignas(std::max_align_t) Header {
+	size_t size;
+	unsigned phase;
+};
+
+void *Allocate(size_t size) noexcept {
+	auto *header = static_cast<Header *>(malloc(sizeof(Header) + size));
+	if (!header)
+		return nullptr;
+	header->size = size;
+	header->phase = currentPhase;
+	threadAllocations++;
+	threadBytes += size;
+	Counters &c = counters[currentPhase];
+	c.allocations.fetch_add(1, std::memory_order_relaxed);
+	c.bytes.fetch_add(size, std::memory_order_relaxed);
+	size_t live = c.live.fetch_add(size, std::memory_order_relaxed) + size;
+	size_t peak = c.peakLive.load(std::memory_order_relaxed);
+	while (live > peak &&
+	       !c.peakLive.compare_exchange_weak(peak, live,
+	                                         std::memory_order_relaxed))
+		;
+	return header + 1;
+}
+
+void *AllocateOrThrow(size_t size) {
+	if (void *p = Allocate(size))
+		return p;
+	throw std::bad_alloc();
+}
+
+void Free(void *p) noexcept {
+	if (!p)
+		return;
+	Header *header = static_cast<Header *>(p) - 1;
+	Counters &c = counters[header->phase];
+	c.frees.fetch_add(1, std::memory_order_relaxed);
+	c.live.fetch_sub(header->size, std::memory_order_relaxed);
+	free(header);
+}
+
+} // namespace
+
+/* every allocating form but the over-aligned ones, which keep the
+   library's allocation and deallocation and are not counted
+*/
+void *operator new(std::size_t size) {
+	return AllocateOrThrow(size);
+}
+void *operator new[](std::size_t size) {
+	return AllocateOrThrow(size);
+}
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+	return Allocate(size);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+	return Allocate(size);
+}
+void operator delete(void *p) noexcept {
+	Free(p);
+}
+void operator delete[](void *p) noexcept {
+	Free(p);
+}
+void operator delete(void *p, std::size_t) noexcept {
+	Free(p);
+}
+void operator delete[](void *p, std::size_t) noexcept {
+	Free(p);
+}
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+	Free(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+	Free(p);
+}
+
+void SetAllocPhase(const char *phase) {
+	if (!phase) {
+		currentPhase = 0;
+		return;
+	}
+	std::lock_guard<std::mutex> lock(namesMutex);
+	unsigned count = phaseCount;
+	for (unsigned i = 1; i < count; i++)
+		if (!strcmp(names[i], phase)) {
+			currentPhase = i;
+			return;
+		}
+	if (count == maxPhases) {
+		currentPhase = 0;
+		return;
+	}
+	names[count] = phase;
+	phaseCount = count + 1;
+	currentPhase = count;
+}
+
+void ThreadAllocations(size_t &allocations, size_t &bytes) {
+	allocations = threadAllocations;
+	bytes = threadBytes;
+}
+
+std::vector<AllocStats> GetAllocStats() {
+	std::vector<AllocStats> result;
+	std::lock_guard<std::mutex> lock(namesMutex);
+	unsigned count = phaseCount;
+	for (unsigned i = 0; i < count; i++) {
+		const Counters &c = counters[i];
+		AllocStats stats;
+		stats.phase = i ? names[i] : "other";
+		stats.allocations = c.allocations;
+		stats.bytes = c.bytes;
+		stats.frees = c.frees;
+		stats.live = c.live;
+		stats.peakLive = c.peakLive;
+		if (stats.allocations)
+			result.push_back(stats);
+	}
+	return result;
+}
+
+#else
+
+void SetAllocPhase(const char *) {}
+
+void ThreadAllocations(size_t &allocations, size_t &bytes) {
+	allocations = bytes = 0;
+}
+
+std::vector<AllocStats> GetAllocStats() {
+	return {};
+}
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/* allocations by phase, in builds with -DWFM_ALLOC_PROFILE, which replace
+   operator new and delete. each allocation is tagged with the phase of the
+   thread that makes it, and its release is charged to that phase whichever
+   thread frees it. other builds count nothing.
+*/
+struct AllocStats {
+	const char *phase; // "other" for allocations outside phases
+	size_t allocations = 0;
+	size_t bytes = 0;
+	size_t frees = 0;
+	size_t live = 0;     // bytes allocated in the phase, not freed yet
+	size_t peakLive = 0; // the most live has been
+};
+
+constexpr bool AllocProfiling() {
+#ifdef WFM_ALLOC_PROFILE
+	return true;
+#else
+	return false;
+#endif
+}
+
+/* tag later allocations of the calling thread with phase, a string
+   literal, or with none if null. there are at most 64 phases, later
+   ones count as "other".
+*/
+void SetAllocPhase(const char *phase);
+
+// allocations and bytes of the calling thread so far
+void ThreadAllocations(size_t &allocations, size_t &bytes);
+
+// every phase with an allocation, in order of first use
+std::vector<AllocStats> GetAllocStats();
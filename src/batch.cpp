@@ -0,0 +1,200 @@
+#include <algorithm>
+
+#include <nowide/fstream.hpp>
+
+#include "batch.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+// GetProcessMemoryInfo from kernel32, without linking psapi
+#define PSAPI_VERSION 2
+#include <windows.h>
+
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using json = nlohmann::json;
+
+// split at spaces outside quotes. returns false on unbalanced quotes.
+static bool SplitArguments(const std::string &line,
+                           std::vector<std::string> &args) {
+	std::string arg;
+	bool quoted = false, started = false;
+	for (char c : line) {
+		if (c == '"') {
+			quoted = !quoted;
+			started = true;
+		} else if (!quoted && (c == ' ' || c == '\t' || c == '\r')) {
+			if (started)
+				args.push_back(std::move(arg));
+			arg.clear();
+			started = false;
+		} else if (!quoted && c == '#')
+			break;
+		else {
+			arg += c;
+			started = true;
+		}
+	}
+	if (started)
+		args.push_back(std::move(arg));
+	return !quoted;
+}
+
+bool ReadManifest(const char *u8filename,
+                  std::vector<std::vector<std::string>> &jobs,
+                  size_t &errorLine) {
+	nowide::ifstream file(u8filename);
+	errorLine = 0;
+	if (!file)
+		return false;
+
+	std::string line;
+	for (size_t lineNo = 1; std::getline(file, line); lineNo++) {
+		std::vector<std::string> args;
+		if (!SplitArguments(line, args)) {
+			errorLine = lineNo;
+			return false;
+		}
+		if (!args.empty())
+			jobs.push_back(std::move(args));
+	}
+	return true;
+}
+
+InputCache::InputCache(std::map<std::string, size_t> uses)
+    : total(uses), uses(uses) {}
+
+bool InputCache::Shared(const std::string &file) const {
+	auto it = total.find(file);
+	return it != total.end() && it->second > 1;
+}
+
+InputCache::Input InputCache::Get(const std::string &file,
+                                  const std::string &variant,
+                                  const std::function<json()> &load) {
+	std::unique_lock<std::mutex> lock(mutex);
+	auto it = inputs.find({file, variant});
+	if (it != inputs.end()) {
+		auto input = it->second;
+		lock.unlock();
+		return input.get();
+	}
+	std::promise<Input> promise;
+	inputs.emplace(std::make_pair(file, variant), promise.get_future().share());
+	lock.unlock();
+
+	try {
+		auto input = std::make_shared<const json>(load());
+		promise.set_value(input);
+		return input;
+	} catch (...) {
+		promise.set_exception(std::current_exception());
+		throw;
+	}
+}
+
+void InputCache::Release(const std::string &file) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto use = uses.find(file);
+	if (use == uses.end() || --use->second)
+		return;
+	auto it = inputs.lower_bound({file, ""});
+	while (it != inputs.end() && it->first.first == file)
+		it = inputs.erase(it);
+}
+
+MemoryScheduler::MemoryScheduler(size_t budget, std::set<std::string> resident)
+    : budget(budget), resident(std::move(resident)) {}
+
+void MemoryScheduler::Submit(size_t id, size_t own,
+                             const std::map<Key, size_t> &shared) {
+	std::lock_guard<std::mutex> lock(mutex);
+	jobs[id] = {own, shared};
+	for (auto &[key, bytes] : shared)
+		users[key]++;
+	queue.push_back(id);
+	stats.queued = queue.size();
+	stats.peakQueued = std::max(stats.peakQueued, stats.queued);
+	finished.notify_all();
+}
+
+size_t MemoryScheduler::Cost(const Job &job) const {
+	size_t cost = job.own;
+	for (auto &[key, bytes] : job.shared)
+		if (!charged.count(key))
+			cost += bytes;
+	return cost;
+}
+
+size_t MemoryScheduler::Admit() {
+	std::unique_lock<std::mutex> lock(mutex);
+	auto next = queue.end();
+	finished.wait(lock, [&] {
+		next = std::find_if(queue.begin(), queue.end(), [&](size_t id) {
+			return !budget ||
+			       stats.admitted + Cost(jobs[id]) <= budget;
+		});
+		// too large for the budget, alone then
+		if (next == queue.end() && !running && !queue.empty())
+			next = queue.begin();
+		return next != queue.end();
+	});
+
+	size_t id = *next;
+	queue.erase(next);
+	Job &job = jobs[id];
+	stats.admitted += Cost(job);
+	for (auto &[key, bytes] : job.shared)
+		charged.emplace(key, bytes);
+	running++;
+	stats.queued = queue.size();
+	stats.peakAdmitted = std::max(stats.peakAdmitted, stats.admitted);
+	return id;
+}
+
+void MemoryScheduler::Finish(size_t id) {
+	std::lock_guard<std::mutex> lock(mutex);
+	Job &job = jobs[id];
+	stats.admitted -= job.own;
+	for (auto &[key, bytes] : job.shared) {
+		if (--users[key] || resident.count(key.first))
+			continue;
+		users.erase(key);
+		auto it = charged.find(key);
+		if (it != charged.end()) {
+			stats.admitted -= it->second;
+			charged.erase(it);
+		}
+	}
+	jobs.erase(id);
+	running--;
+	finished.notify_all();
+}
+
+MemoryScheduler::Stats MemoryScheduler::GetStats() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+size_t PeakMemory() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof counters))
+		return 0;
+	return counters.PeakWorkingSetSize;
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+#ifdef __APPLE__
+	return size_t(usage.ru_maxrss);
+#else
+	return size_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
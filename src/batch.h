@@ -0,0 +1,110 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+/* one job per line, arguments as on the command line, separated by spaces.
+   arguments containing spaces are quoted with "". "#" starts a comment.
+   on failure, errorLine is the first malformed line, or 0 if the file
+   cannot be read.
+*/
+bool ReadManifest(const char *u8filename,
+                  std::vector<std::vector<std::string>> &jobs,
+                  size_t &errorLine);
+
+/* inputs loaded and preprocessed once, shared read-only between jobs.
+
+   an input is identified by its file and a variant, the preprocessing that
+   depends on job options. all variants of a file are dropped once the jobs
+   that use the file have released it.
+*/
+class InputCache {
+public:
+	using Input = std::shared_ptr<const nlohmann::json>;
+
+	// uses: number of jobs that use each file
+	explicit InputCache(std::map<std::string, size_t> uses);
+
+	/* the input, prepared by load if it is not cached yet. other threads
+	   asking for the same input wait for it. exceptions from load are
+	   rethrown to all of them.
+	*/
+	Input Get(const std::string &file, const std::string &variant,
+	          const std::function<nlohmann::json()> &load);
+
+	// whether more than one job uses file, otherwise jobs load it themselves
+	bool Shared(const std::string &file) const;
+
+	void Release(const std::string &file);
+
+private:
+	std::mutex mutex;
+	const std::map<std::string, size_t> total;
+	std::map<std::string, size_t> uses; // jobs yet to release
+	std::map<std::pair<std::string, std::string>, std::shared_future<Input>>
+	    inputs;
+};
+
+/* admits queued jobs while their estimated memory fits a budget.
+
+   a job is charged its own bytes while it runs. a shared input, identified
+   as in InputCache, is charged once, from the first admitted job that uses
+   it until the last submitted job that uses it finishes; resident files
+   stay charged. the first queued job that fits is admitted, so small jobs
+   pass a large one that has to wait. a job larger than the whole budget
+   runs when nothing else does. a budget of 0 admits every job.
+*/
+class MemoryScheduler {
+public:
+	using Key = std::pair<std::string, std::string>; // file and variant
+
+	struct Stats {
+		size_t queued = 0, peakQueued = 0;
+		size_t admitted = 0, peakAdmitted = 0; // bytes
+	};
+
+	explicit MemoryScheduler(size_t budget, std::set<std::string> resident = {});
+
+	void Submit(size_t id, size_t own, const std::map<Key, size_t> &shared);
+
+	/* wait until a queued job fits and return it. every call must be
+	   preceded by a Submit.
+	*/
+	size_t Admit();
+
+	void Finish(size_t id);
+
+	Stats GetStats();
+
+private:
+	struct Job {
+		size_t own;
+		std::map<Key, size_t> shared;
+	};
+
+	std::mutex mutex;
+	std::condition_variable finished;
+	const size_t budget;
+	const std::set<std::string> resident;
+	std::vector<size_t> queue;
+	std::map<size_t, Job> jobs;
+	size_t running = 0;
+	std::map<Key, size_t> users;   // submitted jobs not finished yet
+	std::map<Key, size_t> charged; // shared inputs held
+	Stats stats;
+
+	// bytes admitting job would add
+	size_t Cost(const Job &job) const;
+};
+
+// peak resident memory of this process in bytes, 0 if unknown
+size_t PeakMemory();
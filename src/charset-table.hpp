@@ -0,0 +1,1317 @@
+#pragma once
+
+// generated by font-builder/charset-table.py
+
+struct CodepointRange {
+	int first;
+	int last;
+};
+
+// GB 2312, 7573 characters
+constexpr static CodepointRange Gb2312Ranges[] = {
+    {0x0000, 0x007F}, {0x00A4, 0x00A4}, {0x00A7, 0x00A8}, {0x00B0, 0x00B1}, {0x00D7, 0x00D7}, {0x00E0, 0x00E1},
+    {0x00E8, 0x00EA}, {0x00EC, 0x00ED}, {0x00F2, 0x00F3}, {0x00F7, 0x00F7}, {0x00F9, 0x00FA}, {0x00FC, 0x00FC},
+    {0x0101, 0x0101}, {0x0113, 0x0113}, {0x011B, 0x011B}, {0x012B, 0x012B}, {0x014D, 0x014D}, {0x016B, 0x016B},
+    {0x01CE, 0x01CE}, {0x01D0, 0x01D0}, {0x01D2, 0x01D2}, {0x01D4, 0x01D4}, {0x01D6, 0x01D6}, {0x01D8, 0x01D8},
+    {0x01DA, 0x01DA}, {0x01DC, 0x01DC}, {0x02C7, 0x02C7}, {0x02C9, 0x02C9}, {0x0391, 0x03A1}, {0x03A3, 0x03A9},
+    {0x03B1, 0x03C1}, {0x03C3, 0x03C9}, {0x0401, 0x0401}, {0x0410, 0x044F}, {0x0451, 0x0451}, {0x2015, 0x2016},
+    {0x2018, 0x2019}, {0x201C, 0x201D}, {0x2026, 0x2026}, {0x2030, 0x2030}, {0x2032, 0x2033}, {0x203B, 0x203B},
+    {0x2103, 0x2103}, {0x2116, 0x2116}, {0x2160, 0x216B}, {0x2190, 0x2193}, {0x2208, 0x2208}, {0x220F, 0x220F},
+    {0x2211, 0x2211}, {0x221A, 0x221A}, {0x221D, 0x221E}, {0x2220, 0x2220}, {0x2225, 0x2225}, {0x2227, 0x222B},
+    {0x222E, 0x222E}, {0x2234, 0x2237}, {0x223D, 0x223D}, {0x2248, 0x2248}, {0x224C, 0x224C}, {0x2260, 0x2261},
+    {0x2264, 0x2265}, {0x226E, 0x226F}, {0x2299, 0x2299}, {0x22A5, 0x22A5}, {0x2312, 0x2312}, {0x2460, 0x2469},
+    {0x2474, 0x249B}, {0x2500, 0x254B}, {0x25A0, 0x25A1}, {0x25B2, 0x25B3}, {0x25C6, 0x25C7}, {0x25CB, 0x25CB},
+    {0x25CE, 0x25CF}, {0x2605, 0x2606}, {0x2640, 0x2640}, {0x2642, 0x2642}, {0x3000, 0x3003}, {0x3005, 0x3005},
+    {0x3008, 0x3011}, {0x3013, 0x3017}, {0x3041, 0x3093}, {0x30A1, 0x30F6}, {0x30FB, 0x30FB}, {0x3105, 0x3129},
+    {0x3220, 0x3229}, {0x4E00, 0x4E01}, {0x4E03, 0x4E03}, {0x4E07, 0x4E0E}, {0x4E10, 0x4E11}, {0x4E13, 0x4E16},
+    {0x4E18, 0x4E1E}, {0x4E22, 0x4E22}, {0x4E24, 0x4E25}, {0x4E27, 0x4E28}, {0x4E2A, 0x4E2D}, {0x4E30, 0x4E30},
+    {0x4E32, 0x4E32}, {0x4E34, 0x4E34}, {0x4E36, 0x4E36}, {0x4E38, 0x4E3B}, {0x4E3D, 0x4E3F}, {0x4E43, 0x4E43},
+    {0x4E45, 0x4E45}, {0x4E47, 0x4E49}, {0x4E4B, 0x4E50}, {0x4E52, 0x4E54}, {0x4E56, 0x4E56}, {0x4E58, 0x4E59},
+    {0x4E5C, 0x4E61}, {0x4E66, 0x4E66}, {0x4E69, 0x4E69}, {0x4E70, 0x4E71}, {0x4E73, 0x4E73}, {0x4E7E, 0x4E7E},
+    {0x4E86, 0x4E86}, {0x4E88, 0x4E89}, {0x4E8B, 0x4E8F}, {0x4E91, 0x4E95}, {0x4E98, 0x4E98}, {0x4E9A, 0x4E9B},
+    {0x4E9F, 0x4EA2}, {0x4EA4, 0x4EA9}, {0x4EAB, 0x4EAE}, {0x4EB2, 0x4EB3}, {0x4EB5, 0x4EB5}, {0x4EBA, 0x4EBB},
+    {0x4EBF, 0x4EC7}, {0x4EC9, 0x4ECB}, {0x4ECD, 0x4ECE}, {0x4ED1, 0x4ED1}, {0x4ED3, 0x4ED9}, {0x4EDD, 0x4EDF},
+    {0x4EE1, 0x4EE1}, {0x4EE3, 0x4EE5}, {0x4EE8, 0x4EE8}, {0x4EEA, 0x4EEC}, {0x4EF0, 0x4EF0}, {0x4EF2, 0x4EF3},
+    {0x4EF5, 0x4EF7}, {0x4EFB, 0x4EFB}, {0x4EFD, 0x4EFD}, {0x4EFF, 0x4EFF}, {0x4F01, 0x4F01}, {0x4F09, 0x4F0A},
+    {0x4F0D, 0x4F11}, {0x4F17, 0x4F1B}, {0x4F1E, 0x4F20}, {0x4F22, 0x4F22}, {0x4F24, 0x4F27}, {0x4F2A, 0x4F2B},
+    {0x4F2F, 0x4F30}, {0x4F32, 0x4F32}, {0x4F34, 0x4F34}, {0x4F36, 0x4F36}, {0x4F38, 0x4F38}, {0x4F3A, 0x4F3A},
+    {0x4F3C, 0x4F3D}, {0x4F43, 0x4F43}, {0x4F46, 0x4F46}, {0x4F4D, 0x4F51}, {0x4F53, 0x4F53}, {0x4F55, 0x4F55},
+    {0x4F57, 0x4F60}, {0x4F63, 0x4F65}, {0x4F67, 0x4F67}, {0x4F69, 0x4F69}, {0x4F6C, 0x4F6C}, {0x4F6F, 0x4F70},
+    {0x4F73, 0x4F74}, {0x4F76, 0x4F76}, {0x4F7B, 0x4F7C}, {0x4F7E, 0x4F7F}, {0x4F83, 0x4F84}, {0x4F88, 0x4F89},
+    {0x4F8B, 0x4F8B}, {0x4F8D, 0x4F8D}, {0x4F8F, 0x4F8F}, {0x4F91, 0x4F91}, {0x4F94, 0x4F94}, {0x4F97, 0x4F97},
+    {0x4F9B, 0x4F9B}, {0x4F9D, 0x4F9D}, {0x4FA0, 0x4FA0}, {0x4FA3, 0x4FA3}, {0x4FA5, 0x4FAA}, {0x4FAC, 0x4FAC},
+    {0x4FAE, 0x4FAF}, {0x4FB5, 0x4FB5}, {0x4FBF, 0x4FBF}, {0x4FC3, 0x4FC5}, {0x4FCA, 0x4FCA}, {0x4FCE, 0x4FD1},
+    {0x4FD7, 0x4FD8}, {0x4FDA, 0x4FDA}, {0x4FDC, 0x4FDF}, {0x4FE1, 0x4FE1}, {0x4FE3, 0x4FE3}, {0x4FE6, 0x4FE6},
+    {0x4FE8, 0x4FEA}, {0x4FED, 0x4FEF}, {0x4FF1, 0x4FF1}, {0x4FF3, 0x4FF3}, {0x4FF8, 0x4FF8}, {0x4FFA, 0x4FFA},
+    {0x4FFE, 0x4FFE}, {0x500C, 0x500D}, {0x500F, 0x500F}, {0x5012, 0x5012}, {0x5014, 0x5014}, {0x5018, 0x501A},
+    {0x501C, 0x501C}, {0x501F, 0x501F}, {0x5021, 0x5021}, {0x5025, 0x5026}, {0x5028, 0x502A}, {0x502C, 0x502E},
+    {0x503A, 0x503A}, {0x503C, 0x503C}, {0x503E, 0x503E}, {0x5043, 0x5043}, {0x5047, 0x5048}, {0x504C, 0x504C},
+    {0x504E, 0x504F}, {0x5055, 0x5055}, {0x505A, 0x505A}, {0x505C, 0x505C}, {0x5065, 0x5065}, {0x506C, 0x506C},
+    {0x5076, 0x5077}, {0x507B, 0x507B}, {0x507E, 0x5080}, {0x5085, 0x5085}, {0x5088, 0x5088}, {0x508D, 0x508D},
+    {0x50A3, 0x50A3}, {0x50A5, 0x50A5}, {0x50A7, 0x50A9}, {0x50AC, 0x50AC}, {0x50B2, 0x50B2}, {0x50BA, 0x50BB},
+    {0x50CF, 0x50CF}, {0x50D6, 0x50D6}, {0x50DA, 0x50DA}, {0x50E6, 0x50E7}, {0x50EC, 0x50EE}, {0x50F3, 0x50F3},
+    {0x50F5, 0x50F5}, {0x50FB, 0x50FB}, {0x5106, 0x5107}, {0x510B, 0x510B}, {0x5112, 0x5112}, {0x5121, 0x5121},
+    {0x513F, 0x5141}, {0x5143, 0x5146}, {0x5148, 0x5149}, {0x514B, 0x514B}, {0x514D, 0x514D}, {0x5151, 0x5151},
+    {0x5154, 0x5156}, {0x515A, 0x515A}, {0x515C, 0x515C}, {0x5162, 0x5162}, {0x5165, 0x5165}, {0x5168, 0x5168},
+    {0x516B, 0x516E}, {0x5170, 0x5171}, {0x5173, 0x5179}, {0x517B, 0x517D}, {0x5180, 0x5182}, {0x5185, 0x5185},
+    {0x5188, 0x5189}, {0x518C, 0x518D}, {0x5192, 0x5192}, {0x5195, 0x5197}, {0x5199, 0x5199}, {0x519B, 0x519C},
+    {0x51A0, 0x51A0}, {0x51A2, 0x51A2}, {0x51A4, 0x51A5}, {0x51AB, 0x51AC}, {0x51AF, 0x51B3}, {0x51B5, 0x51B7},
+    {0x51BB, 0x51BD}, {0x51C0, 0x51C0}, {0x51C4, 0x51C4}, {0x51C6, 0x51C7}, {0x51C9, 0x51C9}, {0x51CB, 0x51CC},
+    {0x51CF, 0x51CF}, {0x51D1, 0x51D1}, {0x51DB, 0x51DB}, {0x51DD, 0x51DD}, {0x51E0, 0x51E1}, {0x51E4, 0x51E4},
+    {0x51EB, 0x51EB}, {0x51ED, 0x51ED}, {0x51EF, 0x51F0}, {0x51F3, 0x51F3}, {0x51F5, 0x51F6}, {0x51F8, 0x51FD},
+    {0x51FF, 0x5203}, {0x5206, 0x5208}, {0x520A, 0x520A}, {0x520D, 0x520E}, {0x5211, 0x5212}, {0x5216, 0x521B},
+    {0x521D, 0x521D}, {0x5220, 0x5220}, {0x5224, 0x5224}, {0x5228, 0x5229}, {0x522B, 0x522B}, {0x522D, 0x522E},
+    {0x5230, 0x5230}, {0x5233, 0x5233}, {0x5236, 0x523B}, {0x523D, 0x523D}, {0x523F, 0x5243}, {0x524A, 0x524A},
+    {0x524C, 0x524D}, {0x5250, 0x5251}, {0x5254, 0x5254}, {0x5256, 0x5256}, {0x525C, 0x525C}, {0x525E, 0x525E},
+    {0x5261, 0x5261}, {0x5265, 0x5265}, {0x5267, 0x5267}, {0x5269, 0x526A}, {0x526F, 0x526F}, {0x5272, 0x5272},
+    {0x527D, 0x527D}, {0x527F, 0x527F}, {0x5281, 0x5282}, {0x5288, 0x5288}, {0x5290, 0x5290}, {0x5293, 0x5293},
+    {0x529B, 0x529B}, {0x529D, 0x52A3}, {0x52A8, 0x52AD}, {0x52B1, 0x52B3}, {0x52BE, 0x52BF}, {0x52C3, 0x52C3},
+    {0x52C7, 0x52C7}, {0x52C9, 0x52C9}, {0x52CB, 0x52CB}, {0x52D0, 0x52D0}, {0x52D2, 0x52D2}, {0x52D6, 0x52D6},
+    {0x52D8, 0x52D8}, {0x52DF, 0x52DF}, {0x52E4, 0x52E4}, {0x52F0, 0x52F0}, {0x52F9, 0x52FA}, {0x52FE, 0x5300},
+    {0x5305, 0x5306}, {0x5308, 0x5308}, {0x530D, 0x530D}, {0x530F, 0x5310}, {0x5315, 0x5317}, {0x5319, 0x531A},
+    {0x531D, 0x531D}, {0x5320, 0x5321}, {0x5323, 0x5323}, {0x5326, 0x5326}, {0x532A, 0x532A}, {0x532E, 0x532E},
+    {0x5339, 0x533B}, {0x533E, 0x533F}, {0x5341, 0x5341}, {0x5343, 0x5343}, {0x5345, 0x5345}, {0x5347, 0x534A},
+    {0x534E, 0x534F}, {0x5351, 0x5353}, {0x5355, 0x5357}, {0x535A, 0x535A}, {0x535C, 0x535C}, {0x535E, 0x5364},
+    {0x5366, 0x5367}, {0x5369, 0x5369}, {0x536B, 0x536B}, {0x536E, 0x5371}, {0x5373, 0x5375}, {0x5377, 0x5378},
+    {0x537A, 0x537A}, {0x537F, 0x537F}, {0x5382, 0x5382}, {0x5384, 0x5386}, {0x5389, 0x5389}, {0x538B, 0x538D},
+    {0x5395, 0x5395}, {0x5398, 0x5398}, {0x539A, 0x539A}, {0x539D, 0x539D}, {0x539F, 0x539F}, {0x53A2, 0x53A3},
+    {0x53A5, 0x53A6}, {0x53A8, 0x53A9}, {0x53AE, 0x53AE}, {0x53B6, 0x53B6}, {0x53BB, 0x53BB}, {0x53BF, 0x53BF},
+    {0x53C1, 0x53C2}, {0x53C8, 0x53CD}, {0x53D1, 0x53D1}, {0x53D4, 0x53D4}, {0x53D6, 0x53D9}, {0x53DB, 0x53DB},
+    {0x53DF, 0x53E0}, {0x53E3, 0x53E6}, {0x53E8, 0x53F3}, {0x53F5, 0x53F9}, {0x53FB, 0x53FD}, {0x5401, 0x5401},
+    {0x5403, 0x5404}, {0x5406, 0x5406}, {0x5408, 0x540A}, {0x540C, 0x5413}, {0x5415, 0x5417}, {0x541B, 0x541B},
+    {0x541D, 0x5421}, {0x5423, 0x5423}, {0x5426, 0x5429}, {0x542B, 0x542F}, {0x5431, 0x5432}, {0x5434, 0x5435},
+    {0x5438, 0x5439}, {0x543B, 0x543C}, {0x543E, 0x543E}, {0x5440, 0x5440}, {0x5443, 0x5443}, {0x5446, 0x5446},
+    {0x5448, 0x5448}, {0x544A, 0x544B}, {0x5450, 0x5450}, {0x5452, 0x5459}, {0x545B, 0x545C}, {0x5462, 0x5462},
+    {0x5464, 0x5464}, {0x5466, 0x5466}, {0x5468, 0x5468}, {0x5471, 0x5473}, {0x5475, 0x5478}, {0x547B, 0x547D},
+    {0x5480, 0x5480}, {0x5482, 0x5482}, {0x5484, 0x5484}, {0x5486, 0x5486}, {0x548B, 0x548C}, {0x548E, 0x5490},
+    {0x5492, 0x5492}, {0x5494, 0x5496}, {0x5499, 0x549B}, {0x549D, 0x549D}, {0x54A3, 0x54A4}, {0x54A6, 0x54AD},
+    {0x54AF, 0x54AF}, {0x54B1, 0x54B1}, {0x54B3, 0x54B4}, {0x54B8, 0x54B8}, {0x54BB, 0x54BB}, {0x54BD, 0x54BD},
+    {0x54BF, 0x54C2}, {0x54C4, 0x54C4}, {0x54C6, 0x54C9}, {0x54CC, 0x54D5}, {0x54D7, 0x54D7}, {0x54D9, 0x54DA},
+    {0x54DC, 0x54DF}, {0x54E5, 0x54EA}, {0x54ED, 0x54EE}, {0x54F2, 0x54F3}, {0x54FA, 0x54FA}, {0x54FC, 0x54FD},
+    {0x54FF, 0x54FF}, {0x5501, 0x5501}, {0x5506, 0x5507}, {0x5509, 0x5509}, {0x550F, 0x5511}, {0x5514, 0x5514},
+    {0x551B, 0x551B}, {0x5520, 0x5520}, {0x5522, 0x5524}, {0x5527, 0x5527}, {0x552A, 0x552A}, {0x552C, 0x552C},
+    {0x552E, 0x5531}, {0x5533, 0x5533}, {0x5537, 0x5537}, {0x553C, 0x553C}, {0x553E, 0x553F}, {0x5541, 0x5541},
+    {0x5543, 0x5544}, {0x5546, 0x5546}, {0x5549, 0x554A}, {0x5550, 0x5550}, {0x5555, 0x5556}, {0x555C, 0x555C},
+    {0x5561, 0x5561}, {0x5564, 0x5567}, {0x556A, 0x556A}, {0x556C, 0x556E}, {0x5575, 0x5578}, {0x557B, 0x557C},
+    {0x557E, 0x557E}, {0x5580, 0x5584}, {0x5587, 0x558B}, {0x558F, 0x558F}, {0x5591, 0x5591}, {0x5594, 0x5594},
+    {0x5598, 0x5599}, {0x559C, 0x559D}, {0x559F, 0x559F}, {0x55A7, 0x55A7}, {0x55B1, 0x55B1}, {0x55B3, 0x55B3},
+    {0x55B5, 0x55B5}, {0x55B7, 0x55B7}, {0x55B9, 0x55B9}, {0x55BB, 0x55BB}, {0x55BD, 0x55BE}, {0x55C4, 0x55C5},
+    {0x55C9, 0x55C9}, {0x55CC, 0x55CD}, {0x55D1, 0x55D4}, {0x55D6, 0x55D6}, {0x55DC, 0x55DD}, {0x55DF, 0x55DF},
+    {0x55E1, 0x55E1}, {0x55E3, 0x55E6}, {0x55E8, 0x55E8}, {0x55EA, 0x55EC}, {0x55EF, 0x55EF}, {0x55F2, 0x55F3},
+    {0x55F5, 0x55F5}, {0x55F7, 0x55F7}, {0x55FD, 0x55FE}, {0x5600, 0x5601}, {0x5608, 0x5609}, {0x560C, 0x560C},
+    {0x560E, 0x560F}, {0x5618, 0x5618}, {0x561B, 0x561B}, {0x561E, 0x561F}, {0x5623, 0x5624}, {0x5627, 0x5627},
+    {0x562C, 0x562D}, {0x5631, 0x5632}, {0x5634, 0x5634}, {0x5636, 0x5636}, {0x5639, 0x5639}, {0x563B, 0x563B},
+    {0x563F, 0x563F}, {0x564C, 0x564E}, {0x5654, 0x5654}, {0x5657, 0x5659}, {0x565C, 0x565C}, {0x5662, 0x5662},
+    {0x5664, 0x5664}, {0x5668, 0x566C}, {0x5671, 0x5671}, {0x5676, 0x5676}, {0x567B, 0x567C}, {0x5685, 0x5686},
+    {0x568E, 0x568F}, {0x5693, 0x5693}, {0x56A3, 0x56A3}, {0x56AF, 0x56AF}, {0x56B7, 0x56B7}, {0x56BC, 0x56BC},
+    {0x56CA, 0x56CA}, {0x56D4, 0x56D4}, {0x56D7, 0x56D7}, {0x56DA, 0x56DB}, {0x56DD, 0x56E2}, {0x56E4, 0x56E4},
+    {0x56EB, 0x56EB}, {0x56ED, 0x56ED}, {0x56F0, 0x56F1}, {0x56F4, 0x56F5}, {0x56F9, 0x56FA}, {0x56FD, 0x56FF},
+    {0x5703, 0x5704}, {0x5706, 0x5706}, {0x5708, 0x570A}, {0x571C, 0x571C}, {0x571F, 0x571F}, {0x5723, 0x5723},
+    {0x5728, 0x572A}, {0x572C, 0x5730}, {0x5733, 0x5733}, {0x5739, 0x573B}, {0x573E, 0x573E}, {0x5740, 0x5740},
+    {0x5742, 0x5742}, {0x5747, 0x5747}, {0x574A, 0x574A}, {0x574C, 0x5751}, {0x5757, 0x5757}, {0x575A, 0x5761},
+    {0x5764, 0x5764}, {0x5766, 0x5766}, {0x5768, 0x576B}, {0x576D, 0x576D}, {0x576F, 0x576F}, {0x5773, 0x5773},
+    {0x5776, 0x5777}, {0x577B, 0x577C}, {0x5782, 0x5786}, {0x578B, 0x578C}, {0x5792, 0x5793}, {0x579B, 0x579B},
+    {0x57A0, 0x57A4}, {0x57A6, 0x57A7}, {0x57A9, 0x57A9}, {0x57AB, 0x57AB}, {0x57AD, 0x57AE}, {0x57B2, 0x57B2},
+    {0x57B4, 0x57B4}, {0x57B8, 0x57B8}, {0x57C2, 0x57C3}, {0x57CB, 0x57CB}, {0x57CE, 0x57CF}, {0x57D2, 0x57D2},
+    {0x57D4, 0x57D5}, {0x57D8, 0x57DA}, {0x57DD, 0x57DD}, {0x57DF, 0x57E0}, {0x57E4, 0x57E4}, {0x57ED, 0x57ED},
+    {0x57EF, 0x57EF}, {0x57F4, 0x57F4}, {0x57F8, 0x57FA}, {0x57FD, 0x57FD}, {0x5800, 0x5800}, {0x5802, 0x5802},
+    {0x5806, 0x5807}, {0x580B, 0x580B}, {0x580D, 0x580D}, {0x5811, 0x5811}, {0x5815, 0x5815}, {0x5819, 0x5819},
+    {0x581E, 0x581E}, {0x5820, 0x5821}, {0x5824, 0x5824}, {0x582A, 0x582A}, {0x5830, 0x5830}, {0x5835, 0x5835},
+    {0x5844, 0x5844}, {0x584C, 0x584D}, {0x5851, 0x5851}, {0x5854, 0x5854}, {0x5858, 0x5858}, {0x585E, 0x585E},
+    {0x5865, 0x5865}, {0x586B, 0x586C}, {0x587E, 0x587E}, {0x5880, 0x5881}, {0x5883, 0x5883}, {0x5885, 0x5885},
+    {0x5889, 0x5889}, {0x5892, 0x5893}, {0x5899, 0x589A}, {0x589E, 0x589F}, {0x58A8, 0x58A9}, {0x58BC, 0x58BC},
+    {0x58C1, 0x58C1}, {0x58C5, 0x58C5}, {0x58D1, 0x58D1}, {0x58D5, 0x58D5}, {0x58E4, 0x58E4}, {0x58EB, 0x58EC},
+    {0x58EE, 0x58EE}, {0x58F0, 0x58F0}, {0x58F3, 0x58F3}, {0x58F6, 0x58F6}, {0x58F9, 0x58F9}, {0x5902, 0x5902},
+    {0x5904, 0x5904}, {0x5907, 0x5907}, {0x590D, 0x590D}, {0x590F, 0x590F}, {0x5914, 0x5916}, {0x5919, 0x591A},
+    {0x591C, 0x591C}, {0x591F, 0x591F}, {0x5924, 0x5925}, {0x5927, 0x5927}, {0x5929, 0x592B}, {0x592D, 0x592F},
+    {0x5931, 0x5931}, {0x5934, 0x5934}, {0x5937, 0x593A}, {0x593C, 0x593C}, {0x5941, 0x5942}, {0x5944, 0x5944},
+    {0x5947, 0x5949}, {0x594B, 0x594B}, {0x594E, 0x594F}, {0x5951, 0x5951}, {0x5954, 0x5958}, {0x595A, 0x595A},
+    {0x5960, 0x5960}, {0x5962, 0x5962}, {0x5965, 0x5965}, {0x5973, 0x5974}, {0x5976, 0x5976}, {0x5978, 0x5979},
+    {0x597D, 0x597D}, {0x5981, 0x5984}, {0x5986, 0x5988}, {0x598A, 0x598A}, {0x598D, 0x598D}, {0x5992, 0x5993},
+    {0x5996, 0x5997}, {0x5999, 0x5999}, {0x599E, 0x599E}, {0x59A3, 0x59A5}, {0x59A8, 0x59AB}, {0x59AE, 0x59AF},
+    {0x59B2, 0x59B2}, {0x59B9, 0x59B9}, {0x59BB, 0x59BB}, {0x59BE, 0x59BE}, {0x59C6, 0x59C6}, {0x59CA, 0x59CB},
+    {0x59D0, 0x59D4}, {0x59D7, 0x59D8}, {0x59DA, 0x59DA}, {0x59DC, 0x59DD}, {0x59E3, 0x59E3}, {0x59E5, 0x59E5},
+    {0x59E8, 0x59E8}, {0x59EC, 0x59EC}, {0x59F9, 0x59F9}, {0x59FB, 0x59FB}, {0x59FF, 0x59FF}, {0x5A01, 0x5A01},
+    {0x5A03, 0x5A09}, {0x5A0C, 0x5A0C}, {0x5A11, 0x5A11}, {0x5A13, 0x5A13}, {0x5A18, 0x5A18}, {0x5A1C, 0x5A1C},
+    {0x5A1F, 0x5A20}, {0x5A23, 0x5A23}, {0x5A25, 0x5A25}, {0x5A29, 0x5A29}, {0x5A31, 0x5A32}, {0x5A34, 0x5A34},
+    {0x5A36, 0x5A36}, {0x5A3C, 0x5A3C}, {0x5A40, 0x5A40}, {0x5A46, 0x5A46}, {0x5A49, 0x5A4A}, {0x5A55, 0x5A55},
+    {0x5A5A, 0x5A5A}, {0x5A62, 0x5A62}, {0x5A67, 0x5A67}, {0x5A6A, 0x5A6A}, {0x5A74, 0x5A77}, {0x5A7A, 0x5A7A},
+    {0x5A7F, 0x5A7F}, {0x5A92, 0x5A92}, {0x5A9A, 0x5A9B}, {0x5AAA, 0x5AAA}, {0x5AB2, 0x5AB3}, {0x5AB5, 0x5AB5},
+    {0x5AB8, 0x5AB8}, {0x5ABE, 0x5ABE}, {0x5AC1, 0x5AC2}, {0x5AC9, 0x5AC9}, {0x5ACC, 0x5ACC}, {0x5AD2, 0x5AD2},
+    {0x5AD4, 0x5AD4}, {0x5AD6, 0x5AD6}, {0x5AD8, 0x5AD8}, {0x5ADC, 0x5ADC}, {0x5AE0, 0x5AE1}, {0x5AE3, 0x5AE3},
+    {0x5AE6, 0x5AE6}, {0x5AE9, 0x5AE9}, {0x5AEB, 0x5AEB}, {0x5AF1, 0x5AF1}, {0x5B09, 0x5B09}, {0x5B16, 0x5B17},
+    {0x5B32, 0x5B32}, {0x5B34, 0x5B34}, {0x5B37, 0x5B37}, {0x5B40, 0x5B40}, {0x5B50, 0x5B51}, {0x5B53, 0x5B55},
+    {0x5B57, 0x5B5D}, {0x5B5F, 0x5B5F}, {0x5B62, 0x5B66}, {0x5B69, 0x5B6A}, {0x5B6C, 0x5B6C}, {0x5B70, 0x5B71},
+    {0x5B73, 0x5B73}, {0x5B75, 0x5B75}, {0x5B7A, 0x5B7A}, {0x5B7D, 0x5B7D}, {0x5B80, 0x5B81}, {0x5B83, 0x5B85},
+    {0x5B87, 0x5B89}, {0x5B8B, 0x5B8C}, {0x5B8F, 0x5B8F}, {0x5B93, 0x5B93}, {0x5B95, 0x5B95}, {0x5B97, 0x5B9E},
+    {0x5BA0, 0x5BA6}, {0x5BAA, 0x5BAB}, {0x5BB0, 0x5BB0}, {0x5BB3, 0x5BB6}, {0x5BB8, 0x5BB9}, {0x5BBD, 0x5BBF},
+    {0x5BC2, 0x5BC2}, {0x5BC4, 0x5BC7}, {0x5BCC, 0x5BCC}, {0x5BD0, 0x5BD0}, {0x5BD2, 0x5BD3}, {0x5BDD, 0x5BDF},
+    {0x5BE1, 0x5BE1}, {0x5BE4, 0x5BE5}, {0x5BE8, 0x5BE8}, {0x5BEE, 0x5BEE}, {0x5BF0, 0x5BF0}, {0x5BF8, 0x5BFC},
+    {0x5BFF, 0x5BFF}, {0x5C01, 0x5C01}, {0x5C04, 0x5C04}, {0x5C06, 0x5C06}, {0x5C09, 0x5C0A}, {0x5C0F, 0x5C0F},
+    {0x5C11, 0x5C11}, {0x5C14, 0x5C16}, {0x5C18, 0x5C18}, {0x5C1A, 0x5C1A}, {0x5C1C, 0x5C1D}, {0x5C22, 0x5C22},
+    {0x5C24, 0x5C25}, {0x5C27, 0x5C27}, {0x5C2C, 0x5C2C}, {0x5C31, 0x5C31}, {0x5C34, 0x5C34}, {0x5C38, 0x5C42},
+    {0x5C45, 0x5C45}, {0x5C48, 0x5C4B}, {0x5C4E, 0x5C51}, {0x5C55, 0x5C55}, {0x5C59, 0x5C59}, {0x5C5E, 0x5C5E},
+    {0x5C60, 0x5C61}, {0x5C63, 0x5C63}, {0x5C65, 0x5C66}, {0x5C6E, 0x5C6F}, {0x5C71, 0x5C71}, {0x5C79, 0x5C7A},
+    {0x5C7F, 0x5C7F}, {0x5C81, 0x5C82}, {0x5C88, 0x5C88}, {0x5C8C, 0x5C8D}, {0x5C90, 0x5C91}, {0x5C94, 0x5C94},
+    {0x5C96, 0x5C9C}, {0x5CA2, 0x5CA3}, {0x5CA9, 0x5CA9}, {0x5CAB, 0x5CAD}, {0x5CB1, 0x5CB1}, {0x5CB3, 0x5CB3},
+    {0x5CB5, 0x5CB5}, {0x5CB7, 0x5CB8}, {0x5CBD, 0x5CBD}, {0x5CBF, 0x5CBF}, {0x5CC1, 0x5CC1}, {0x5CC4, 0x5CC4},
+    {0x5CCB, 0x5CCB}, {0x5CD2, 0x5CD2}, {0x5CD9, 0x5CD9}, {0x5CE1, 0x5CE1}, {0x5CE4, 0x5CE6}, {0x5CE8, 0x5CE8},
+    {0x5CEA, 0x5CEA}, {0x5CED, 0x5CED}, {0x5CF0, 0x5CF0}, {0x5CFB, 0x5CFB}, {0x5D02, 0x5D03}, {0x5D06, 0x5D07},
+    {0x5D0E, 0x5D0E}, {0x5D14, 0x5D14}, {0x5D16, 0x5D16}, {0x5D1B, 0x5D1B}, {0x5D1E, 0x5D1E}, {0x5D24, 0x5D24},
+    {0x5D26, 0x5D27}, {0x5D29, 0x5D29}, {0x5D2D, 0x5D2E}, {0x5D34, 0x5D34}, {0x5D3D, 0x5D3E}, {0x5D47, 0x5D47},
+    {0x5D4A, 0x5D4C}, {0x5D58, 0x5D58}, {0x5D5B, 0x5D5B}, {0x5D5D, 0x5D5D}, {0x5D69, 0x5D69}, {0x5D6B, 0x5D6C},
+    {0x5D6F, 0x5D6F}, {0x5D74, 0x5D74}, {0x5D82, 0x5D82}, {0x5D99, 0x5D99}, {0x5D9D, 0x5D9D}, {0x5DB7, 0x5DB7},
+    {0x5DC5, 0x5DC5}, {0x5DCD, 0x5DCD}, {0x5DDB, 0x5DDB}, {0x5DDD, 0x5DDE}, {0x5DE1, 0x5DE2}, {0x5DE5, 0x5DE9},
+    {0x5DEB, 0x5DEB}, {0x5DEE, 0x5DEF}, {0x5DF1, 0x5DF4}, {0x5DF7, 0x5DF7}, {0x5DFD, 0x5DFE}, {0x5E01, 0x5E03},
+    {0x5E05, 0x5E06}, {0x5E08, 0x5E08}, {0x5E0C, 0x5E0C}, {0x5E0F, 0x5E11}, {0x5E14, 0x5E16}, {0x5E18, 0x5E1D},
+    {0x5E26, 0x5E27}, {0x5E2D, 0x5E2E}, {0x5E31, 0x5E31}, {0x5E37, 0x5E38}, {0x5E3B, 0x5E3D}, {0x5E42, 0x5E42},
+    {0x5E44, 0x5E45}, {0x5E4C, 0x5E4C}, {0x5E54, 0x5E55}, {0x5E5B, 0x5E5B}, {0x5E5E, 0x5E5E}, {0x5E61, 0x5E62},
+    {0x5E72, 0x5E74}, {0x5E76, 0x5E76}, {0x5E78, 0x5E78}, {0x5E7A, 0x5E7D}, {0x5E7F, 0x5E80}, {0x5E84, 0x5E84},
+    {0x5E86, 0x5E87}, {0x5E8A, 0x5E8B}, {0x5E8F, 0x5E91}, {0x5E93, 0x5E97}, {0x5E99, 0x5E9A}, {0x5E9C, 0x5E9C},
+    {0x5E9E, 0x5EA0}, {0x5EA5, 0x5EA7}, {0x5EAD, 0x5EAD}, {0x5EB3, 0x5EB3}, {0x5EB5, 0x5EB9}, {0x5EBE, 0x5EBE},
+    {0x5EC9, 0x5ECA}, {0x5ED1, 0x5ED3}, {0x5ED6, 0x5ED6}, {0x5EDB, 0x5EDB}, {0x5EE8, 0x5EE8}, {0x5EEA, 0x5EEA},
+    {0x5EF4, 0x5EF4}, {0x5EF6, 0x5EF7}, {0x5EFA, 0x5EFA}, {0x5EFE, 0x5F04}, {0x5F08, 0x5F08}, {0x5F0A, 0x5F0B},
+    {0x5F0F, 0x5F0F}, {0x5F11, 0x5F11}, {0x5F13, 0x5F13}, {0x5F15, 0x5F15}, {0x5F17, 0x5F18}, {0x5F1B, 0x5F1B},
+    {0x5F1F, 0x5F20}, {0x5F25, 0x5F27}, {0x5F29, 0x5F2A}, {0x5F2D, 0x5F2D}, {0x5F2F, 0x5F2F}, {0x5F31, 0x5F31},
+    {0x5F39, 0x5F3A}, {0x5F3C, 0x5F3C}, {0x5F40, 0x5F40}, {0x5F50, 0x5F50}, {0x5F52, 0x5F53}, {0x5F55, 0x5F58},
+    {0x5F5D, 0x5F5D}, {0x5F61, 0x5F62}, {0x5F64, 0x5F64}, {0x5F66, 0x5F66}, {0x5F69, 0x5F6A}, {0x5F6C, 0x5F6D},
+    {0x5F70, 0x5F71}, {0x5F73, 0x5F73}, {0x5F77, 0x5F77}, {0x5F79, 0x5F79}, {0x5F7B, 0x5F7C}, {0x5F80, 0x5F82},
+    {0x5F84, 0x5F85}, {0x5F87, 0x5F8C}, {0x5F90, 0x5F90}, {0x5F92, 0x5F92}, {0x5F95, 0x5F95}, {0x5F97, 0x5F99},
+    {0x5F9C, 0x5F9C}, {0x5FA1, 0x5FA1}, {0x5FA8, 0x5FA8}, {0x5FAA, 0x5FAA}, {0x5FAD, 0x5FAE}, {0x5FB5, 0x5FB5},
+    {0x5FB7, 0x5FB7}, {0x5FBC, 0x5FBD}, {0x5FC3, 0x5FC6}, {0x5FC9, 0x5FC9}, {0x5FCC, 0x5FCD}, {0x5FCF, 0x5FD2},
+    {0x5FD6, 0x5FD9}, {0x5FDD, 0x5FDD}, {0x5FE0, 0x5FE1}, {0x5FE4, 0x5FE4}, {0x5FE7, 0x5FE7}, {0x5FEA, 0x5FEB},
+    {0x5FED, 0x5FEE}, {0x5FF1, 0x5FF1}, {0x5FF5, 0x5FF5}, {0x5FF8, 0x5FF8}, {0x5FFB, 0x5FFB}, {0x5FFD, 0x6006},
+    {0x600A, 0x600A}, {0x600D, 0x600F}, {0x6012, 0x6012}, {0x6014, 0x6016}, {0x6019, 0x6019}, {0x601B, 0x601D},
+    {0x6020, 0x6021}, {0x6025, 0x602B}, {0x602F, 0x602F}, {0x6035, 0x6035}, {0x603B, 0x603C}, {0x603F, 0x603F},
+    {0x6041, 0x6043}, {0x604B, 0x604B}, {0x604D, 0x604D}, {0x6050, 0x6050}, {0x6052, 0x6052}, {0x6055, 0x6055},
+    {0x6059, 0x605A}, {0x605D, 0x605D}, {0x6062, 0x6064}, {0x6067, 0x606D}, {0x606F, 0x6070}, {0x6073, 0x6073},
+    {0x6076, 0x6076}, {0x6078, 0x607D}, {0x607F, 0x607F}, {0x6083, 0x6084}, {0x6089, 0x6089}, {0x608C, 0x608D},
+    {0x6092, 0x6092}, {0x6094, 0x6094}, {0x6096, 0x6096}, {0x609A, 0x609B}, {0x609D, 0x609D}, {0x609F, 0x60A0},
+    {0x60A3, 0x60A3}, {0x60A6, 0x60A6}, {0x60A8, 0x60A8}, {0x60AB, 0x60AD}, {0x60AF, 0x60AF}, {0x60B1, 0x60B2},
+    {0x60B4, 0x60B4}, {0x60B8, 0x60B8}, {0x60BB, 0x60BC}, {0x60C5, 0x60C6}, {0x60CA, 0x60CB}, {0x60D1, 0x60D1},
+    {0x60D5, 0x60D5}, {0x60D8, 0x60D8}, {0x60DA, 0x60DA}, {0x60DC, 0x60DD}, {0x60DF, 0x60E0}, {0x60E6, 0x60E9},
+    {0x60EB, 0x60F0}, {0x60F3, 0x60F4}, {0x60F6, 0x60F6}, {0x60F9, 0x60FA}, {0x6100, 0x6101}, {0x6106, 0x6106},
+    {0x6108, 0x6109}, {0x610D, 0x610F}, {0x6115, 0x6115}, {0x611A, 0x611A}, {0x611F, 0x6120}, {0x6123, 0x6124},
+    {0x6126, 0x6127}, {0x612B, 0x612B}, {0x613F, 0x613F}, {0x6148, 0x6148}, {0x614A, 0x614A}, {0x614C, 0x614C},
+    {0x614E, 0x614E}, {0x6151, 0x6151}, {0x6155, 0x6155}, {0x615D, 0x615D}, {0x6162, 0x6162}, {0x6167, 0x6168},
+    {0x6170, 0x6170}, {0x6175, 0x6175}, {0x6177, 0x6177}, {0x618B, 0x618B}, {0x618E, 0x618E}, {0x6194, 0x6194},
+    {0x619D, 0x619D}, {0x61A7, 0x61A9}, {0x61AC, 0x61AC}, {0x61B7, 0x61B7}, {0x61BE, 0x61BE}, {0x61C2, 0x61C2},
+    {0x61C8, 0x61C8}, {0x61CA, 0x61CB}, {0x61D1, 0x61D2}, {0x61D4, 0x61D4}, {0x61E6, 0x61E6}, {0x61F5, 0x61F5},
+    {0x61FF, 0x61FF}, {0x6206, 0x6206}, {0x6208, 0x6208}, {0x620A, 0x6212}, {0x6215, 0x6218}, {0x621A, 0x621B},
+    {0x621F, 0x621F}, {0x6221, 0x6222}, {0x6224, 0x6225}, {0x622A, 0x622A}, {0x622C, 0x622C}, {0x622E, 0x622E},
+    {0x6233, 0x6234}, {0x6237, 0x6237}, {0x623D, 0x6241}, {0x6243, 0x6243}, {0x6247, 0x6249}, {0x624B, 0x624E},
+    {0x6251, 0x6254}, {0x6258, 0x6258}, {0x625B, 0x625B}, {0x6263, 0x6263}, {0x6266, 0x6267}, {0x6269, 0x6270},
+    {0x6273, 0x6273}, {0x6276, 0x6276}, {0x6279, 0x6279}, {0x627C, 0x627C}, {0x627E, 0x6280}, {0x6284, 0x6284},
+    {0x6289, 0x628A}, {0x6291, 0x6293}, {0x6295, 0x6298}, {0x629A, 0x629B}, {0x629F, 0x62A2}, {0x62A4, 0x62A5},
+    {0x62A8, 0x62A8}, {0x62AB, 0x62AC}, {0x62B1, 0x62B1}, {0x62B5, 0x62B5}, {0x62B9, 0x62B9}, {0x62BB, 0x62BD},
+    {0x62BF, 0x62BF}, {0x62C2, 0x62C2}, {0x62C4, 0x62CA}, {0x62CC, 0x62CE}, {0x62D0, 0x62D0}, {0x62D2, 0x62D4},
+    {0x62D6, 0x62DC}, {0x62DF, 0x62DF}, {0x62E2, 0x62E3}, {0x62E5, 0x62E9}, {0x62EC, 0x62EF}, {0x62F1, 0x62F1},
+    {0x62F3, 0x62F4}, {0x62F6, 0x62F7}, {0x62FC, 0x62FF}, {0x6301, 0x6302}, {0x6307, 0x6309}, {0x630E, 0x630E},
+    {0x6311, 0x6311}, {0x6316, 0x6316}, {0x631A, 0x631B}, {0x631D, 0x6325}, {0x6328, 0x6328}, {0x632A, 0x632B},
+    {0x632F, 0x632F}, {0x6332, 0x6332}, {0x6339, 0x633A}, {0x633D, 0x633D}, {0x6342, 0x6343}, {0x6345, 0x6346},
+    {0x6349, 0x6349}, {0x634B, 0x6350}, {0x6355, 0x6355}, {0x635E, 0x635F}, {0x6361, 0x6363}, {0x6367, 0x6367},
+    {0x6369, 0x6369}, {0x636D, 0x636E}, {0x6371, 0x6371}, {0x6376, 0x6377}, {0x637A, 0x637B}, {0x6380, 0x6380},
+    {0x6382, 0x6382}, {0x6387, 0x638A}, {0x638C, 0x638C}, {0x638E, 0x6390}, {0x6392, 0x6392}, {0x6396, 0x6396},
+    {0x6398, 0x6398}, {0x63A0, 0x63A0}, {0x63A2, 0x63A3}, {0x63A5, 0x63A5}, {0x63A7, 0x63AA}, {0x63AC, 0x63AE},
+    {0x63B0, 0x63B0}, {0x63B3, 0x63B4}, {0x63B7, 0x63B8}, {0x63BA, 0x63BA}, {0x63BC, 0x63BC}, {0x63BE, 0x63BE},
+    {0x63C4, 0x63C4}, {0x63C6, 0x63C6}, {0x63C9, 0x63C9}, {0x63CD, 0x63D0}, {0x63D2, 0x63D2}, {0x63D6, 0x63D6},
+    {0x63DE, 0x63DE}, {0x63E0, 0x63E1}, {0x63E3, 0x63E3}, {0x63E9, 0x63EA}, {0x63ED, 0x63ED}, {0x63F2, 0x63F2},
+    {0x63F4, 0x63F4}, {0x63F6, 0x63F6}, {0x63F8, 0x63F8}, {0x63FD, 0x63FD}, {0x63FF, 0x6402}, {0x6405, 0x6405},
+    {0x640B, 0x640C}, {0x640F, 0x6410}, {0x6413, 0x6414}, {0x641B, 0x641C}, {0x641E, 0x641E}, {0x6420, 0x6421},
+    {0x6426, 0x6426}, {0x642A, 0x642A}, {0x642C, 0x642D}, {0x6434, 0x6434}, {0x643A, 0x643A}, {0x643D, 0x643D},
+    {0x643F, 0x643F}, {0x6441, 0x6441}, {0x6444, 0x6448}, {0x644A, 0x644A}, {0x6452, 0x6452}, {0x6454, 0x6454},
+    {0x6458, 0x6458}, {0x645E, 0x645E}, {0x6467, 0x6467}, {0x6469, 0x6469}, {0x646D, 0x646D}, {0x6478, 0x647A},
+    {0x6482, 0x6482}, {0x6484, 0x6485}, {0x6487, 0x6487}, {0x6491, 0x6492}, {0x6495, 0x6496}, {0x6499, 0x6499},
+    {0x649E, 0x649E}, {0x64A4, 0x64A4}, {0x64A9, 0x64A9}, {0x64AC, 0x64AE}, {0x64B0, 0x64B0}, {0x64B5, 0x64B5},
+    {0x64B7, 0x64B8}, {0x64BA, 0x64BA}, {0x64BC, 0x64BC}, {0x64C0, 0x64C0}, {0x64C2, 0x64C2}, {0x64C5, 0x64C5},
+    {0x64CD, 0x64CE}, {0x64D0, 0x64D0}, {0x64D2, 0x64D2}, {0x64D7, 0x64D8}, {0x64DE, 0x64DE}, {0x64E2, 0x64E2},
+    {0x64E4, 0x64E4}, {0x64E6, 0x64E6}, {0x6500, 0x6500}, {0x6509, 0x6509}, {0x6512, 0x6512}, {0x6518, 0x6518},
+    {0x6525, 0x6525}, {0x652B, 0x652B}, {0x652E, 0x652F}, {0x6534, 0x6536}, {0x6538, 0x6539}, {0x653B, 0x653B},
+    {0x653E, 0x653F}, {0x6545, 0x6545}, {0x6548, 0x6549}, {0x654C, 0x654C}, {0x654F, 0x654F}, {0x6551, 0x6551},
+    {0x6555, 0x6556}, {0x6559, 0x6559}, {0x655B, 0x655B}, {0x655D, 0x655E}, {0x6562, 0x6563}, {0x6566, 0x6566},
+    {0x656B, 0x656C}, {0x6570, 0x6570}, {0x6572, 0x6572}, {0x6574, 0x6574}, {0x6577, 0x6577}, {0x6587, 0x6587},
+    {0x658B, 0x658C}, {0x6590, 0x6591}, {0x6593, 0x6593}, {0x6597, 0x6597}, {0x6599, 0x6599}, {0x659B, 0x659C},
+    {0x659F, 0x659F}, {0x65A1, 0x65A1}, {0x65A4, 0x65A5}, {0x65A7, 0x65A7}, {0x65A9, 0x65A9}, {0x65AB, 0x65AB},
+    {0x65AD, 0x65AD}, {0x65AF, 0x65B0}, {0x65B9, 0x65B9}, {0x65BC, 0x65BD}, {0x65C1, 0x65C1}, {0x65C3, 0x65C6},
+    {0x65CB, 0x65CC}, {0x65CE, 0x65CF}, {0x65D2, 0x65D2}, {0x65D6, 0x65D7}, {0x65E0, 0x65E0}, {0x65E2, 0x65E2},
+    {0x65E5, 0x65E9}, {0x65EC, 0x65F1}, {0x65F6, 0x65F7}, {0x65FA, 0x65FA}, {0x6600, 0x6600}, {0x6602, 0x6603},
+    {0x6606, 0x6606}, {0x660A, 0x660A}, {0x660C, 0x660C}, {0x660E, 0x660F}, {0x6613, 0x6615}, {0x6619, 0x6619},
+    {0x661D, 0x661D}, {0x661F, 0x6620}, {0x6625, 0x6625}, {0x6627, 0x6628}, {0x662D, 0x662D}, {0x662F, 0x662F},
+    {0x6631, 0x6631}, {0x6634, 0x6636}, {0x663C, 0x663C}, {0x663E, 0x663E}, {0x6641, 0x6641}, {0x6643, 0x6643},
+    {0x664B, 0x664C}, {0x664F, 0x664F}, {0x6652, 0x6657}, {0x665A, 0x665A}, {0x665F, 0x665F}, {0x6661, 0x6661},
+    {0x6664, 0x6664}, {0x6666, 0x6666}, {0x6668, 0x6668}, {0x666E, 0x6670}, {0x6674, 0x6674}, {0x6676, 0x6677},
+    {0x667A, 0x667A}, {0x667E, 0x667E}, {0x6682, 0x6682}, {0x6684, 0x6684}, {0x6687, 0x6687}, {0x668C, 0x668C},
+    {0x6691, 0x6691}, {0x6696, 0x6697}, {0x669D, 0x669D}, {0x66A7, 0x66A8}, {0x66AE, 0x66AE}, {0x66B4, 0x66B4},
+    {0x66B9, 0x66B9}, {0x66BE, 0x66BE}, {0x66D9, 0x66D9}, {0x66DB, 0x66DD}, {0x66E6, 0x66E6}, {0x66E9, 0x66E9},
+    {0x66F0, 0x66F0}, {0x66F2, 0x66F4}, {0x66F7, 0x66F7}, {0x66F9, 0x66F9}, {0x66FC, 0x66FC}, {0x66FE, 0x6700},
+    {0x6708, 0x670B}, {0x670D, 0x670D}, {0x6710, 0x6710}, {0x6714, 0x6715}, {0x6717, 0x6717}, {0x671B, 0x671B},
+    {0x671D, 0x671D}, {0x671F, 0x671F}, {0x6726, 0x6726}, {0x6728, 0x6728}, {0x672A, 0x672D}, {0x672F, 0x672F},
+    {0x6731, 0x6731}, {0x6734, 0x6735}, {0x673A, 0x673A}, {0x673D, 0x673D}, {0x6740, 0x6740}, {0x6742, 0x6743},
+    {0x6746, 0x6746}, {0x6748, 0x6749}, {0x674C, 0x674C}, {0x674E, 0x6751}, {0x6753, 0x6753}, {0x6756, 0x6756},
+    {0x675C, 0x675C}, {0x675E, 0x6761}, {0x6765, 0x6765}, {0x6768, 0x676A}, {0x676D, 0x676D}, {0x676F, 0x6770},
+    {0x6772, 0x6773}, {0x6775, 0x6775}, {0x6777, 0x6777}, {0x677C, 0x677C}, {0x677E, 0x677F}, {0x6781, 0x6781},
+    {0x6784, 0x6784}, {0x6787, 0x6787}, {0x6789, 0x6789}, {0x678B, 0x678B}, {0x6790, 0x6790}, {0x6795, 0x6795},
+    {0x6797, 0x6798}, {0x679A, 0x679A}, {0x679C, 0x679E}, {0x67A2, 0x67A3}, {0x67A5, 0x67A5}, {0x67A7, 0x67A8},
+    {0x67AA, 0x67AB}, {0x67AD, 0x67AD}, {0x67AF, 0x67B0}, {0x67B3, 0x67B3}, {0x67B5, 0x67B8}, {0x67C1, 0x67C1},
+    {0x67C3, 0x67C4}, {0x67CF, 0x67D4}, {0x67D8, 0x67DA}, {0x67DC, 0x67DE}, {0x67E0, 0x67E0}, {0x67E2, 0x67E2},
+    {0x67E5, 0x67E5}, {0x67E9, 0x67E9}, {0x67EC, 0x67EC}, {0x67EF, 0x67F1}, {0x67F3, 0x67F4}, {0x67FD, 0x67FD},
+    {0x67FF, 0x6800}, {0x6805, 0x6805}, {0x6807, 0x680C}, {0x680E, 0x680F}, {0x6811, 0x6811}, {0x6813, 0x6813},
+    {0x6816, 0x6817}, {0x681D, 0x681D}, {0x6821, 0x6821}, {0x6829, 0x682A}, {0x6832, 0x6833}, {0x6837, 0x6839},
+    {0x683C, 0x683E}, {0x6840, 0x6846}, {0x6848, 0x684A}, {0x684C, 0x684C}, {0x684E, 0x684E}, {0x6850, 0x6851},
+    {0x6853, 0x6855}, {0x6860, 0x6869}, {0x686B, 0x686B}, {0x6874, 0x6874}, {0x6876, 0x6877}, {0x6881, 0x6881},
+    {0x6883, 0x6883}, {0x6885, 0x6886}, {0x688F, 0x688F}, {0x6893, 0x6893}, {0x6897, 0x6897}, {0x68A2, 0x68A2},
+    {0x68A6, 0x68A8}, {0x68AD, 0x68AD}, {0x68AF, 0x68B0}, {0x68B3, 0x68B3}, {0x68B5, 0x68B5}, {0x68C0, 0x68C0},
+    {0x68C2, 0x68C2}, {0x68C9, 0x68C9}, {0x68CB, 0x68CB}, {0x68CD, 0x68CD}, {0x68D2, 0x68D2}, {0x68D5, 0x68D5},
+    {0x68D8, 0x68D8}, {0x68DA, 0x68DA}, {0x68E0, 0x68E0}, {0x68E3, 0x68E3}, {0x68EE, 0x68EE}, {0x68F0, 0x68F1},
+    {0x68F5, 0x68F5}, {0x68F9, 0x68FA}, {0x68FC, 0x68FC}, {0x6901, 0x6901}, {0x6905, 0x6905}, {0x690B, 0x690B},
+    {0x690D, 0x690E}, {0x6910, 0x6910}, {0x6912, 0x6912}, {0x691F, 0x6920}, {0x6924, 0x6924}, {0x692D, 0x692D},
+    {0x6930, 0x6930}, {0x6934, 0x6934}, {0x6939, 0x6939}, {0x693D, 0x693D}, {0x693F, 0x693F}, {0x6942, 0x6942},
+    {0x6954, 0x6954}, {0x6957, 0x6957}, {0x695A, 0x695A}, {0x695D, 0x695E}, {0x6960, 0x6960}, {0x6963, 0x6963},
+    {0x6966, 0x6966}, {0x696B, 0x696B}, {0x696E, 0x696E}, {0x6971, 0x6971}, {0x6977, 0x6979}, {0x697C, 0x697C},
+    {0x6980, 0x6980}, {0x6982, 0x6982}, {0x6984, 0x6984}, {0x6986, 0x6989}, {0x698D, 0x698D}, {0x6994, 0x6995},
+    {0x6998, 0x6998}, {0x699B, 0x699C}, {0x69A7, 0x69A8}, {0x69AB, 0x69AB}, {0x69AD, 0x69AD}, {0x69B1, 0x69B1},
+    {0x69B4, 0x69B4}, {0x69B7, 0x69B7}, {0x69BB, 0x69BB}, {0x69C1, 0x69C1}, {0x69CA, 0x69CA}, {0x69CC, 0x69CC},
+    {0x69CE, 0x69CE}, {0x69D0, 0x69D0}, {0x69D4, 0x69D4}, {0x69DB, 0x69DB}, {0x69DF, 0x69E0}, {0x69ED, 0x69ED},
+    {0x69F2, 0x69F2}, {0x69FD, 0x69FD}, {0x69FF, 0x69FF}, {0x6A0A, 0x6A0A}, {0x6A17, 0x6A18}, {0x6A1F, 0x6A1F},
+    {0x6A21, 0x6A21}, {0x6A28, 0x6A28}, {0x6A2A, 0x6A2A}, {0x6A2F, 0x6A2F}, {0x6A31, 0x6A31}, {0x6A35, 0x6A35},
+    {0x6A3D, 0x6A3E}, {0x6A44, 0x6A44}, {0x6A47, 0x6A47}, {0x6A50, 0x6A50}, {0x6A58, 0x6A59}, {0x6A5B, 0x6A5B},
+    {0x6A61, 0x6A61}, {0x6A65, 0x6A65}, {0x6A71, 0x6A71}, {0x6A79, 0x6A79}, {0x6A7C, 0x6A7C}, {0x6A80, 0x6A80},
+    {0x6A84, 0x6A84}, {0x6A8E, 0x6A8E}, {0x6A90, 0x6A91}, {0x6A97, 0x6A97}, {0x6AA0, 0x6AA0}, {0x6AA9, 0x6AA9},
+    {0x6AAB, 0x6AAC}, {0x6B20, 0x6B24}, {0x6B27, 0x6B27}, {0x6B32, 0x6B32}, {0x6B37, 0x6B37}, {0x6B39, 0x6B3A},
+    {0x6B3E, 0x6B3E}, {0x6B43, 0x6B43}, {0x6B46, 0x6B47}, {0x6B49, 0x6B49}, {0x6B4C, 0x6B4C}, {0x6B59, 0x6B59},
+    {0x6B62, 0x6B67}, {0x6B6A, 0x6B6A}, {0x6B79, 0x6B79}, {0x6B7B, 0x6B7C}, {0x6B81, 0x6B84}, {0x6B86, 0x6B87},
+    {0x6B89, 0x6B8B}, {0x6B8D, 0x6B8D}, {0x6B92, 0x6B93}, {0x6B96, 0x6B96}, {0x6B9A, 0x6B9B}, {0x6BA1, 0x6BA1},
+    {0x6BAA, 0x6BAA}, {0x6BB3, 0x6BB5}, {0x6BB7, 0x6BB7}, {0x6BBF, 0x6BBF}, {0x6BC1, 0x6BC2}, {0x6BC5, 0x6BC5},
+    {0x6BCB, 0x6BCB}, {0x6BCD, 0x6BCD}, {0x6BCF, 0x6BCF}, {0x6BD2, 0x6BD7}, {0x6BD9, 0x6BD9}, {0x6BDB, 0x6BDB},
+    {0x6BE1, 0x6BE1}, {0x6BEA, 0x6BEB}, {0x6BEF, 0x6BEF}, {0x6BF3, 0x6BF3}, {0x6BF5, 0x6BF5}, {0x6BF9, 0x6BF9},
+    {0x6BFD, 0x6BFD}, {0x6C05, 0x6C07}, {0x6C0D, 0x6C0D}, {0x6C0F, 0x6C11}, {0x6C13, 0x6C16}, {0x6C18, 0x6C1B},
+    {0x6C1F, 0x6C1F}, {0x6C21, 0x6C22}, {0x6C24, 0x6C24}, {0x6C26, 0x6C2A}, {0x6C2E, 0x6C30}, {0x6C32, 0x6C32},
+    {0x6C34, 0x6C35}, {0x6C38, 0x6C38}, {0x6C3D, 0x6C3D}, {0x6C40, 0x6C42}, {0x6C46, 0x6C47}, {0x6C49, 0x6C4A},
+    {0x6C50, 0x6C50}, {0x6C54, 0x6C55}, {0x6C57, 0x6C57}, {0x6C5B, 0x6C61}, {0x6C64, 0x6C64}, {0x6C68, 0x6C6A},
+    {0x6C70, 0x6C70}, {0x6C72, 0x6C72}, {0x6C74, 0x6C74}, {0x6C76, 0x6C76}, {0x6C79, 0x6C79}, {0x6C7D, 0x6C7E},
+    {0x6C81, 0x6C83}, {0x6C85, 0x6C86}, {0x6C88, 0x6C89}, {0x6C8C, 0x6C8C}, {0x6C8F, 0x6C90}, {0x6C93, 0x6C94},
+    {0x6C99, 0x6C99}, {0x6C9B, 0x6C9B}, {0x6C9F, 0x6C9F}, {0x6CA1, 0x6CA1}, {0x6CA3, 0x6CA7}, {0x6CA9, 0x6CAB},
+    {0x6CAD, 0x6CAE}, {0x6CB1, 0x6CB3}, {0x6CB8, 0x6CB9}, {0x6CBB, 0x6CBF}, {0x6CC4, 0x6CC5}, {0x6CC9, 0x6CCA},
+    {0x6CCC, 0x6CCC}, {0x6CD0, 0x6CD0}, {0x6CD3, 0x6CD7}, {0x6CDB, 0x6CDB}, {0x6CDE, 0x6CDE}, {0x6CE0, 0x6CE3},
+    {0x6CE5, 0x6CE5}, {0x6CE8, 0x6CE8}, {0x6CEA, 0x6CEB}, {0x6CEE, 0x6CF1}, {0x6CF3, 0x6CF3}, {0x6CF5, 0x6CF8},
+    {0x6CFA, 0x6CFE}, {0x6D01, 0x6D01}, {0x6D04, 0x6D04}, {0x6D07, 0x6D07}, {0x6D0B, 0x6D0C}, {0x6D0E, 0x6D0E},
+    {0x6D12, 0x6D12}, {0x6D17, 0x6D17}, {0x6D19, 0x6D1B}, {0x6D1E, 0x6D1E}, {0x6D25, 0x6D25}, {0x6D27, 0x6D27},
+    {0x6D2A, 0x6D2B}, {0x6D2E, 0x6D2E}, {0x6D31, 0x6D33}, {0x6D35, 0x6D35}, {0x6D39, 0x6D39}, {0x6D3B, 0x6D3E},
+    {0x6D41, 0x6D41}, {0x6D43, 0x6D43}, {0x6D45, 0x6D48}, {0x6D4A, 0x6D4B}, {0x6D4D, 0x6D4F}, {0x6D51, 0x6D54},
+    {0x6D59, 0x6D5A}, {0x6D5C, 0x6D5C}, {0x6D5E, 0x6D5E}, {0x6D60, 0x6D60}, {0x6D63, 0x6D63}, {0x6D66, 0x6D66},
+    {0x6D69, 0x6D6A}, {0x6D6E, 0x6D6F}, {0x6D74, 0x6D74}, {0x6D77, 0x6D78}, {0x6D7C, 0x6D7C}, {0x6D82, 0x6D82},
+    {0x6D85, 0x6D85}, {0x6D88, 0x6D89}, {0x6D8C, 0x6D8C}, {0x6D8E, 0x6D8E}, {0x6D91, 0x6D91}, {0x6D93, 0x6D95},
+    {0x6D9B, 0x6D9B}, {0x6D9D, 0x6DA1}, {0x6DA3, 0x6DA4}, {0x6DA6, 0x6DAB}, {0x6DAE, 0x6DAF}, {0x6DB2, 0x6DB2},
+    {0x6DB5, 0x6DB5}, {0x6DB8, 0x6DB8}, {0x6DBF, 0x6DC0}, {0x6DC4, 0x6DC7}, {0x6DCB, 0x6DCC}, {0x6DD1, 0x6DD1},
+    {0x6DD6, 0x6DD6}, {0x6DD8, 0x6DD9}, {0x6DDD, 0x6DDE}, {0x6DE0, 0x6DE1}, {0x6DE4, 0x6DE4}, {0x6DE6, 0x6DE6},
+    {0x6DEB, 0x6DEC}, {0x6DEE, 0x6DEE}, {0x6DF1, 0x6DF1}, {0x6DF3, 0x6DF3}, {0x6DF7, 0x6DF7}, {0x6DF9, 0x6DF9},
+    {0x6DFB, 0x6DFC}, {0x6E05, 0x6E05}, {0x6E0A, 0x6E0A}, {0x6E0C, 0x6E0E}, {0x6E10, 0x6E11}, {0x6E14, 0x6E14},
+    {0x6E16, 0x6E17}, {0x6E1A, 0x6E1A}, {0x6E1D, 0x6E1D}, {0x6E20, 0x6E21}, {0x6E23, 0x6E25}, {0x6E29, 0x6E29},
+    {0x6E2B, 0x6E2B}, {0x6E2D, 0x6E2D}, {0x6E2F, 0x6E2F}, {0x6E32, 0x6E32}, {0x6E34, 0x6E34}, {0x6E38, 0x6E38},
+    {0x6E3A, 0x6E3A}, {0x6E43, 0x6E44}, {0x6E4D, 0x6E4E}, {0x6E53, 0x6E54}, {0x6E56, 0x6E56}, {0x6E58, 0x6E58},
+    {0x6E5B, 0x6E5B}, {0x6E5F, 0x6E5F}, {0x6E6B, 0x6E6B}, {0x6E6E, 0x6E6E}, {0x6E7E, 0x6E7F}, {0x6E83, 0x6E83},
+    {0x6E85, 0x6E86}, {0x6E89, 0x6E89}, {0x6E8F, 0x6E90}, {0x6E98, 0x6E98}, {0x6E9C, 0x6E9C}, {0x6E9F, 0x6E9F},
+    {0x6EA2, 0x6EA2}, {0x6EA5, 0x6EA5}, {0x6EA7, 0x6EA7}, {0x6EAA, 0x6EAA}, {0x6EAF, 0x6EAF}, {0x6EB1, 0x6EB2},
+    {0x6EB4, 0x6EB4}, {0x6EB6, 0x6EB7}, {0x6EBA, 0x6EBB}, {0x6EBD, 0x6EBD}, {0x6EC1, 0x6EC2}, {0x6EC7, 0x6EC7},
+    {0x6ECB, 0x6ECB}, {0x6ECF, 0x6ECF}, {0x6ED1, 0x6ED1}, {0x6ED3, 0x6ED5}, {0x6ED7, 0x6ED7}, {0x6EDA, 0x6EDA},
+    {0x6EDE, 0x6EE2}, {0x6EE4, 0x6EE6}, {0x6EE8, 0x6EE9}, {0x6EF4, 0x6EF4}, {0x6EF9, 0x6EF9}, {0x6F02, 0x6F02},
+    {0x6F06, 0x6F06}, {0x6F09, 0x6F09}, {0x6F0F, 0x6F0F}, {0x6F13, 0x6F15}, {0x6F20, 0x6F20}, {0x6F24, 0x6F24},
+    {0x6F29, 0x6F2B}, {0x6F2D, 0x6F2D}, {0x6F2F, 0x6F2F}, {0x6F31, 0x6F31}, {0x6F33, 0x6F33}, {0x6F36, 0x6F36},
+    {0x6F3E, 0x6F3E}, {0x6F46, 0x6F47}, {0x6F4B, 0x6F4B}, {0x6F4D, 0x6F4D}, {0x6F58, 0x6F58}, {0x6F5C, 0x6F5C},
+    {0x6F5E, 0x6F5E}, {0x6F62, 0x6F62}, {0x6F66, 0x6F66}, {0x6F6D, 0x6F6E}, {0x6F72, 0x6F72}, {0x6F74, 0x6F74},
+    {0x6F78, 0x6F78}, {0x6F7A, 0x6F7A}, {0x6F7C, 0x6F7C}, {0x6F84, 0x6F84}, {0x6F88, 0x6F89}, {0x6F8C, 0x6F8E},
+    {0x6F9C, 0x6F9C}, {0x6FA1, 0x6FA1}, {0x6FA7, 0x6FA7}, {0x6FB3, 0x6FB3}, {0x6FB6, 0x6FB6}, {0x6FB9, 0x6FB9},
+    {0x6FC0, 0x6FC0}, {0x6FC2, 0x6FC2}, {0x6FC9, 0x6FC9}, {0x6FD1, 0x6FD2}, {0x6FDE, 0x6FDE}, {0x6FE0, 0x6FE1},
+    {0x6FEE, 0x6FEF}, {0x7011, 0x7011}, {0x701A, 0x701B}, {0x7023, 0x7023}, {0x7035, 0x7035}, {0x7039, 0x7039},
+    {0x704C, 0x704C}, {0x704F, 0x704F}, {0x705E, 0x705E}, {0x706B, 0x706D}, {0x706F, 0x7070}, {0x7075, 0x7076},
+    {0x7078, 0x7078}, {0x707C, 0x707C}, {0x707E, 0x7080}, {0x7085, 0x7085}, {0x7089, 0x708A}, {0x708E, 0x708E},
+    {0x7092, 0x7092}, {0x7094, 0x7096}, {0x7099, 0x7099}, {0x709C, 0x709D}, {0x70AB, 0x70AF}, {0x70B1, 0x70B1},
+    {0x70B3, 0x70B3}, {0x70B7, 0x70B9}, {0x70BB, 0x70BD}, {0x70C0, 0x70C3}, {0x70C8, 0x70C8}, {0x70CA, 0x70CA},
+    {0x70D8, 0x70D9}, {0x70DB, 0x70DB}, {0x70DF, 0x70DF}, {0x70E4, 0x70E4}, {0x70E6, 0x70E9}, {0x70EB, 0x70ED},
+    {0x70EF, 0x70EF}, {0x70F7, 0x70F7}, {0x70F9, 0x70F9}, {0x70FD, 0x70FD}, {0x7109, 0x710A}, {0x7110, 0x7110},
+    {0x7113, 0x7113}, {0x7115, 0x7116}, {0x7118, 0x711A}, {0x7126, 0x7126}, {0x712F, 0x7131}, {0x7136, 0x7136},
+    {0x7145, 0x7145}, {0x714A, 0x714A}, {0x714C, 0x714C}, {0x714E, 0x714E}, {0x715C, 0x715C}, {0x715E, 0x715E},
+    {0x7164, 0x7164}, {0x7166, 0x7168}, {0x716E, 0x716E}, {0x7172, 0x7173}, {0x7178, 0x7178}, {0x717A, 0x717A},
+    {0x717D, 0x717D}, {0x7184, 0x7184}, {0x718A, 0x718A}, {0x718F, 0x718F}, {0x7194, 0x7194}, {0x7198, 0x7199},
+    {0x719F, 0x71A0}, {0x71A8, 0x71A8}, {0x71AC, 0x71AC}, {0x71B3, 0x71B3}, {0x71B5, 0x71B5}, {0x71B9, 0x71B9},
+    {0x71C3, 0x71C3}, {0x71CE, 0x71CE}, {0x71D4, 0x71D5}, {0x71E0, 0x71E0}, {0x71E5, 0x71E5}, {0x71E7, 0x71E7},
+    {0x71EE, 0x71EE}, {0x71F9, 0x71F9}, {0x7206, 0x7206}, {0x721D, 0x721D}, {0x7228, 0x7228}, {0x722A, 0x722A},
+    {0x722C, 0x722C}, {0x7230, 0x7231}, {0x7235, 0x7239}, {0x723B, 0x723B}, {0x723D, 0x723D}, {0x723F, 0x723F},
+    {0x7247, 0x7248}, {0x724C, 0x724D}, {0x7252, 0x7252}, {0x7256, 0x7256}, {0x7259, 0x7259}, {0x725B, 0x725B},
+    {0x725D, 0x725D}, {0x725F, 0x725F}, {0x7261, 0x7262}, {0x7266, 0x7267}, {0x7269, 0x7269}, {0x726E, 0x726F},
+    {0x7272, 0x7272}, {0x7275, 0x7275}, {0x7279, 0x727A}, {0x727E, 0x7281}, {0x7284, 0x7284}, {0x728A, 0x728B},
+    {0x728D, 0x728D}, {0x728F, 0x728F}, {0x7292, 0x7292}, {0x729F, 0x729F}, {0x72AC, 0x72AD}, {0x72AF, 0x72B0},
+    {0x72B4, 0x72B4}, {0x72B6, 0x72B9}, {0x72C1, 0x72C4}, {0x72C8, 0x72C8}, {0x72CD, 0x72CE}, {0x72D0, 0x72D0},
+    {0x72D2, 0x72D2}, {0x72D7, 0x72D7}, {0x72D9, 0x72D9}, {0x72DE, 0x72DE}, {0x72E0, 0x72E1}, {0x72E8, 0x72E9},
+    {0x72EC, 0x72F4}, {0x72F7, 0x72F8}, {0x72FA, 0x72FC}, {0x7301, 0x7301}, {0x7303, 0x7303}, {0x730A, 0x730A},
+    {0x730E, 0x730E}, {0x7313, 0x7313}, {0x7315, 0x7317}, {0x731B, 0x731E}, {0x7321, 0x7322}, {0x7325, 0x7325},
+    {0x7329, 0x732C}, {0x732E, 0x732E}, {0x7331, 0x7331}, {0x7334, 0x7334}, {0x7337, 0x7339}, {0x733E, 0x733F},
+    {0x734D, 0x734D}, {0x7350, 0x7350}, {0x7352, 0x7352}, {0x7357, 0x7357}, {0x7360, 0x7360}, {0x736C, 0x736D},
+    {0x736F, 0x736F}, {0x737E, 0x737E}, {0x7384, 0x7384}, {0x7387, 0x7387}, {0x7389, 0x7389}, {0x738B, 0x738B},
+    {0x738E, 0x738E}, {0x7391, 0x7391}, {0x7396, 0x7396}, {0x739B, 0x739B}, {0x739F, 0x739F}, {0x73A2, 0x73A2},
+    {0x73A9, 0x73A9}, {0x73AB, 0x73AB}, {0x73AE, 0x73B0}, {0x73B2, 0x73B3}, {0x73B7, 0x73B7}, {0x73BA, 0x73BB},
+    {0x73C0, 0x73C0}, {0x73C2, 0x73C2}, {0x73C8, 0x73CA}, {0x73CD, 0x73CD}, {0x73CF, 0x73D1}, {0x73D9, 0x73D9},
+    {0x73DE, 0x73DE}, {0x73E0, 0x73E0}, {0x73E5, 0x73E5}, {0x73E7, 0x73E7}, {0x73E9, 0x73E9}, {0x73ED, 0x73ED},
+    {0x73F2, 0x73F2}, {0x7403, 0x7403}, {0x7405, 0x7406}, {0x7409, 0x740A}, {0x740F, 0x7410}, {0x741A, 0x741B},
+    {0x7422, 0x7422}, {0x7425, 0x7426}, {0x7428, 0x7428}, {0x742A, 0x742A}, {0x742C, 0x742C}, {0x742E, 0x742E},
+    {0x7430, 0x7430}, {0x7433, 0x7436}, {0x743C, 0x743C}, {0x7441, 0x7441}, {0x7455, 0x7455}, {0x7457, 0x7457},
+    {0x7459, 0x745C}, {0x745E, 0x745F}, {0x746D, 0x746D}, {0x7470, 0x7470}, {0x7476, 0x7477}, {0x747E, 0x747E},
+    {0x7480, 0x7481}, {0x7483, 0x7483}, {0x7487, 0x7487}, {0x748B, 0x748B}, {0x748E, 0x748E}, {0x7490, 0x7490},
+    {0x749C, 0x749C}, {0x749E, 0x749E}, {0x74A7, 0x74A9}, {0x74BA, 0x74BA}, {0x74D2, 0x74D2}, {0x74DC, 0x74DC},
+    {0x74DE, 0x74DE}, {0x74E0, 0x74E0}, {0x74E2, 0x74E4}, {0x74E6, 0x74E6}, {0x74EE, 0x74EF}, {0x74F4, 0x74F4},
+    {0x74F6, 0x74F7}, {0x74FF, 0x74FF}, {0x7504, 0x7504}, {0x750D, 0x750D}, {0x750F, 0x750F}, {0x7511, 0x7511},
+    {0x7513, 0x7513}, {0x7518, 0x751A}, {0x751C, 0x751C}, {0x751F, 0x751F}, {0x7525, 0x7525}, {0x7528, 0x7529},
+    {0x752B, 0x752D}, {0x752F, 0x7533}, {0x7535, 0x7535}, {0x7537, 0x7538}, {0x753A, 0x753B}, {0x753E, 0x753E},
+    {0x7540, 0x7540}, {0x7545, 0x7545}, {0x7548, 0x7548}, {0x754B, 0x754C}, {0x754E, 0x754F}, {0x7554, 0x7554},
+    {0x7559, 0x755C}, {0x7565, 0x7566}, {0x756A, 0x756A}, {0x7572, 0x7572}, {0x7574, 0x7574}, {0x7578, 0x7579},
+    {0x757F, 0x757F}, {0x7583, 0x7583}, {0x7586, 0x7586}, {0x758B, 0x758B}, {0x758F, 0x758F}, {0x7591, 0x7592},
+    {0x7594, 0x7594}, {0x7596, 0x7597}, {0x7599, 0x759A}, {0x759D, 0x759D}, {0x759F, 0x75A1}, {0x75A3, 0x75A5},
+    {0x75AB, 0x75AC}, {0x75AE, 0x75B5}, {0x75B8, 0x75B9}, {0x75BC, 0x75BE}, {0x75C2, 0x75C5}, {0x75C7, 0x75CA},
+    {0x75CD, 0x75CD}, {0x75D2, 0x75D2}, {0x75D4, 0x75D6}, {0x75D8, 0x75D8}, {0x75DB, 0x75DB}, {0x75DE, 0x75DE},
+    {0x75E2, 0x75E4}, {0x75E6, 0x75E8}, {0x75EA, 0x75EB}, {0x75F0, 0x75F1}, {0x75F4, 0x75F4}, {0x75F9, 0x75F9},
+    {0x75FC, 0x75FC}, {0x75FF, 0x7601}, {0x7603, 0x7603}, {0x7605, 0x7605}, {0x760A, 0x760A}, {0x760C, 0x760C},
+    {0x7610, 0x7610}, {0x7615, 0x7615}, {0x7617, 0x7619}, {0x761B, 0x761B}, {0x761F, 0x7620}, {0x7622, 0x7622},
+    {0x7624, 0x7626}, {0x7629, 0x762B}, {0x762D, 0x762D}, {0x7630, 0x7630}, {0x7633, 0x7635}, {0x7638, 0x7638},
+    {0x763C, 0x763C}, {0x763E, 0x7640}, {0x7643, 0x7643}, {0x764C, 0x764D}, {0x7654, 0x7654}, {0x7656, 0x7656},
+    {0x765C, 0x765C}, {0x765E, 0x765E}, {0x7663, 0x7663}, {0x766B, 0x766B}, {0x766F, 0x766F}, {0x7678, 0x7678},
+    {0x767B, 0x767B}, {0x767D, 0x767E}, {0x7682, 0x7682}, {0x7684, 0x7684}, {0x7686, 0x7688}, {0x768B, 0x768B},
+    {0x768E, 0x768E}, {0x7691, 0x7691}, {0x7693, 0x7693}, {0x7696, 0x7696}, {0x7699, 0x7699}, {0x76A4, 0x76A4},
+    {0x76AE, 0x76AE}, {0x76B1, 0x76B2}, {0x76B4, 0x76B4}, {0x76BF, 0x76BF}, {0x76C2, 0x76C2}, {0x76C5, 0x76C6},
+    {0x76C8, 0x76C8}, {0x76CA, 0x76CA}, {0x76CD, 0x76D2}, {0x76D4, 0x76D4}, {0x76D6, 0x76D8}, {0x76DB, 0x76DB},
+    {0x76DF, 0x76DF}, {0x76E5, 0x76E5}, {0x76EE, 0x76EF}, {0x76F1, 0x76F2}, {0x76F4, 0x76F4}, {0x76F8, 0x76F9},
+    {0x76FC, 0x76FC}, {0x76FE, 0x76FE}, {0x7701, 0x7701}, {0x7704, 0x7704}, {0x7707, 0x7709}, {0x770B, 0x770B},
+    {0x770D, 0x770D}, {0x7719, 0x771A}, {0x771F, 0x7720}, {0x7722, 0x7722}, {0x7726, 0x7726}, {0x7728, 0x7729},
+    {0x772D, 0x772D}, {0x772F, 0x772F}, {0x7735, 0x7738}, {0x773A, 0x773A}, {0x773C, 0x773C}, {0x7740, 0x7741},
+    {0x7743, 0x7743}, {0x7747, 0x7747}, {0x7750, 0x7751}, {0x775A, 0x775B}, {0x7761, 0x7763}, {0x7765, 0x7766},
+    {0x7768, 0x7768}, {0x776B, 0x776C}, {0x7779, 0x7779}, {0x777D, 0x7780}, {0x7784, 0x7785}, {0x778C, 0x778E},
+    {0x7791, 0x7792}, {0x779F, 0x77A0}, {0x77A2, 0x77A2}, {0x77A5, 0x77A5}, {0x77A7, 0x77A7}, {0x77A9, 0x77AA},
+    {0x77AC, 0x77AC}, {0x77B0, 0x77B0}, {0x77B3, 0x77B3}, {0x77B5, 0x77B5}, {0x77BB, 0x77BB}, {0x77BD, 0x77BD},
+    {0x77BF, 0x77BF}, {0x77CD, 0x77CD}, {0x77D7, 0x77D7}, {0x77DB, 0x77DC}, {0x77E2, 0x77E3}, {0x77E5, 0x77E5},
+    {0x77E7, 0x77E7}, {0x77E9, 0x77E9}, {0x77EB, 0x77EE}, {0x77F3, 0x77F3}, {0x77F6, 0x77F6}, {0x77F8, 0x77F8},
+    {0x77FD, 0x7802}, {0x7809, 0x7809}, {0x780C, 0x780D}, {0x7811, 0x7812}, {0x7814, 0x7814}, {0x7816, 0x7818},
+    {0x781A, 0x781A}, {0x781C, 0x781D}, {0x781F, 0x781F}, {0x7823, 0x7823}, {0x7825, 0x7827}, {0x7829, 0x7829},
+    {0x782C, 0x782D}, {0x7830, 0x7830}, {0x7834, 0x7834}, {0x7837, 0x783C}, {0x783E, 0x783E}, {0x7840, 0x7840},
+    {0x7845, 0x7845}, {0x7847, 0x7847}, {0x784C, 0x784C}, {0x784E, 0x784E}, {0x7850, 0x7850}, {0x7852, 0x7852},
+    {0x7855, 0x7857}, {0x785D, 0x785D}, {0x786A, 0x786E}, {0x7877, 0x7877}, {0x787C, 0x787C}, {0x7887, 0x7887},
+    {0x7889, 0x7889}, {0x788C, 0x788E}, {0x7891, 0x7891}, {0x7893, 0x7893}, {0x7897, 0x7898}, {0x789A, 0x789C},
+    {0x789F, 0x789F}, {0x78A1, 0x78A1}, {0x78A3, 0x78A3}, {0x78A5, 0x78A5}, {0x78A7, 0x78A7}, {0x78B0, 0x78B4},
+    {0x78B9, 0x78B9}, {0x78BE, 0x78BE}, {0x78C1, 0x78C1}, {0x78C5, 0x78C5}, {0x78C9, 0x78CB}, {0x78D0, 0x78D0},
+    {0x78D4, 0x78D5}, {0x78D9, 0x78D9}, {0x78E8, 0x78E8}, {0x78EC, 0x78EC}, {0x78F2, 0x78F2}, {0x78F4, 0x78F4},
+    {0x78F7, 0x78F7}, {0x78FA, 0x78FA}, {0x7901, 0x7901}, {0x7905, 0x7905}, {0x7913, 0x7913}, {0x791E, 0x791E},
+    {0x7924, 0x7924}, {0x7934, 0x7934}, {0x793A, 0x793C}, {0x793E, 0x793E}, {0x7940, 0x7941}, {0x7946, 0x7946},
+    {0x7948, 0x7949}, {0x7953, 0x7953}, {0x7956, 0x7957}, {0x795A, 0x7960}, {0x7962, 0x7962}, {0x7965, 0x7965},
+    {0x7967, 0x7968}, {0x796D, 0x796D}, {0x796F, 0x796F}, {0x7977, 0x7978}, {0x797A, 0x797A}, {0x7980, 0x7981},
+    {0x7984, 0x7985}, {0x798A, 0x798A}, {0x798F, 0x798F}, {0x799A, 0x799A}, {0x79A7, 0x79A7}, {0x79B3, 0x79B3},
+    {0x79B9, 0x79BB}, {0x79BD, 0x79BE}, {0x79C0, 0x79C1}, {0x79C3, 0x79C3}, {0x79C6, 0x79C6}, {0x79C9, 0x79C9},
+    {0x79CB, 0x79CB}, {0x79CD, 0x79CD}, {0x79D1, 0x79D2}, {0x79D5, 0x79D5}, {0x79D8, 0x79D8}, {0x79DF, 0x79DF},
+    {0x79E3, 0x79E4}, {0x79E6, 0x79E7}, {0x79E9, 0x79E9}, {0x79EB, 0x79EB}, {0x79ED, 0x79ED}, {0x79EF, 0x79F0},
+    {0x79F8, 0x79F8}, {0x79FB, 0x79FB}, {0x79FD, 0x79FD}, {0x7A00, 0x7A00}, {0x7A02, 0x7A03}, {0x7A06, 0x7A06},
+    {0x7A0B, 0x7A0B}, {0x7A0D, 0x7A0E}, {0x7A14, 0x7A14}, {0x7A17, 0x7A17}, {0x7A1A, 0x7A1A}, {0x7A1E, 0x7A1E},
+    {0x7A20, 0x7A20}, {0x7A23, 0x7A23}, {0x7A33, 0x7A33}, {0x7A37, 0x7A37}, {0x7A39, 0x7A39}, {0x7A3B, 0x7A3D},
+    {0x7A3F, 0x7A3F}, {0x7A46, 0x7A46}, {0x7A51, 0x7A51}, {0x7A57, 0x7A57}, {0x7A70, 0x7A70}, {0x7A74, 0x7A74},
+    {0x7A76, 0x7A7A}, {0x7A7F, 0x7A81}, {0x7A83, 0x7A84}, {0x7A86, 0x7A86}, {0x7A88, 0x7A88}, {0x7A8D, 0x7A8D},
+    {0x7A91, 0x7A92}, {0x7A95, 0x7A98}, {0x7A9C, 0x7A9D}, {0x7A9F, 0x7AA0}, {0x7AA5, 0x7AA6}, {0x7AA8, 0x7AA8},
+    {0x7AAC, 0x7AAD}, {0x7AB3, 0x7AB3}, {0x7ABF, 0x7ABF}, {0x7ACB, 0x7ACB}, {0x7AD6, 0x7AD6}, {0x7AD9, 0x7AD9},
+    {0x7ADE, 0x7AE0}, {0x7AE3, 0x7AE3}, {0x7AE5, 0x7AE6}, {0x7AED, 0x7AED}, {0x7AEF, 0x7AEF}, {0x7AF9, 0x7AFA},
+    {0x7AFD, 0x7AFD}, {0x7AFF, 0x7AFF}, {0x7B03, 0x7B04}, {0x7B06, 0x7B06}, {0x7B08, 0x7B08}, {0x7B0A, 0x7B0B},
+    {0x7B0F, 0x7B0F}, {0x7B11, 0x7B11}, {0x7B14, 0x7B15}, {0x7B19, 0x7B19}, {0x7B1B, 0x7B1B}, {0x7B1E, 0x7B1E},
+    {0x7B20, 0x7B20}, {0x7B24, 0x7B26}, {0x7B28, 0x7B28}, {0x7B2A, 0x7B2C}, {0x7B2E, 0x7B2E}, {0x7B31, 0x7B31},
+    {0x7B33, 0x7B33}, {0x7B38, 0x7B38}, {0x7B3A, 0x7B3A}, {0x7B3C, 0x7B3C}, {0x7B3E, 0x7B3E}, {0x7B45, 0x7B45},
+    {0x7B47, 0x7B47}, {0x7B49, 0x7B49}, {0x7B4B, 0x7B4C}, {0x7B4F, 0x7B52}, {0x7B54, 0x7B54}, {0x7B56, 0x7B56},
+    {0x7B58, 0x7B58}, {0x7B5A, 0x7B5B}, {0x7B5D, 0x7B5D}, {0x7B60, 0x7B60}, {0x7B62, 0x7B62}, {0x7B6E, 0x7B6E},
+    {0x7B71, 0x7B72}, {0x7B75, 0x7B75}, {0x7B77, 0x7B77}, {0x7B79, 0x7B79}, {0x7B7B, 0x7B7B}, {0x7B7E, 0x7B7E},
+    {0x7B80, 0x7B80}, {0x7B85, 0x7B85}, {0x7B8D, 0x7B8D}, {0x7B90, 0x7B90}, {0x7B94, 0x7B95}, {0x7B97, 0x7B97},
+    {0x7B9C, 0x7B9D}, {0x7BA1, 0x7BA2}, {0x7BA6, 0x7BAD}, {0x7BB1, 0x7BB1}, {0x7BB4, 0x7BB4}, {0x7BB8, 0x7BB8},
+    {0x7BC1, 0x7BC1}, {0x7BC6, 0x7BC7}, {0x7BCC, 0x7BCC}, {0x7BD1, 0x7BD1}, {0x7BD3, 0x7BD3}, {0x7BD9, 0x7BDA},
+    {0x7BDD, 0x7BDD}, {0x7BE1, 0x7BE1}, {0x7BE5, 0x7BE6}, {0x7BEA, 0x7BEA}, {0x7BEE, 0x7BEE}, {0x7BF1, 0x7BF1},
+    {0x7BF7, 0x7BF7}, {0x7BFC, 0x7BFC}, {0x7BFE, 0x7BFE}, {0x7C07, 0x7C07}, {0x7C0B, 0x7C0C}, {0x7C0F, 0x7C0F},
+    {0x7C16, 0x7C16}, {0x7C1F, 0x7C1F}, {0x7C26, 0x7C27}, {0x7C2A, 0x7C2A}, {0x7C38, 0x7C38}, {0x7C3F, 0x7C41},
+    {0x7C4D, 0x7C4D}, {0x7C73, 0x7C74}, {0x7C7B, 0x7C7D}, {0x7C89, 0x7C89}, {0x7C91, 0x7C92}, {0x7C95, 0x7C95},
+    {0x7C97, 0x7C98}, {0x7C9C, 0x7C9F}, {0x7CA2, 0x7CA2}, {0x7CA4, 0x7CA5}, {0x7CAA, 0x7CAA}, {0x7CAE, 0x7CAE},
+    {0x7CB1, 0x7CB3}, {0x7CB9, 0x7CB9}, {0x7CBC, 0x7CBE}, {0x7CC1, 0x7CC1}, {0x7CC5, 0x7CC5}, {0x7CC7, 0x7CC8},
+    {0x7CCA, 0x7CCA}, {0x7CCC, 0x7CCD}, {0x7CD5, 0x7CD7}, {0x7CD9, 0x7CD9}, {0x7CDC, 0x7CDC}, {0x7CDF, 0x7CE0},
+    {0x7CE8, 0x7CE8}, {0x7CEF, 0x7CEF}, {0x7CF8, 0x7CF8}, {0x7CFB, 0x7CFB}, {0x7D0A, 0x7D0A}, {0x7D20, 0x7D20},
+    {0x7D22, 0x7D22}, {0x7D27, 0x7D27}, {0x7D2B, 0x7D2B}, {0x7D2F, 0x7D2F}, {0x7D6E, 0x7D6E}, {0x7D77, 0x7D77},
+    {0x7DA6, 0x7DA6}, {0x7DAE, 0x7DAE}, {0x7E3B, 0x7E3B}, {0x7E41, 0x7E41}, {0x7E47, 0x7E47}, {0x7E82, 0x7E82},
+    {0x7E9B, 0x7E9B}, {0x7E9F, 0x7EAD}, {0x7EAF, 0x7EB3}, {0x7EB5, 0x7EBA}, {0x7EBD, 0x7ED5}, {0x7ED7, 0x7EE3},
+    {0x7EE5, 0x7EEB}, {0x7EED, 0x7EF8}, {0x7EFA, 0x7F09}, {0x7F0B, 0x7F0F}, {0x7F11, 0x7F1D}, {0x7F1F, 0x7F36},
+    {0x7F38, 0x7F38}, {0x7F3A, 0x7F3A}, {0x7F42, 0x7F42}, {0x7F44, 0x7F45}, {0x7F50, 0x7F51}, {0x7F54, 0x7F55},
+    {0x7F57, 0x7F58}, {0x7F5A, 0x7F5A}, {0x7F5F, 0x7F5F}, {0x7F61, 0x7F62}, {0x7F68, 0x7F6A}, {0x7F6E, 0x7F6E},
+    {0x7F71, 0x7F72}, {0x7F74, 0x7F74}, {0x7F79, 0x7F79}, {0x7F7E, 0x7F7E}, {0x7F81, 0x7F81}, {0x7F8A, 0x7F8A},
+    {0x7F8C, 0x7F8C}, {0x7F8E, 0x7F8E}, {0x7F94, 0x7F94}, {0x7F9A, 0x7F9A}, {0x7F9D, 0x7F9F}, {0x7FA1, 0x7FA1},
+    {0x7FA4, 0x7FA4}, {0x7FA7, 0x7FA7}, {0x7FAF, 0x7FB0}, {0x7FB2, 0x7FB2}, {0x7FB8, 0x7FB9}, {0x7FBC, 0x7FBD},
+    {0x7FBF, 0x7FBF}, {0x7FC1, 0x7FC1}, {0x7FC5, 0x7FC5}, {0x7FCA, 0x7FCA}, {0x7FCC, 0x7FCC}, {0x7FCE, 0x7FCE},
+    {0x7FD4, 0x7FD5}, {0x7FD8, 0x7FD8}, {0x7FDF, 0x7FE1}, {0x7FE5, 0x7FE6}, {0x7FE9, 0x7FE9}, {0x7FEE, 0x7FEE},
+    {0x7FF0, 0x7FF1}, {0x7FF3, 0x7FF3}, {0x7FFB, 0x7FFC}, {0x8000, 0x8001}, {0x8003, 0x8006}, {0x800B, 0x800D},
+    {0x8010, 0x8010}, {0x8012, 0x8012}, {0x8014, 0x8019}, {0x801C, 0x801C}, {0x8020, 0x8020}, {0x8022, 0x8022},
+    {0x8025, 0x802A}, {0x8031, 0x8031}, {0x8033, 0x8033}, {0x8035, 0x8038}, {0x803B, 0x803B}, {0x803D, 0x803D},
+    {0x803F, 0x803F}, {0x8042, 0x8043}, {0x8046, 0x8046}, {0x804A, 0x804D}, {0x8052, 0x8052}, {0x8054, 0x8054},
+    {0x8058, 0x8058}, {0x805A, 0x805A}, {0x8069, 0x806A}, {0x8071, 0x8071}, {0x807F, 0x8080}, {0x8083, 0x8084},
+    {0x8086, 0x8087}, {0x8089, 0x8089}, {0x808B, 0x808C}, {0x8093, 0x8093}, {0x8096, 0x8096}, {0x8098, 0x8098},
+    {0x809A, 0x809D}, {0x809F, 0x80A2}, {0x80A4, 0x80A5}, {0x80A9, 0x80AB}, {0x80AD, 0x80AF}, {0x80B1, 0x80B2},
+    {0x80B4, 0x80B4}, {0x80B7, 0x80B7}, {0x80BA, 0x80BA}, {0x80BC, 0x80C4}, {0x80C6, 0x80C6}, {0x80CC, 0x80CE},
+    {0x80D6, 0x80D7}, {0x80D9, 0x80DE}, {0x80E1, 0x80E1}, {0x80E4, 0x80E5}, {0x80E7, 0x80ED}, {0x80EF, 0x80F4},
+    {0x80F6, 0x80F6}, {0x80F8, 0x80F8}, {0x80FA, 0x80FA}, {0x80FC, 0x80FD}, {0x8102, 0x8102}, {0x8106, 0x8106},
+    {0x8109, 0x810A}, {0x810D, 0x8114}, {0x8116, 0x8116}, {0x8118, 0x8118}, {0x811A, 0x811A}, {0x811E, 0x811E},
+    {0x812C, 0x812C}, {0x812F, 0x812F}, {0x8131, 0x8132}, {0x8136, 0x8136}, {0x8138, 0x8138}, {0x813E, 0x813E},
+    {0x8146, 0x8146}, {0x8148, 0x8148}, {0x814A, 0x814C}, {0x8150, 0x8151}, {0x8153, 0x8155}, {0x8159, 0x815A},
+    {0x8160, 0x8160}, {0x8165, 0x8165}, {0x8167, 0x8167}, {0x8169, 0x8169}, {0x816D, 0x816E}, {0x8170, 0x8171},
+    {0x8174, 0x8174}, {0x8179, 0x8180}, {0x8182, 0x8182}, {0x8188, 0x8188}, {0x818A, 0x818A}, {0x818F, 0x818F},
+    {0x8191, 0x8191}, {0x8198, 0x8198}, {0x819B, 0x819D}, {0x81A3, 0x81A3}, {0x81A6, 0x81A6}, {0x81A8, 0x81A8},
+    {0x81AA, 0x81AA}, {0x81B3, 0x81B3}, {0x81BA, 0x81BB}, {0x81C0, 0x81C3}, {0x81C6, 0x81C6}, {0x81CA, 0x81CA},
+    {0x81CC, 0x81CC}, {0x81E3, 0x81E3}, {0x81E7, 0x81E7}, {0x81EA, 0x81EA}, {0x81EC, 0x81ED}, {0x81F3, 0x81F4},
+    {0x81FB, 0x81FC}, {0x81FE, 0x81FE}, {0x8200, 0x8202}, {0x8204, 0x8206}, {0x820C, 0x820D}, {0x8210, 0x8210},
+    {0x8212, 0x8212}, {0x8214, 0x8214}, {0x821B, 0x821C}, {0x821E, 0x821F}, {0x8221, 0x8223}, {0x8228, 0x8228},
+    {0x822A, 0x822D}, {0x822F, 0x8231}, {0x8233, 0x8239}, {0x823B, 0x823B}, {0x823E, 0x823E}, {0x8244, 0x8244},
+    {0x8247, 0x8247}, {0x8249, 0x8249}, {0x824B, 0x824B}, {0x824F, 0x824F}, {0x8258, 0x8258}, {0x825A, 0x825A},
+    {0x825F, 0x825F}, {0x8268, 0x8268}, {0x826E, 0x8270}, {0x8272, 0x8274}, {0x8279, 0x827A}, {0x827D, 0x827F},
+    {0x8282, 0x8282}, {0x8284, 0x8284}, {0x8288, 0x8288}, {0x828A, 0x828B}, {0x828D, 0x828F}, {0x8291, 0x8292},
+    {0x8297, 0x8299}, {0x829C, 0x829D}, {0x829F, 0x829F}, {0x82A1, 0x82A1}, {0x82A4, 0x82A6}, {0x82A8, 0x82B1},
+    {0x82B3, 0x82B4}, {0x82B7, 0x82B9}, {0x82BD, 0x82BE}, {0x82C1, 0x82C1}, {0x82C4, 0x82C4}, {0x82C7, 0x82C8},
+    {0x82CA, 0x82CF}, {0x82D1, 0x82D5}, {0x82D7, 0x82D8}, {0x82DB, 0x82DC}, {0x82DE, 0x82E1}, {0x82E3, 0x82E6},
+    {0x82EB, 0x82EB}, {0x82EF, 0x82EF}, {0x82F1, 0x82F1}, {0x82F4, 0x82F4}, {0x82F7, 0x82F7}, {0x82F9, 0x82F9},
+    {0x82FB, 0x82FB}, {0x8301, 0x8309}, {0x830C, 0x830C}, {0x830E, 0x830F}, {0x8311, 0x8311}, {0x8314, 0x8315},
+    {0x8317, 0x8317}, {0x831A, 0x831C}, {0x8327, 0x8328}, {0x832B, 0x832D}, {0x832F, 0x832F}, {0x8331, 0x8331},
+    {0x8333, 0x8336}, {0x8338, 0x833A}, {0x833C, 0x833C}, {0x8340, 0x8340}, {0x8343, 0x8343}, {0x8346, 0x8347},
+    {0x8349, 0x8349}, {0x834F, 0x8352}, {0x8354, 0x8354}, {0x835A, 0x835C}, {0x835E, 0x8361}, {0x8363, 0x836F},
+    {0x8377, 0x8378}, {0x837B, 0x837D}, {0x8385, 0x8386}, {0x8389, 0x8389}, {0x838E, 0x838E}, {0x8392, 0x8393},
+    {0x8398, 0x8398}, {0x839B, 0x839C}, {0x839E, 0x839E}, {0x83A0, 0x83A0}, {0x83A8, 0x83AB}, {0x83B0, 0x83B4},
+    {0x83B6, 0x83BA}, {0x83BC, 0x83BD}, {0x83C0, 0x83C1}, {0x83C5, 0x83C5}, {0x83C7, 0x83C7}, {0x83CA, 0x83CA},
+    {0x83CC, 0x83CC}, {0x83CF, 0x83CF}, {0x83D4, 0x83D4}, {0x83D6, 0x83D6}, {0x83D8, 0x83D8}, {0x83DC, 0x83DD},
+    {0x83DF, 0x83E1}, {0x83E5, 0x83E5}, {0x83E9, 0x83EA}, {0x83F0, 0x83F2}, {0x83F8, 0x83F9}, {0x83FD, 0x83FD},
+    {0x8401, 0x8401}, {0x8403, 0x8404}, {0x8406, 0x8406}, {0x840B, 0x840F}, {0x8411, 0x8411}, {0x8418, 0x8418},
+    {0x841C, 0x841D}, {0x8424, 0x8428}, {0x8431, 0x8431}, {0x8438, 0x8438}, {0x843C, 0x843D}, {0x8446, 0x8446},
+    {0x8451, 0x8451}, {0x8457, 0x8457}, {0x8459, 0x845C}, {0x8461, 0x8461}, {0x8463, 0x8463}, {0x8469, 0x8469},
+    {0x846B, 0x846D}, {0x8471, 0x8471}, {0x8473, 0x8473}, {0x8475, 0x8476}, {0x8478, 0x8478}, {0x847A, 0x847A},
+    {0x8482, 0x8482}, {0x8487, 0x8489}, {0x848B, 0x848C}, {0x848E, 0x848E}, {0x8497, 0x8497}, {0x8499, 0x8499},
+    {0x849C, 0x849C}, {0x84A1, 0x84A1}, {0x84AF, 0x84AF}, {0x84B2, 0x84B2}, {0x84B4, 0x84B4}, {0x84B8, 0x84BA},
+    {0x84BD, 0x84BD}, {0x84BF, 0x84BF}, {0x84C1, 0x84C1}, {0x84C4, 0x84C4}, {0x84C9, 0x84CA}, {0x84CD, 0x84CD},
+    {0x84D0, 0x84D1}, {0x84D3, 0x84D3}, {0x84D6, 0x84D6}, {0x84DD, 0x84DD}, {0x84DF, 0x84E0}, {0x84E3, 0x84E3},
+    {0x84E5, 0x84E6}, {0x84EC, 0x84EC}, {0x84F0, 0x84F0}, {0x84FC, 0x84FC}, {0x84FF, 0x84FF}, {0x850C, 0x850C},
+    {0x8511, 0x8511}, {0x8513, 0x8513}, {0x8517, 0x8517}, {0x851A, 0x851A}, {0x851F, 0x851F}, {0x8521, 0x8521},
+    {0x852B, 0x852C}, {0x8537, 0x853D}, {0x8543, 0x8543}, {0x8548, 0x854A}, {0x8556, 0x8556}, {0x8559, 0x8559},
+    {0x855E, 0x855E}, {0x8564, 0x8564}, {0x8568, 0x8568}, {0x8572, 0x8572}, {0x8574, 0x8574}, {0x8579, 0x857B},
+    {0x857E, 0x857E}, {0x8584, 0x8585}, {0x8587, 0x8587}, {0x858F, 0x858F}, {0x859B, 0x859C}, {0x85A4, 0x85A4},
+    {0x85A8, 0x85A8}, {0x85AA, 0x85AA}, {0x85AE, 0x85B0}, {0x85B7, 0x85B7}, {0x85B9, 0x85B9}, {0x85C1, 0x85C1},
+    {0x85C9, 0x85C9}, {0x85CF, 0x85D0}, {0x85D3, 0x85D3}, {0x85D5, 0x85D5}, {0x85DC, 0x85DC}, {0x85E4, 0x85E4},
+    {0x85E9, 0x85E9}, {0x85FB, 0x85FB}, {0x85FF, 0x85FF}, {0x8605, 0x8605}, {0x8611, 0x8611}, {0x8616, 0x8616},
+    {0x8627, 0x8627}, {0x8629, 0x8629}, {0x8638, 0x8638}, {0x863C, 0x863C}, {0x864D, 0x8651}, {0x8654, 0x8654},
+    {0x865A, 0x865A}, {0x865E, 0x865E}, {0x8662, 0x8662}, {0x866B, 0x866C}, {0x866E, 0x866E}, {0x8671, 0x8671},
+    {0x8679, 0x8682}, {0x868A, 0x868D}, {0x8693, 0x8693}, {0x8695, 0x8695}, {0x869C, 0x869D}, {0x86A3, 0x86A4},
+    {0x86A7, 0x86AA}, {0x86AC, 0x86AC}, {0x86AF, 0x86B1}, {0x86B4, 0x86B6}, {0x86BA, 0x86BA}, {0x86C0, 0x86C0},
+    {0x86C4, 0x86C4}, {0x86C6, 0x86C7}, {0x86C9, 0x86CB}, {0x86CE, 0x86D1}, {0x86D4, 0x86D4}, {0x86D8, 0x86D9},
+    {0x86DB, 0x86DB}, {0x86DE, 0x86DF}, {0x86E4, 0x86E4}, {0x86E9, 0x86E9}, {0x86ED, 0x86EE}, {0x86F0, 0x86F4},
+    {0x86F8, 0x86F9}, {0x86FE, 0x86FE}, {0x8700, 0x8700}, {0x8702, 0x8703}, {0x8707, 0x870A}, {0x870D, 0x870D},
+    {0x8712, 0x8713}, {0x8715, 0x8715}, {0x8717, 0x8718}, {0x871A, 0x871A}, {0x871C, 0x871C}, {0x871E, 0x871E},
+    {0x8721, 0x8723}, {0x8725, 0x8725}, {0x8729, 0x8729}, {0x872E, 0x872E}, {0x8731, 0x8731}, {0x8734, 0x8734},
+    {0x8737, 0x8737}, {0x873B, 0x873B}, {0x873E, 0x873F}, {0x8747, 0x8749}, {0x874C, 0x874C}, {0x874E, 0x874E},
+    {0x8753, 0x8753}, {0x8757, 0x8757}, {0x8759, 0x8759}, {0x8760, 0x8760}, {0x8763, 0x8765}, {0x876E, 0x876E},
+    {0x8770, 0x8770}, {0x8774, 0x8774}, {0x8776, 0x8776}, {0x877B, 0x877E}, {0x8782, 0x8783}, {0x8785, 0x8785},
+    {0x8788, 0x8788}, {0x878B, 0x878B}, {0x878D, 0x878D}, {0x8793, 0x8793}, {0x8797, 0x8797}, {0x879F, 0x879F},
+    {0x87A8, 0x87A8}, {0x87AB, 0x87AD}, {0x87AF, 0x87AF}, {0x87B3, 0x87B3}, {0x87B5, 0x87B5}, {0x87BA, 0x87BA},
+    {0x87BD, 0x87BD}, {0x87C0, 0x87C0}, {0x87C6, 0x87C6}, {0x87CA, 0x87CB}, {0x87D1, 0x87D3}, {0x87DB, 0x87DB},
+    {0x87E0, 0x87E0}, {0x87E5, 0x87E5}, {0x87EA, 0x87EA}, {0x87EE, 0x87EE}, {0x87F9, 0x87F9}, {0x87FE, 0x87FE},
+    {0x8803, 0x8803}, {0x880A, 0x880A}, {0x8813, 0x8813}, {0x8815, 0x8816}, {0x881B, 0x881B}, {0x8821, 0x8822},
+    {0x8832, 0x8832}, {0x8839, 0x8839}, {0x883C, 0x883C}, {0x8840, 0x8840}, {0x8844, 0x8845}, {0x884C, 0x884D},
+    {0x8854, 0x8854}, {0x8857, 0x8857}, {0x8859, 0x8859}, {0x8861, 0x8865}, {0x8868, 0x8869}, {0x886B, 0x886C},
+    {0x886E, 0x886E}, {0x8870, 0x8870}, {0x8872, 0x8872}, {0x8877, 0x8877}, {0x887D, 0x887F}, {0x8881, 0x8882},
+    {0x8884, 0x8885}, {0x8888, 0x8888}, {0x888B, 0x888B}, {0x888D, 0x888D}, {0x8892, 0x8892}, {0x8896, 0x8896},
+    {0x889C, 0x889C}, {0x88A2, 0x88A2}, {0x88A4, 0x88A4}, {0x88AB, 0x88AB}, {0x88AD, 0x88AD}, {0x88B1, 0x88B1},
+    {0x88B7, 0x88B7}, {0x88BC, 0x88BC}, {0x88C1, 0x88C2}, {0x88C5, 0x88C6}, {0x88C9, 0x88C9}, {0x88CE, 0x88CE},
+    {0x88D2, 0x88D2}, {0x88D4, 0x88D5}, {0x88D8, 0x88D9}, {0x88DF, 0x88DF}, {0x88E2, 0x88E5}, {0x88E8, 0x88E8},
+    {0x88F0, 0x88F1}, {0x88F3, 0x88F4}, {0x88F8, 0x88F9}, {0x88FC, 0x88FC}, {0x88FE, 0x88FE}, {0x8902, 0x8902},
+    {0x890A, 0x890A}, {0x8910, 0x8910}, {0x8912, 0x8913}, {0x8919, 0x891B}, {0x8921, 0x8921}, {0x8925, 0x8925},
+    {0x892A, 0x892B}, {0x8930, 0x8930}, {0x8934, 0x8934}, {0x8936, 0x8936}, {0x8941, 0x8941}, {0x8944, 0x8944},
+    {0x895E, 0x895F}, {0x8966, 0x8966}, {0x897B, 0x897B}, {0x897F, 0x897F}, {0x8981, 0x8981}, {0x8983, 0x8983},
+    {0x8986, 0x8986}, {0x89C1, 0x89C2}, {0x89C4, 0x89CC}, {0x89CE, 0x89D2}, {0x89D6, 0x89D6}, {0x89DA, 0x89DA},
+    {0x89DC, 0x89DC}, {0x89DE, 0x89DE}, {0x89E3, 0x89E3}, {0x89E5, 0x89E6}, {0x89EB, 0x89EB}, {0x89EF, 0x89EF},
+    {0x89F3, 0x89F3}, {0x8A00, 0x8A00}, {0x8A07, 0x8A07}, {0x8A3E, 0x8A3E}, {0x8A48, 0x8A48}, {0x8A79, 0x8A79},
+    {0x8A89, 0x8A8A}, {0x8A93, 0x8A93}, {0x8B07, 0x8B07}, {0x8B26, 0x8B26}, {0x8B66, 0x8B66}, {0x8B6C, 0x8B6C},
+    {0x8BA0, 0x8BAB}, {0x8BAD, 0x8BB0}, {0x8BB2, 0x8BBA}, {0x8BBC, 0x8BC6}, {0x8BC8, 0x8BCF}, {0x8BD1, 0x8BE9},
+    {0x8BEB, 0x8C08}, {0x8C0A, 0x8C1D}, {0x8C1F, 0x8C37}, {0x8C41, 0x8C41}, {0x8C46, 0x8C47}, {0x8C49, 0x8C49},
+    {0x8C4C, 0x8C4C}, {0x8C55, 0x8C55}, {0x8C5A, 0x8C5A}, {0x8C61, 0x8C62}, {0x8C6A, 0x8C6B}, {0x8C73, 0x8C73},
+    {0x8C78, 0x8C7A}, {0x8C82, 0x8C82}, {0x8C85, 0x8C85}, {0x8C89, 0x8C8A}, {0x8C8C, 0x8C8C}, {0x8C94, 0x8C94},
+    {0x8C98, 0x8C98}, {0x8D1D, 0x8D1F}, {0x8D21, 0x8D50}, {0x8D53, 0x8D56}, {0x8D58, 0x8D5E}, {0x8D60, 0x8D64},
+    {0x8D66, 0x8D67}, {0x8D6B, 0x8D6B}, {0x8D6D, 0x8D6D}, {0x8D70, 0x8D70}, {0x8D73, 0x8D77}, {0x8D81, 0x8D81},
+    {0x8D84, 0x8D85}, {0x8D8A, 0x8D8B}, {0x8D91, 0x8D91}, {0x8D94, 0x8D94}, {0x8D9F, 0x8D9F}, {0x8DA3, 0x8DA3},
+    {0x8DB1, 0x8DB1}, {0x8DB3, 0x8DB5}, {0x8DB8, 0x8DB8}, {0x8DBA, 0x8DBA}, {0x8DBC, 0x8DBC}, {0x8DBE, 0x8DBF},
+    {0x8DC3, 0x8DC4}, {0x8DC6, 0x8DC6}, {0x8DCB, 0x8DCC}, {0x8DCE, 0x8DCF}, {0x8DD1, 0x8DD1}, {0x8DD6, 0x8DD7},
+    {0x8DDA, 0x8DDB}, {0x8DDD, 0x8DDF}, {0x8DE3, 0x8DE4}, {0x8DE8, 0x8DE8}, {0x8DEA, 0x8DEC}, {0x8DEF, 0x8DEF},
+    {0x8DF3, 0x8DF3}, {0x8DF5, 0x8DF5}, {0x8DF7, 0x8DFB}, {0x8DFD, 0x8DFD}, {0x8E05, 0x8E05}, {0x8E09, 0x8E0A},
+    {0x8E0C, 0x8E0C}, {0x8E0F, 0x8E0F}, {0x8E14, 0x8E14}, {0x8E1D, 0x8E1F}, {0x8E22, 0x8E23}, {0x8E29, 0x8E2A},
+    {0x8E2C, 0x8E2C}, {0x8E2E, 0x8E2F}, {0x8E31, 0x8E31}, {0x8E35, 0x8E35}, {0x8E39, 0x8E3A}, {0x8E3D, 0x8E3D},
+    {0x8E40, 0x8E42}, {0x8E44, 0x8E44}, {0x8E47, 0x8E4B}, {0x8E51, 0x8E52}, {0x8E59, 0x8E59}, {0x8E66, 0x8E66},
+    {0x8E69, 0x8E69}, {0x8E6C, 0x8E6D}, {0x8E6F, 0x8E70}, {0x8E72, 0x8E72}, {0x8E74, 0x8E74}, {0x8E76, 0x8E76},
+    {0x8E7C, 0x8E7C}, {0x8E7F, 0x8E7F}, {0x8E81, 0x8E81}, {0x8E85, 0x8E85}, {0x8E87, 0x8E87}, {0x8E8F, 0x8E90},
+    {0x8E94, 0x8E94}, {0x8E9C, 0x8E9C}, {0x8E9E, 0x8E9E}, {0x8EAB, 0x8EAC}, {0x8EAF, 0x8EAF}, {0x8EB2, 0x8EB2},
+    {0x8EBA, 0x8EBA}, {0x8ECE, 0x8ECE}, {0x8F66, 0x8F69}, {0x8F6B, 0x8F7F}, {0x8F81, 0x8F8B}, {0x8F8D, 0x8F91},
+    {0x8F93, 0x8F9C}, {0x8F9E, 0x8F9F}, {0x8FA3, 0x8FA3}, {0x8FA8, 0x8FA9}, {0x8FAB, 0x8FAB}, {0x8FB0, 0x8FB1},
+    {0x8FB6, 0x8FB6}, {0x8FB9, 0x8FB9}, {0x8FBD, 0x8FBE}, {0x8FC1, 0x8FC2}, {0x8FC4, 0x8FC5}, {0x8FC7, 0x8FC8},
+    {0x8FCE, 0x8FCE}, {0x8FD0, 0x8FD1}, {0x8FD3, 0x8FD5}, {0x8FD8, 0x8FD9}, {0x8FDB, 0x8FDF}, {0x8FE2, 0x8FE2},
+    {0x8FE4, 0x8FE6}, {0x8FE8, 0x8FEB}, {0x8FED, 0x8FEE}, {0x8FF0, 0x8FF0}, {0x8FF3, 0x8FF3}, {0x8FF7, 0x8FF9},
+    {0x8FFD, 0x8FFD}, {0x9000, 0x9006}, {0x9009, 0x900B}, {0x900D, 0x900D}, {0x900F, 0x9012}, {0x9014, 0x9014},
+    {0x9016, 0x9017}, {0x901A, 0x901B}, {0x901D, 0x9022}, {0x9026, 0x9026}, {0x902D, 0x902F}, {0x9035, 0x9036},
+    {0x9038, 0x9038}, {0x903B, 0x903C}, {0x903E, 0x903E}, {0x9041, 0x9042}, {0x9044, 0x9044}, {0x9047, 0x9047},
+    {0x904D, 0x904D}, {0x904F, 0x9053}, {0x9057, 0x9058}, {0x905B, 0x905B}, {0x9062, 0x9063}, {0x9065, 0x9065},
+    {0x9068, 0x9068}, {0x906D, 0x906E}, {0x9074, 0x9075}, {0x907D, 0x907D}, {0x907F, 0x9080}, {0x9082, 0x9083},
+    {0x9088, 0x9088}, {0x908B, 0x908B}, {0x9091, 0x9091}, {0x9093, 0x9093}, {0x9095, 0x9095}, {0x9097, 0x9097},
+    {0x9099, 0x9099}, {0x909B, 0x909B}, {0x909D, 0x909D}, {0x90A1, 0x90A3}, {0x90A6, 0x90A6}, {0x90AA, 0x90AA},
+    {0x90AC, 0x90AC}, {0x90AE, 0x90B1}, {0x90B3, 0x90B6}, {0x90B8, 0x90BB}, {0x90BE, 0x90BE}, {0x90C1, 0x90C1},
+    {0x90C4, 0x90C5}, {0x90C7, 0x90C7}, {0x90CA, 0x90CA}, {0x90CE, 0x90D1}, {0x90D3, 0x90D3}, {0x90D7, 0x90D7},
+    {0x90DB, 0x90DD}, {0x90E1, 0x90E2}, {0x90E6, 0x90E8}, {0x90EB, 0x90EB}, {0x90ED, 0x90ED}, {0x90EF, 0x90EF},
+    {0x90F4, 0x90F4}, {0x90F8, 0x90F8}, {0x90FD, 0x90FE}, {0x9102, 0x9102}, {0x9104, 0x9104}, {0x9119, 0x9119},
+    {0x911E, 0x911E}, {0x9122, 0x9123}, {0x912F, 0x912F}, {0x9131, 0x9131}, {0x9139, 0x9139}, {0x9143, 0x9143},
+    {0x9146, 0x9146}, {0x9149, 0x9150}, {0x9152, 0x9152}, {0x9157, 0x9157}, {0x915A, 0x915A}, {0x915D, 0x915E},
+    {0x9161, 0x9165}, {0x9169, 0x916A}, {0x916C, 0x916C}, {0x916E, 0x9172}, {0x9174, 0x9179}, {0x917D, 0x917F},
+    {0x9185, 0x9185}, {0x9187, 0x9187}, {0x9189, 0x9189}, {0x918B, 0x918D}, {0x9190, 0x9192}, {0x919A, 0x919B},
+    {0x91A2, 0x91A3}, {0x91AA, 0x91AA}, {0x91AD, 0x91AF}, {0x91B4, 0x91B5}, {0x91BA, 0x91BA}, {0x91C7, 0x91C7},
+    {0x91C9, 0x91CA}, {0x91CC, 0x91CF}, {0x91D1, 0x91D1}, {0x91DC, 0x91DC}, {0x9274, 0x9274}, {0x928E, 0x928E},
+    {0x92AE, 0x92AE}, {0x92C8, 0x92C8}, {0x933E, 0x933E}, {0x936A, 0x936A}, {0x938F, 0x938F}, {0x93CA, 0x93CA},
+    {0x93D6, 0x93D6}, {0x943E, 0x943E}, {0x946B, 0x946B}, {0x9485, 0x9490}, {0x9492, 0x9495}, {0x9497, 0x9497},
+    {0x9499, 0x94C6}, {0x94C8, 0x94CE}, {0x94D0, 0x94D2}, {0x94D5, 0x94D9}, {0x94DB, 0x94E5}, {0x94E7, 0x94FA},
+    {0x94FC, 0x951B}, {0x951D, 0x951F}, {0x9521, 0x9526}, {0x9528, 0x9532}, {0x9534, 0x953C}, {0x953E, 0x9542},
+    {0x9544, 0x9547}, {0x9549, 0x954A}, {0x954C, 0x9554}, {0x9556, 0x9559}, {0x955B, 0x955F}, {0x9561, 0x956D},
+    {0x956F, 0x9573}, {0x9576, 0x9576}, {0x957F, 0x957F}, {0x95E8, 0x95EB}, {0x95ED, 0x95FE}, {0x9600, 0x9606},
+    {0x9608, 0x9612}, {0x9614, 0x9617}, {0x9619, 0x961A}, {0x961C, 0x961D}, {0x961F, 0x961F}, {0x9621, 0x9622},
+    {0x962A, 0x962A}, {0x962E, 0x962E}, {0x9631, 0x9636}, {0x963B, 0x963D}, {0x963F, 0x9640}, {0x9642, 0x9642},
+    {0x9644, 0x9649}, {0x964B, 0x964D}, {0x9650, 0x9650}, {0x9654, 0x9655}, {0x965B, 0x965B}, {0x965F, 0x965F},
+    {0x9661, 0x9662}, {0x9664, 0x9664}, {0x9667, 0x966A}, {0x966C, 0x966C}, {0x9672, 0x9672}, {0x9674, 0x9677},
+    {0x9685, 0x9686}, {0x9688, 0x9688}, {0x968B, 0x968B}, {0x968D, 0x968D}, {0x968F, 0x9690}, {0x9694, 0x9694},
+    {0x9697, 0x9699}, {0x969C, 0x969C}, {0x96A7, 0x96A7}, {0x96B0, 0x96B0}, {0x96B3, 0x96B3}, {0x96B6, 0x96B6},
+    {0x96B9, 0x96B9}, {0x96BC, 0x96BE}, {0x96C0, 0x96C1}, {0x96C4, 0x96C7}, {0x96C9, 0x96C9}, {0x96CC, 0x96CF},
+    {0x96D2, 0x96D2}, {0x96D5, 0x96D5}, {0x96E0, 0x96E0}, {0x96E8, 0x96EA}, {0x96EF, 0x96EF}, {0x96F3, 0x96F3},
+    {0x96F6, 0x96F7}, {0x96F9, 0x96F9}, {0x96FE, 0x96FE}, {0x9700, 0x9701}, {0x9704, 0x9704}, {0x9706, 0x9709},
+    {0x970D, 0x970F}, {0x9713, 0x9713}, {0x9716, 0x9716}, {0x971C, 0x971C}, {0x971E, 0x971E}, {0x972A, 0x972A},
+    {0x972D, 0x972D}, {0x9730, 0x9730}, {0x9732, 0x9732}, {0x9738, 0x9739}, {0x973E, 0x973E}, {0x9752, 0x9753},
+    {0x9756, 0x9756}, {0x9759, 0x9759}, {0x975B, 0x975B}, {0x975E, 0x975E}, {0x9760, 0x9762}, {0x9765, 0x9765},
+    {0x9769, 0x9769}, {0x9773, 0x9774}, {0x9776, 0x9776}, {0x977C, 0x977C}, {0x9785, 0x9785}, {0x978B, 0x978B},
+    {0x978D, 0x978D}, {0x9791, 0x9792}, {0x9794, 0x9794}, {0x9798, 0x9798}, {0x97A0, 0x97A0}, {0x97A3, 0x97A3},
+    {0x97AB, 0x97AB}, {0x97AD, 0x97AD}, {0x97AF, 0x97AF}, {0x97B2, 0x97B2}, {0x97B4, 0x97B4}, {0x97E6, 0x97E7},
+    {0x97E9, 0x97ED}, {0x97F3, 0x97F3}, {0x97F5, 0x97F6}, {0x9875, 0x988A}, {0x988C, 0x988D}, {0x988F, 0x9891},
+    {0x9893, 0x9894}, {0x9896, 0x9898}, {0x989A, 0x98A2}, {0x98A4, 0x98A7}, {0x98CE, 0x98CE}, {0x98D1, 0x98D3},
+    {0x98D5, 0x98D5}, {0x98D8, 0x98DA}, {0x98DE, 0x98DF}, {0x98E7, 0x98E8}, {0x990D, 0x990D}, {0x9910, 0x9910},
+    {0x992E, 0x992E}, {0x9954, 0x9955}, {0x9963, 0x9963}, {0x9965, 0x9965}, {0x9967, 0x9972}, {0x9974, 0x9977},
+    {0x997A, 0x997A}, {0x997C, 0x997D}, {0x997F, 0x9981}, {0x9984, 0x9988}, {0x998A, 0x998B}, {0x998D, 0x998D},
+    {0x998F, 0x9999}, {0x99A5, 0x99A5}, {0x99A8, 0x99A8}, {0x9A6C, 0x9A71}, {0x9A73, 0x9A82}, {0x9A84, 0x9A88},
+    {0x9A8A, 0x9A8C}, {0x9A8F, 0x9A93}, {0x9A96, 0x9A98}, {0x9A9A, 0x9AA5}, {0x9AA7, 0x9AA8}, {0x9AB0, 0x9AB1},
+    {0x9AB6, 0x9AB8}, {0x9ABA, 0x9ABA}, {0x9ABC, 0x9ABC}, {0x9AC0, 0x9AC2}, {0x9AC5, 0x9AC5}, {0x9ACB, 0x9ACC},
+    {0x9AD1, 0x9AD1}, {0x9AD3, 0x9AD3}, {0x9AD8, 0x9AD8}, {0x9ADF, 0x9ADF}, {0x9AE1, 0x9AE1}, {0x9AE6, 0x9AE6},
+    {0x9AEB, 0x9AEB}, {0x9AED, 0x9AED}, {0x9AEF, 0x9AEF}, {0x9AF9, 0x9AF9}, {0x9AFB, 0x9AFB}, {0x9B03, 0x9B03},
+    {0x9B08, 0x9B08}, {0x9B0F, 0x9B0F}, {0x9B13, 0x9B13}, {0x9B1F, 0x9B1F}, {0x9B23, 0x9B23}, {0x9B2F, 0x9B2F},
+    {0x9B32, 0x9B32}, {0x9B3B, 0x9B3C}, {0x9B41, 0x9B45}, {0x9B47, 0x9B49}, {0x9B4D, 0x9B4D}, {0x9B4F, 0x9B4F},
+    {0x9B51, 0x9B51}, {0x9B54, 0x9B54}, {0x9C7C, 0x9C7C}, {0x9C7F, 0x9C7F}, {0x9C81, 0x9C82}, {0x9C85, 0x9C88},
+    {0x9C8B, 0x9C8B}, {0x9C8D, 0x9C8E}, {0x9C90, 0x9C92}, {0x9C94, 0x9C95}, {0x9C9A, 0x9C9C}, {0x9C9E, 0x9CA9},
+    {0x9CAB, 0x9CAB}, {0x9CAD, 0x9CAE}, {0x9CB0, 0x9CB8}, {0x9CBA, 0x9CBD}, {0x9CC3, 0x9CC7}, {0x9CCA, 0x9CD0},
+    {0x9CD3, 0x9CD9}, {0x9CDC, 0x9CDF}, {0x9CE2, 0x9CE2}, {0x9E1F, 0x9E23}, {0x9E25, 0x9E26}, {0x9E28, 0x9E2D},
+    {0x9E2F, 0x9E2F}, {0x9E31, 0x9E33}, {0x9E35, 0x9E3A}, {0x9E3D, 0x9E3F}, {0x9E41, 0x9E4C}, {0x9E4E, 0x9E4F},
+    {0x9E51, 0x9E51}, {0x9E55, 0x9E55}, {0x9E57, 0x9E58}, {0x9E5A, 0x9E5C}, {0x9E5E, 0x9E5E}, {0x9E63, 0x9E64},
+    {0x9E66, 0x9E6D}, {0x9E70, 0x9E71}, {0x9E73, 0x9E73}, {0x9E7E, 0x9E7F}, {0x9E82, 0x9E82}, {0x9E87, 0x9E88},
+    {0x9E8B, 0x9E8B}, {0x9E92, 0x9E93}, {0x9E9D, 0x9E9D}, {0x9E9F, 0x9E9F}, {0x9EA6, 0x9EA6}, {0x9EB4, 0x9EB4},
+    {0x9EB8, 0x9EB8}, {0x9EBB, 0x9EBB}, {0x9EBD, 0x9EBE}, {0x9EC4, 0x9EC4}, {0x9EC9, 0x9EC9}, {0x9ECD, 0x9ECF},
+    {0x9ED1, 0x9ED1}, {0x9ED4, 0x9ED4}, {0x9ED8, 0x9ED8}, {0x9EDB, 0x9EDD}, {0x9EDF, 0x9EE0}, {0x9EE2, 0x9EE2},
+    {0x9EE5, 0x9EE5}, {0x9EE7, 0x9EE7}, {0x9EE9, 0x9EEA}, {0x9EEF, 0x9EEF}, {0x9EF9, 0x9EF9}, {0x9EFB, 0x9EFC},
+    {0x9EFE, 0x9EFE}, {0x9F0B, 0x9F0B}, {0x9F0D, 0x9F0E}, {0x9F10, 0x9F10}, {0x9F13, 0x9F13}, {0x9F17, 0x9F17},
+    {0x9F19, 0x9F19}, {0x9F20, 0x9F20}, {0x9F22, 0x9F22}, {0x9F2C, 0x9F2C}, {0x9F2F, 0x9F2F}, {0x9F37, 0x9F37},
+    {0x9F39, 0x9F39}, {0x9F3B, 0x9F3B}, {0x9F3D, 0x9F3E}, {0x9F44, 0x9F44}, {0x9F50, 0x9F51}, {0x9F7F, 0x9F80},
+    {0x9F83, 0x9F8C}, {0x9F99, 0x9F9B}, {0x9F9F, 0x9FA0}, {0xFF01, 0xFF5E}, {0xFFE0, 0xFFE1}, {0xFFE3, 0xFFE3},
+    {0xFFE5, 0xFFE5},
+};
+
+// GBK, 21919 characters
+constexpr static CodepointRange GbkRanges[] = {
+    {0x0000, 0x007F}, {0x00A4, 0x00A4}, {0x00A7, 0x00A8}, {0x00B0, 0x00B1}, {0x00B7, 0x00B7}, {0x00D7, 0x00D7},
+    {0x00E0, 0x00E1}, {0x00E8, 0x00EA}, {0x00EC, 0x00ED}, {0x00F2, 0x00F3}, {0x00F7, 0x00F7}, {0x00F9, 0x00FA},
+    {0x00FC, 0x00FC}, {0x0101, 0x0101}, {0x0113, 0x0113}, {0x011B, 0x011B}, {0x012B, 0x012B}, {0x0144, 0x0144},
+    {0x0148, 0x0148}, {0x014D, 0x014D}, {0x016B, 0x016B}, {0x01CE, 0x01CE}, {0x01D0, 0x01D0}, {0x01D2, 0x01D2},
+    {0x01D4, 0x01D4}, {0x01D6, 0x01D6}, {0x01D8, 0x01D8}, {0x01DA, 0x01DA}, {0x01DC, 0x01DC}, {0x0251, 0x0251},
+    {0x0261, 0x0261}, {0x02C7, 0x02C7}, {0x02C9, 0x02CB}, {0x02D9, 0x02D9}, {0x0391, 0x03A1}, {0x03A3, 0x03A9},
+    {0x03B1, 0x03C1}, {0x03C3, 0x03C9}, {0x0401, 0x0401}, {0x0410, 0x044F}, {0x0451, 0x0451}, {0x2010, 0x2010},
+    {0x2013, 0x2016}, {0x2018, 0x2019}, {0x201C, 0x201D}, {0x2025, 0x2026}, {0x2030, 0x2030}, {0x2032, 0x2033},
+    {0x2035, 0x2035}, {0x203B, 0x203B}, {0x2103, 0x2103}, {0x2105, 0x2105}, {0x2109, 0x2109}, {0x2116, 0x2116},
+    {0x2121, 0x2121}, {0x2160, 0x216B}, {0x2170, 0x2179}, {0x2190, 0x2193}, {0x2196, 0x2199}, {0x2208, 0x2208},
+    {0x220F, 0x220F}, {0x2211, 0x2211}, {0x2215, 0x2215}, {0x221A, 0x221A}, {0x221D, 0x2220}, {0x2223, 0x2223},
+    {0x2225, 0x2225}, {0x2227, 0x222B}, {0x222E, 0x222E}, {0x2234, 0x2237}, {0x223D, 0x223D}, {0x2248, 0x2248},
+    {0x224C, 0x224C}, {0x2252, 0x2252}, {0x2260, 0x2261}, {0x2264, 0x2267}, {0x226E, 0x226F}, {0x2295, 0x2295},
+    {0x2299, 0x2299}, {0x22A5, 0x22A5}, {0x22BF, 0x22BF}, {0x2312, 0x2312}, {0x2460, 0x2469}, {0x2474, 0x249B},
+    {0x2500, 0x254B}, {0x2550, 0x2573}, {0x2581, 0x258F}, {0x2593, 0x2595}, {0x25A0, 0x25A1}, {0x25B2, 0x25B3},
+    {0x25BC, 0x25BD}, {0x25C6, 0x25C7}, {0x25CB, 0x25CB}, {0x25CE, 0x25CF}, {0x25E2, 0x25E5}, {0x2605, 0x2606},
+    {0x2609, 0x2609}, {0x2640, 0x2640}, {0x2642, 0x2642}, {0x3000, 0x3003}, {0x3005, 0x3017}, {0x301D, 0x301E},
+    {0x3021, 0x3029}, {0x3041, 0x3093}, {0x309B, 0x309E}, {0x30A1, 0x30F6}, {0x30FC, 0x30FE}, {0x3105, 0x3129},
+    {0x3220, 0x3229}, {0x3231, 0x3231}, {0x32A3, 0x32A3}, {0x338E, 0x338F}, {0x339C, 0x339E}, {0x33A1, 0x33A1},
+    {0x33C4, 0x33C4}, {0x33CE, 0x33CE}, {0x33D1, 0x33D2}, {0x33D5, 0x33D5}, {0x4E00, 0x9FA5}, {0xF92C, 0xF92C},
+    {0xF979, 0xF979}, {0xF995, 0xF995}, {0xF9E7, 0xF9E7}, {0xF9F1, 0xF9F1}, {0xFA0C, 0xFA0F}, {0xFA11, 0xFA11},
+    {0xFA13, 0xFA14}, {0xFA18, 0xFA18}, {0xFA1F, 0xFA21}, {0xFA23, 0xFA24}, {0xFA27, 0xFA29}, {0xFE30, 0xFE31},
+    {0xFE33, 0xFE44}, {0xFE49, 0xFE52}, {0xFE54, 0xFE57}, {0xFE59, 0xFE66}, {0xFE68, 0xFE6B}, {0xFF01, 0xFF5E},
+    {0xFFE0, 0xFFE5},
+};
+
+// GB 18030, 28540 characters
+constexpr static CodepointRange Gb18030Ranges[] = {
+    {0x0000, 0x007F}, {0x00A4, 0x00A4}, {0x00A7, 0x00A8}, {0x00B0, 0x00B1}, {0x00B7, 0x00B7}, {0x00D7, 0x00D7},
+    {0x00E0, 0x00E1}, {0x00E8, 0x00EA}, {0x00EC, 0x00ED}, {0x00F2, 0x00F3}, {0x00F7, 0x00F7}, {0x00F9, 0x00FA},
+    {0x00FC, 0x00FC}, {0x0101, 0x0101}, {0x0113, 0x0113}, {0x011B, 0x011B}, {0x012B, 0x012B}, {0x0144, 0x0144},
+    {0x0148, 0x0148}, {0x014D, 0x014D}, {0x016B, 0x016B}, {0x01CE, 0x01CE}, {0x01D0, 0x01D0}, {0x01D2, 0x01D2},
+    {0x01D4, 0x01D4}, {0x01D6, 0x01D6}, {0x01D8, 0x01D8}, {0x01DA, 0x01DA}, {0x01DC, 0x01DC}, {0x01F9, 0x01F9},
+    {0x0251, 0x0251}, {0x0261, 0x0261}, {0x02C7, 0x02C7}, {0x02C9, 0x02CB}, {0x02D9, 0x02D9}, {0x0391, 0x03A1},
+    {0x03A3, 0x03A9}, {0x03B1, 0x03C1}, {0x03C3, 0x03C9}, {0x0401, 0x0401}, {0x0410, 0x044F}, {0x0451, 0x0451},
+    {0x2010, 0x2010}, {0x2013, 0x2016}, {0x2018, 0x2019}, {0x201C, 0x201D}, {0x2025, 0x2026}, {0x2030, 0x2030},
+    {0x2032, 0x2033}, {0x2035, 0x2035}, {0x203B, 0x203B}, {0x20AC, 0x20AC}, {0x2103, 0x2103}, {0x2105, 0x2105},
+    {0x2109, 0x2109}, {0x2116, 0x2116}, {0x2121, 0x2121}, {0x2160, 0x216B}, {0x2170, 0x2179}, {0x2190, 0x2193},
+    {0x2196, 0x2199}, {0x2208, 0x2208}, {0x220F, 0x220F}, {0x2211, 0x2211}, {0x2215, 0x2215}, {0x221A, 0x221A},
+    {0x221D, 0x2220}, {0x2223, 0x2223}, {0x2225, 0x2225}, {0x2227, 0x222B}, {0x222E, 0x222E}, {0x2234, 0x2237},
+    {0x223D, 0x223D}, {0x2248, 0x2248}, {0x224C, 0x224C}, {0x2252, 0x2252}, {0x2260, 0x2261}, {0x2264, 0x2267},
+    {0x226E, 0x226F}, {0x2295, 0x2295}, {0x2299, 0x2299}, {0x22A5, 0x22A5}, {0x22BF, 0x22BF}, {0x2312, 0x2312},
+    {0x2460, 0x2469}, {0x2474, 0x249B}, {0x2500, 0x254B}, {0x2550, 0x2573}, {0x2581, 0x258F}, {0x2593, 0x2595},
+    {0x25A0, 0x25A1}, {0x25B2, 0x25B3}, {0x25BC, 0x25BD}, {0x25C6, 0x25C7}, {0x25CB, 0x25CB}, {0x25CE, 0x25CF},
+    {0x25E2, 0x25E5}, {0x2605, 0x2606}, {0x2609, 0x2609}, {0x2640, 0x2640}, {0x2642, 0x2642}, {0x2E81, 0x2E81},
+    {0x2E84, 0x2E84}, {0x2E88, 0x2E88}, {0x2E8B, 0x2E8C}, {0x2E97, 0x2E97}, {0x2EA7, 0x2EA7}, {0x2EAA, 0x2EAA},
+    {0x2EAE, 0x2EAE}, {0x2EB3, 0x2EB3}, {0x2EB6, 0x2EB7}, {0x2EBB, 0x2EBB}, {0x2ECA, 0x2ECA}, {0x2FF0, 0x2FFB},
+    {0x3000, 0x3003}, {0x3005, 0x3017}, {0x301D, 0x301E}, {0x3021, 0x3029}, {0x303E, 0x303E}, {0x3041, 0x3093},
+    {0x309B, 0x309E}, {0x30A1, 0x30F6}, {0x30FC, 0x30FE}, {0x3105, 0x3129}, {0x3220, 0x3229}, {0x3231, 0x3231},
+    {0x32A3, 0x32A3}, {0x338E, 0x338F}, {0x339C, 0x339E}, {0x33A1, 0x33A1}, {0x33C4, 0x33C4}, {0x33CE, 0x33CE},
+    {0x33D1, 0x33D2}, {0x33D5, 0x33D5}, {0x3400, 0x4DBF}, {0x4E00, 0x9FA5}, {0xF92C, 0xF92C}, {0xF979, 0xF979},
+    {0xF995, 0xF995}, {0xF9E7, 0xF9E7}, {0xF9F1, 0xF9F1}, {0xFA0C, 0xFA0F}, {0xFA11, 0xFA11}, {0xFA13, 0xFA14},
+    {0xFA18, 0xFA18}, {0xFA1F, 0xFA21}, {0xFA23, 0xFA24}, {0xFA27, 0xFA29}, {0xFE30, 0xFE31}, {0xFE33, 0xFE44},
+    {0xFE49, 0xFE52}, {0xFE54, 0xFE57}, {0xFE59, 0xFE66}, {0xFE68, 0xFE6B}, {0xFF01, 0xFF5E}, {0xFFE0, 0xFFE5},
+};
+
+// Big5, 13834 characters
+constexpr static CodepointRange Big5Ranges[] = {
+    {0x0000, 0x007F}, {0x00A2, 0x00A3}, {0x00A5, 0x00A5}, {0x00A7, 0x00A7}, {0x00B0, 0x00B1}, {0x00B7, 0x00B7},
+    {0x00D7, 0x00D7}, {0x00F7, 0x00F7}, {0x02C7, 0x02C7}, {0x02C9, 0x02CB}, {0x02CD, 0x02CD}, {0x02D9, 0x02D9},
+    {0x0391, 0x03A1}, {0x03A3, 0x03A9}, {0x03B1, 0x03C1}, {0x03C3, 0x03C9}, {0x0401, 0x0401}, {0x0414, 0x041C},
+    {0x0423, 0x044F}, {0x0451, 0x0451}, {0x2013, 0x2014}, {0x2018, 0x2019}, {0x201C, 0x201D}, {0x2022, 0x2022},
+    {0x2025, 0x2026}, {0x2032, 0x2032}, {0x2035, 0x2035}, {0x203B, 0x203B}, {0x203E, 0x203E}, {0x2103, 0x2103},
+    {0x2105, 0x2105}, {0x2109, 0x2109}, {0x2160, 0x2169}, {0x2190, 0x2193}, {0x2196, 0x2199}, {0x221A, 0x221A},
+    {0x221E, 0x2220}, {0x2223, 0x2223}, {0x2225, 0x2225}, {0x2229, 0x222B}, {0x222E, 0x222E}, {0x2234, 0x2235},
+    {0x223C, 0x223C}, {0x2252, 0x2252}, {0x2260, 0x2261}, {0x2266, 0x2267}, {0x22A5, 0x22A5}, {0x22BF, 0x22BF},
+    {0x2460, 0x2469}, {0x2474, 0x247D}, {0x2500, 0x2500}, {0x2502, 0x2502}, {0x250C, 0x250C}, {0x2510, 0x2510},
+    {0x2514, 0x2514}, {0x2518, 0x2518}, {0x251C, 0x251C}, {0x2524, 0x2524}, {0x252C, 0x252C}, {0x2534, 0x2534},
+    {0x253C, 0x253C}, {0x2550, 0x2550}, {0x255E, 0x255E}, {0x2561, 0x2561}, {0x256A, 0x256A}, {0x256D, 0x2574},
+    {0x2581, 0x258F}, {0x2594, 0x2595}, {0x25A0, 0x25A1}, {0x25B2, 0x25B3}, {0x25BC, 0x25BD}, {0x25C6, 0x25C7},
+    {0x25CB, 0x25CB}, {0x25CE, 0x25CF}, {0x25E2, 0x25E5}, {0x2605, 0x2606}, {0x2609, 0x2609}, {0x2640, 0x2642},
+    {0x3000, 0x3003}, {0x3005, 0x3005}, {0x3008, 0x3012}, {0x3014, 0x3015}, {0x301D, 0x301E}, {0x3021, 0x3029},
+    {0x3041, 0x3093}, {0x309D, 0x309E}, {0x30A1, 0x30F6}, {0x30FE, 0x30FE}, {0x3105, 0x3129}, {0x32A3, 0x32A3},
+    {0x338E, 0x338F}, {0x339C, 0x339E}, {0x33A1, 0x33A1}, {0x33C4, 0x33C4}, {0x33CE, 0x33CE}, {0x33D1, 0x33D2},
+    {0x33D5, 0x33D5}, {0x4E00, 0x4E01}, {0x4E03, 0x4E03}, {0x4E07, 0x4E11}, {0x4E14, 0x4E16}, {0x4E18, 0x4E19},
+    {0x4E1E, 0x4E1F}, {0x4E26, 0x4E26}, {0x4E2B, 0x4E2B}, {0x4E2D, 0x4E2E}, {0x4E30, 0x4E33}, {0x4E38, 0x4E39},
+    {0x4E3B, 0x4E3C}, {0x4E42, 0x4E43}, {0x4E45, 0x4E45}, {0x4E47, 0x4E48}, {0x4E4B, 0x4E4B}, {0x4E4D, 0x4E4F},
+    {0x4E52, 0x4E53}, {0x4E56, 0x4E56}, {0x4E58, 0x4E59}, {0x4E5C, 0x4E5F}, {0x4E69, 0x4E69}, {0x4E73, 0x4E73},
+    {0x4E7E, 0x4E7F}, {0x4E82, 0x4E84}, {0x4E86, 0x4E86}, {0x4E88, 0x4E88}, {0x4E8B, 0x4E8E}, {0x4E91, 0x4E95},
+    {0x4E99, 0x4E99}, {0x4E9B, 0x4E9B}, {0x4E9E, 0x4E9F}, {0x4EA1, 0x4EA2}, {0x4EA4, 0x4EA6}, {0x4EA8, 0x4EA8},
+    {0x4EAB, 0x4EAE}, {0x4EB3, 0x4EB3}, {0x4EB6, 0x4EB6}, {0x4EB9, 0x4EBA}, {0x4EC0, 0x4EC4}, {0x4EC6, 0x4ECB},
+    {0x4ECD, 0x4ECD}, {0x4ED4, 0x4EDA}, {0x4EDC, 0x4EDF}, {0x4EE1, 0x4EE1}, {0x4EE3, 0x4EE5}, {0x4EE8, 0x4EE9},
+    {0x4EF0, 0x4EF7}, {0x4EFB, 0x4EFB}, {0x4EFD, 0x4EFD}, {0x4EFF, 0x4F02}, {0x4F04, 0x4F05}, {0x4F08, 0x4F0B},
+    {0x4F0D, 0x4F15}, {0x4F18, 0x4F19}, {0x4F1D, 0x4F1D}, {0x4F22, 0x4F22}, {0x4F2C, 0x4F2D}, {0x4F2F, 0x4F30},
+    {0x4F33, 0x4F34}, {0x4F36, 0x4F36}, {0x4F38, 0x4F38}, {0x4F3A, 0x4F3F}, {0x4F41, 0x4F41}, {0x4F43, 0x4F43},
+    {0x4F46, 0x4F49}, {0x4F4C, 0x4F64}, {0x4F67, 0x4F67}, {0x4F69, 0x4F6C}, {0x4F6E, 0x4F70}, {0x4F73, 0x4F89},
+    {0x4F8B, 0x4F8B}, {0x4F8D, 0x4F8D}, {0x4F8F, 0x4F92}, {0x4F94, 0x4F98}, {0x4F9A, 0x4F9E}, {0x4FAE, 0x4FAF},
+    {0x4FB2, 0x4FB3}, {0x4FB5, 0x4FB7}, {0x4FB9, 0x4FBB}, {0x4FBF, 0x4FC5}, {0x4FC7, 0x4FC7}, {0x4FC9, 0x4FCB},
+    {0x4FCD, 0x4FD1}, {0x4FD3, 0x4FD4}, {0x4FD6, 0x4FE1}, {0x4FEC, 0x4FEC}, {0x4FEE, 0x4FEF}, {0x4FF1, 0x4FF1},
+    {0x4FF3, 0x4FF8}, {0x4FFA, 0x4FFA}, {0x4FFE, 0x4FFE}, {0x5000, 0x5000}, {0x5005, 0x5007}, {0x5009, 0x5009},
+    {0x500B, 0x500F}, {0x5011, 0x501C}, {0x501E, 0x5023}, {0x5025, 0x502D}, {0x502F, 0x5031}, {0x5033, 0x5033},
+    {0x5035, 0x5035}, {0x5037, 0x5037}, {0x503C, 0x503C}, {0x5040, 0x5041}, {0x5043, 0x5043}, {0x5045, 0x504F},
+    {0x5051, 0x5051}, {0x5053, 0x5053}, {0x5055, 0x5055}, {0x5057, 0x5057}, {0x505A, 0x5065}, {0x5068, 0x506B},
+    {0x506D, 0x5070}, {0x5072, 0x5077}, {0x507A, 0x507A}, {0x507D, 0x507D}, {0x5080, 0x5080}, {0x5082, 0x5083},
+    {0x5085, 0x5085}, {0x5087, 0x5087}, {0x508B, 0x508E}, {0x5091, 0x5092}, {0x5094, 0x5096}, {0x5098, 0x509E},
+    {0x50A2, 0x50A3}, {0x50AC, 0x50B8}, {0x50BA, 0x50BB}, {0x50BD, 0x50BF}, {0x50C1, 0x50C2}, {0x50C4, 0x50CB},
+    {0x50CE, 0x50CF}, {0x50D1, 0x50D1}, {0x50D3, 0x50D7}, {0x50DA, 0x50DB}, {0x50DD, 0x50DD}, {0x50E0, 0x50E0},
+    {0x50E3, 0x50EA}, {0x50EC, 0x50F1}, {0x50F3, 0x50F3}, {0x50F5, 0x50F6}, {0x50F8, 0x50F9}, {0x50FB, 0x50FB},
+    {0x50FD, 0x5100}, {0x5102, 0x510C}, {0x5110, 0x5115}, {0x5117, 0x5118}, {0x511A, 0x511A}, {0x511C, 0x511C},
+    {0x511F, 0x5122}, {0x5124, 0x5126}, {0x5129, 0x512A}, {0x512D, 0x512E}, {0x5130, 0x5135}, {0x5137, 0x513D},
+    {0x513F, 0x5141}, {0x5143, 0x5149}, {0x514B, 0x514D}, {0x5152, 0x5152}, {0x5154, 0x5155}, {0x5157, 0x5157},
+    {0x5159, 0x515F}, {0x5161, 0x5163}, {0x5165, 0x5165}, {0x5167, 0x5169}, {0x516B, 0x516E}, {0x5171, 0x5171},
+    {0x5175, 0x5178}, {0x517C, 0x517C}, {0x5180, 0x5180}, {0x5187, 0x5187}, {0x5189, 0x518A}, {0x518D, 0x518D},
+    {0x518F, 0x518F}, {0x5191, 0x5195}, {0x5197, 0x5198}, {0x519E, 0x519E}, {0x51A0, 0x51A0}, {0x51A2, 0x51A2},
+    {0x51A4, 0x51A5}, {0x51AA, 0x51AA}, {0x51AC, 0x51AC}, {0x51B0, 0x51B1}, {0x51B6, 0x51B7}, {0x51B9, 0x51B9},
+    {0x51BC, 0x51BE}, {0x51C4, 0x51C6}, {0x51C8, 0x51C8}, {0x51CA, 0x51CE}, {0x51D0, 0x51D0}, {0x51D4, 0x51D4},
+    {0x51D7, 0x51D8}, {0x51DC, 0x51DE}, {0x51E0, 0x51E1}, {0x51F0, 0x51F1}, {0x51F3, 0x51F3}, {0x51F5, 0x51F6},
+    {0x51F8, 0x51FA}, {0x51FD, 0x51FD}, {0x5200, 0x5201}, {0x5203, 0x5203}, {0x5206, 0x520A}, {0x520C, 0x520C},
+    {0x520E, 0x520E}, {0x5210, 0x5213}, {0x5216, 0x5217}, {0x521C, 0x521E}, {0x5221, 0x5221}, {0x5224, 0x5225},
+    {0x5228, 0x522A}, {0x522E, 0x522E}, {0x5230, 0x5233}, {0x5235, 0x5238}, {0x523A, 0x523B}, {0x5241, 0x5241},
+    {0x5243, 0x5244}, {0x5246, 0x5247}, {0x5249, 0x524E}, {0x5252, 0x5252}, {0x5254, 0x5256}, {0x525A, 0x525F},
+    {0x5261, 0x5262}, {0x5269, 0x526F}, {0x5272, 0x5272}, {0x5274, 0x5275}, {0x5277, 0x5278}, {0x527A, 0x527D},
+    {0x527F, 0x5284}, {0x5287, 0x528D}, {0x5291, 0x5291}, {0x5293, 0x5293}, {0x5296, 0x5299}, {0x529B, 0x529B},
+    {0x529F, 0x52A0}, {0x52A3, 0x52A3}, {0x52A6, 0x52A6}, {0x52A9, 0x52AE}, {0x52BB, 0x52BC}, {0x52BE, 0x52BE},
+    {0x52C0, 0x52C3}, {0x52C7, 0x52C7}, {0x52C9, 0x52C9}, {0x52CD, 0x52CD}, {0x52D2, 0x52D3}, {0x52D5, 0x52D9},
+    {0x52DB, 0x52DB}, {0x52DD, 0x52DF}, {0x52E2, 0x52E4}, {0x52E6, 0x52E6}, {0x52E9, 0x52E9}, {0x52EB, 0x52EB},
+    {0x52EF, 0x52F1}, {0x52F3, 0x52F5}, {0x52F7, 0x52F8}, {0x52FA, 0x52FC}, {0x52FE, 0x52FF}, {0x5305, 0x5306},
+    {0x5308, 0x530B}, {0x530D, 0x5312}, {0x5315, 0x5317}, {0x5319, 0x531A}, {0x531C, 0x531D}, {0x531F, 0x5323},
+    {0x532A, 0x532A}, {0x532D, 0x532D}, {0x532F, 0x5331}, {0x5334, 0x5334}, {0x5337, 0x5337}, {0x5339, 0x5339},
+    {0x533C, 0x5341}, {0x5343, 0x5345}, {0x5347, 0x534A}, {0x534C, 0x534D}, {0x5351, 0x5354}, {0x5357, 0x5357},
+    {0x535A, 0x535A}, {0x535C, 0x535C}, {0x535E, 0x535E}, {0x5360, 0x5361}, {0x5363, 0x5363}, {0x5366, 0x5366},
+    {0x536C, 0x536C}, {0x536E, 0x5373}, {0x5375, 0x5375}, {0x5377, 0x5379}, {0x537B, 0x537C}, {0x537F, 0x537F},
+    {0x5382, 0x5382}, {0x5384, 0x5384}, {0x538A, 0x538A}, {0x538E, 0x538F}, {0x5392, 0x5392}, {0x5394, 0x5394},
+    {0x5396, 0x539A}, {0x539C, 0x539F}, {0x53A4, 0x53A5}, {0x53A7, 0x53A7}, {0x53AC, 0x53AD}, {0x53B2, 0x53B2},
+    {0x53B4, 0x53B4}, {0x53B9, 0x53B9}, {0x53BB, 0x53BB}, {0x53C3, 0x53C3}, {0x53C8, 0x53CB}, {0x53CD, 0x53CD},
+    {0x53D4, 0x53D4}, {0x53D6, 0x53D7}, {0x53DB, 0x53DB}, {0x53DF, 0x53DF}, {0x53E1, 0x53E6}, {0x53E8, 0x53F3},
+    {0x53F5, 0x53F5}, {0x53F8, 0x53F8}, {0x53FB, 0x53FC}, {0x5401, 0x5401}, {0x5403, 0x5404}, {0x5406, 0x5412},
+    {0x5418, 0x5419}, {0x541B, 0x5420}, {0x5424, 0x542E}, {0x5430, 0x5431}, {0x5433, 0x5433}, {0x5435, 0x5439},
+    {0x543B, 0x543E}, {0x5440, 0x5443}, {0x5445, 0x5448}, {0x544A, 0x544A}, {0x544E, 0x544F}, {0x5454, 0x5454},
+    {0x5460, 0x5468}, {0x546B, 0x546C}, {0x546F, 0x5478}, {0x547A, 0x5482}, {0x5484, 0x5484}, {0x5486, 0x5488},
+    {0x548B, 0x548E}, {0x5490, 0x5492}, {0x5495, 0x5496}, {0x5498, 0x5498}, {0x549A, 0x549A}, {0x54A0, 0x54A2},
+    {0x54A5, 0x54B1}, {0x54B3, 0x54B3}, {0x54B6, 0x54B8}, {0x54BA, 0x54C9}, {0x54CE, 0x54CF}, {0x54D6, 0x54D6},
+    {0x54DE, 0x54DE}, {0x54E0, 0x54E2}, {0x54E4, 0x54EB}, {0x54ED, 0x54EE}, {0x54F1, 0x54F3}, {0x54F7, 0x54F8},
+    {0x54FA, 0x54FD}, {0x54FF, 0x54FF}, {0x5501, 0x5501}, {0x5503, 0x550C}, {0x550E, 0x5512}, {0x5514, 0x5514},
+    {0x5517, 0x5517}, {0x551A, 0x551A}, {0x5526, 0x5527}, {0x552A, 0x552A}, {0x552C, 0x5539}, {0x553B, 0x553C},
+    {0x553E, 0x553E}, {0x5540, 0x5541}, {0x5543, 0x5546}, {0x5548, 0x5548}, {0x554A, 0x554B}, {0x554D, 0x5552},
+    {0x5555, 0x5557}, {0x555C, 0x555C}, {0x555E, 0x555F}, {0x5561, 0x5566}, {0x556A, 0x556A}, {0x5575, 0x5577},
+    {0x557B, 0x5584}, {0x5587, 0x558F}, {0x5591, 0x5595}, {0x5598, 0x559A}, {0x559C, 0x559D}, {0x559F, 0x559F},
+    {0x55A1, 0x55A8}, {0x55AA, 0x55AE}, {0x55B1, 0x55B3}, {0x55B5, 0x55B5}, {0x55BB, 0x55BB}, {0x55BF, 0x55C0},
+    {0x55C2, 0x55D6}, {0x55D9, 0x55DD}, {0x55DF, 0x55DF}, {0x55E1, 0x55E9}, {0x55EF, 0x55EF}, {0x55F2, 0x55F2},
+    {0x55F6, 0x55F7}, {0x55F9, 0x55FA}, {0x55FC, 0x5602}, {0x5604, 0x5604}, {0x5606, 0x5606}, {0x5608, 0x5609},
+    {0x560C, 0x5610}, {0x5612, 0x5617}, {0x561B, 0x561D}, {0x561F, 0x561F}, {0x5627, 0x5627}, {0x5629, 0x562A},
+    {0x562C, 0x562C}, {0x562E, 0x5630}, {0x5632, 0x5636}, {0x5638, 0x563B}, {0x563D, 0x5642}, {0x5645, 0x5646},
+    {0x5648, 0x564A}, {0x564C, 0x564C}, {0x564E, 0x564E}, {0x5653, 0x5653}, {0x5657, 0x565A}, {0x565E, 0x565E},
+    {0x5660, 0x5660}, {0x5662, 0x5666}, {0x5668, 0x5674}, {0x5676, 0x5679}, {0x567E, 0x5687}, {0x568C, 0x5690},
+    {0x5693, 0x5693}, {0x5695, 0x5695}, {0x5697, 0x569A}, {0x569C, 0x569D}, {0x56A5, 0x56A8}, {0x56AA, 0x56AE},
+    {0x56B2, 0x56B7}, {0x56BC, 0x56BE}, {0x56C0, 0x56C3}, {0x56C5, 0x56C6}, {0x56C8, 0x56CD}, {0x56D1, 0x56D1},
+    {0x56D3, 0x56D4}, {0x56D7, 0x56D7}, {0x56DA, 0x56DB}, {0x56DD, 0x56E1}, {0x56E4, 0x56E5}, {0x56E7, 0x56E7},
+    {0x56EA, 0x56EB}, {0x56EE, 0x56EE}, {0x56F0, 0x56F0}, {0x56F7, 0x56F7}, {0x56F9, 0x56FA}, {0x56FF, 0x56FF},
+    {0x5701, 0x5704}, {0x5707, 0x570D}, {0x5712, 0x5714}, {0x5716, 0x5716}, {0x5718, 0x5718}, {0x571A, 0x571C},
+    {0x571E, 0x5720}, {0x5722, 0x5723}, {0x5728, 0x572A}, {0x572C, 0x5730}, {0x5733, 0x5734}, {0x573B, 0x573B},
+    {0x573E, 0x573E}, {0x5740, 0x5741}, {0x5745, 0x5745}, {0x5747, 0x5747}, {0x5749, 0x5752}, {0x5761, 0x5762},
+    {0x5764, 0x5764}, {0x5766, 0x5766}, {0x5768, 0x576B}, {0x576D, 0x576D}, {0x576F, 0x5777}, {0x577B, 0x577D},
+    {0x5780, 0x5780}, {0x5782, 0x5783}, {0x578B, 0x578C}, {0x578F, 0x578F}, {0x5793, 0x5795}, {0x5797, 0x579B},
+    {0x579D, 0x57A0}, {0x57A2, 0x57A5}, {0x57AE, 0x57AE}, {0x57B5, 0x57B6}, {0x57B8, 0x57BA}, {0x57BC, 0x57BD},
+    {0x57BF, 0x57BF}, {0x57C1, 0x57C3}, {0x57C6, 0x57C7}, {0x57CB, 0x57CC}, {0x57CE, 0x57D0}, {0x57D2, 0x57D2},
+    {0x57D4, 0x57D5}, {0x57DC, 0x57DC}, {0x57DF, 0x57E5}, {0x57E7, 0x57E7}, {0x57E9, 0x57E9}, {0x57EC, 0x57EE},
+    {0x57F0, 0x57FD}, {0x5800, 0x5802}, {0x5804, 0x580E}, {0x5810, 0x5810}, {0x5814, 0x5814}, {0x5819, 0x5819},
+    {0x581B, 0x581E}, {0x5820, 0x5821}, {0x5823, 0x5825}, {0x5827, 0x582A}, {0x582C, 0x5839}, {0x583B, 0x583B},
+    {0x583D, 0x583D}, {0x583F, 0x583F}, {0x5848, 0x584F}, {0x5851, 0x5855}, {0x5857, 0x585B}, {0x585D, 0x585E},
+    {0x5862, 0x5865}, {0x5868, 0x5868}, {0x586B, 0x586B}, {0x586D, 0x586D}, {0x586F, 0x586F}, {0x5871, 0x5871},
+    {0x5874, 0x5876}, {0x5879, 0x5883}, {0x5885, 0x588B}, {0x588E, 0x5891}, {0x5893, 0x5894}, {0x5898, 0x5898},
+    {0x589C, 0x58A1}, {0x58A3, 0x58A3}, {0x58A5, 0x58A6}, {0x58A8, 0x58A9}, {0x58AB, 0x58AC}, {0x58AE, 0x58AF},
+    {0x58B1, 0x58B1}, {0x58B3, 0x58B3}, {0x58BA, 0x58BA}, {0x58BC, 0x58BF}, {0x58C1, 0x58C2}, {0x58C5, 0x58C9},
+    {0x58CE, 0x58CF}, {0x58D1, 0x58D6}, {0x58D8, 0x58DB}, {0x58DD, 0x58DF}, {0x58E2, 0x58E4}, {0x58E7, 0x58E9},
+    {0x58EB, 0x58EC}, {0x58EF, 0x58EF}, {0x58F4, 0x58F4}, {0x58F9, 0x58FA}, {0x58FC, 0x58FF}, {0x5903, 0x5903},
+    {0x5906, 0x5906}, {0x590C, 0x590F}, {0x5912, 0x5912}, {0x5914, 0x5917}, {0x5919, 0x591A}, {0x591C, 0x591C},
+    {0x5920, 0x5920}, {0x5922, 0x5922}, {0x5924, 0x5925}, {0x5927, 0x5927}, {0x5929, 0x592F}, {0x5931, 0x5931},
+    {0x5937, 0x5938}, {0x593C, 0x593C}, {0x593E, 0x593E}, {0x5940, 0x5940}, {0x5944, 0x5945}, {0x5947, 0x594A},
+    {0x594E, 0x5951}, {0x5953, 0x5955}, {0x5957, 0x5958}, {0x595A, 0x595A}, {0x595C, 0x595C}, {0x5960, 0x5962},
+    {0x5967, 0x5967}, {0x5969, 0x596B}, {0x596D, 0x596E}, {0x5970, 0x5974}, {0x5976, 0x5979}, {0x597B, 0x5985},
+    {0x598A, 0x598A}, {0x598D, 0x5990}, {0x5992, 0x5993}, {0x5996, 0x5999}, {0x599D, 0x599E}, {0x59A0, 0x59A8},
+    {0x59AE, 0x59AF}, {0x59B1, 0x59B6}, {0x59B9, 0x59BE}, {0x59C0, 0x59C1}, {0x59C3, 0x59C3}, {0x59C5, 0x59C8},
+    {0x59CA, 0x59D4}, {0x59D6, 0x59D6}, {0x59D8, 0x59D8}, {0x59DA, 0x59DE}, {0x59E0, 0x59E1}, {0x59E3, 0x59E6},
+    {0x59E8, 0x59EA}, {0x59EC, 0x59EE}, {0x59F1, 0x59F7}, {0x59FA, 0x5A01}, {0x5A03, 0x5A03}, {0x5A09, 0x5A0A},
+    {0x5A0C, 0x5A0C}, {0x5A0F, 0x5A0F}, {0x5A11, 0x5A11}, {0x5A13, 0x5A13}, {0x5A15, 0x5A19}, {0x5A1B, 0x5A1C},
+    {0x5A1E, 0x5A20}, {0x5A23, 0x5A23}, {0x5A25, 0x5A25}, {0x5A29, 0x5A29}, {0x5A2D, 0x5A2E}, {0x5A33, 0x5A33},
+    {0x5A35, 0x5A39}, {0x5A3C, 0x5A3C}, {0x5A3E, 0x5A3E}, {0x5A40, 0x5A44}, {0x5A46, 0x5A4A}, {0x5A4C, 0x5A4D},
+    {0x5A50, 0x5A53}, {0x5A55, 0x5A58}, {0x5A5A, 0x5A60}, {0x5A62, 0x5A62}, {0x5A64, 0x5A67}, {0x5A69, 0x5A6A},
+    {0x5A6C, 0x5A6D}, {0x5A70, 0x5A70}, {0x5A77, 0x5A78}, {0x5A7A, 0x5A7D}, {0x5A7F, 0x5A7F}, {0x5A83, 0x5A84},
+    {0x5A8A, 0x5A8C}, {0x5A8E, 0x5A90}, {0x5A92, 0x5A95}, {0x5A97, 0x5A97}, {0x5A9A, 0x5A9F}, {0x5AA2, 0x5AA2},
+    {0x5AA5, 0x5AA7}, {0x5AA9, 0x5AA9}, {0x5AAC, 0x5AAC}, {0x5AAE, 0x5AC2}, {0x5AC4, 0x5AC4}, {0x5AC6, 0x5ACD},
+    {0x5AD5, 0x5AE3}, {0x5AE5, 0x5AE6}, {0x5AE8, 0x5AEE}, {0x5AF3, 0x5AF9}, {0x5AFB, 0x5AFB}, {0x5AFD, 0x5AFD},
+    {0x5AFF, 0x5AFF}, {0x5B01, 0x5B03}, {0x5B05, 0x5B05}, {0x5B07, 0x5B09}, {0x5B0B, 0x5B0C}, {0x5B0F, 0x5B10},
+    {0x5B13, 0x5B14}, {0x5B16, 0x5B17}, {0x5B19, 0x5B1B}, {0x5B1D, 0x5B1E}, {0x5B20, 0x5B21}, {0x5B23, 0x5B28},
+    {0x5B2A, 0x5B2A}, {0x5B2C, 0x5B30}, {0x5B32, 0x5B32}, {0x5B34, 0x5B34}, {0x5B38, 0x5B38}, {0x5B3C, 0x5B40},
+    {0x5B43, 0x5B43}, {0x5B45, 0x5B45}, {0x5B47, 0x5B48}, {0x5B4B, 0x5B4E}, {0x5B50, 0x5B51}, {0x5B53, 0x5B58},
+    {0x5B5A, 0x5B5D}, {0x5B5F, 0x5B5F}, {0x5B62, 0x5B65}, {0x5B69, 0x5B69}, {0x5B6B, 0x5B6C}, {0x5B6E, 0x5B6E},
+    {0x5B70, 0x5B73}, {0x5B75, 0x5B75}, {0x5B77, 0x5B78}, {0x5B7A, 0x5B7B}, {0x5B7D, 0x5B7D}, {0x5B7F, 0x5B7F},
+    {0x5B81, 0x5B81}, {0x5B83, 0x5B85}, {0x5B87, 0x5B89}, {0x5B8B, 0x5B8C}, {0x5B8E, 0x5B8F}, {0x5B92, 0x5B93},
+    {0x5B95, 0x5B95}, {0x5B97, 0x5B9C}, {0x5BA2, 0x5BA8}, {0x5BAC, 0x5BAE}, {0x5BB0, 0x5BB0}, {0x5BB3, 0x5BB6},
+    {0x5BB8, 0x5BB9}, {0x5BBF, 0x5BC2}, {0x5BC4, 0x5BC7}, {0x5BCA, 0x5BCE}, {0x5BD0, 0x5BD4}, {0x5BD6, 0x5BD6},
+    {0x5BD8, 0x5BD9}, {0x5BDE, 0x5BEC}, {0x5BEE, 0x5BF2}, {0x5BF5, 0x5BF6}, {0x5BF8, 0x5BF8}, {0x5BFA, 0x5BFA},
+    {0x5C01, 0x5C01}, {0x5C03, 0x5C04}, {0x5C07, 0x5C12}, {0x5C15, 0x5C16}, {0x5C1A, 0x5C1A}, {0x5C1F, 0x5C1F},
+    {0x5C22, 0x5C22}, {0x5C24, 0x5C25}, {0x5C28, 0x5C28}, {0x5C2A, 0x5C2A}, {0x5C2C, 0x5C2C}, {0x5C30, 0x5C31},
+    {0x5C33, 0x5C33}, {0x5C37, 0x5C3C}, {0x5C3E, 0x5C41}, {0x5C44, 0x5C48}, {0x5C4B, 0x5C51}, {0x5C54, 0x5C56},
+    {0x5C58, 0x5C59}, {0x5C5C, 0x5C5D}, {0x5C60, 0x5C60}, {0x5C62, 0x5C65}, {0x5C67, 0x5C6A}, {0x5C6C, 0x5C6F},
+    {0x5C71, 0x5C71}, {0x5C73, 0x5C74}, {0x5C79, 0x5C7C}, {0x5C7E, 0x5C7E}, {0x5C86, 0x5C86}, {0x5C88, 0x5C8D},
+    {0x5C8F, 0x5C95}, {0x5C9D, 0x5C9D}, {0x5C9F, 0x5CB1}, {0x5CB3, 0x5CB3}, {0x5CB5, 0x5CB8}, {0x5CC6, 0x5CCC},
+    {0x5CCE, 0x5CD0}, {0x5CD2, 0x5CD4}, {0x5CD6, 0x5CDB}, {0x5CDE, 0x5CDF}, {0x5CE8, 0x5CE8}, {0x5CEA, 0x5CEA},
+    {0x5CEC, 0x5CEE}, {0x5CF0, 0x5CF1}, {0x5CF4, 0x5CF4}, {0x5CF6, 0x5CF9}, {0x5CFB, 0x5CFB}, {0x5CFD, 0x5CFD},
+    {0x5CFF, 0x5D01}, {0x5D06, 0x5D07}, {0x5D0B, 0x5D0F}, {0x5D11, 0x5D12}, {0x5D14, 0x5D14}, {0x5D16, 0x5D17},
+    {0x5D19, 0x5D1B}, {0x5D1D, 0x5D20}, {0x5D22, 0x5D29}, {0x5D2E, 0x5D2E}, {0x5D30, 0x5D3A}, {0x5D3C, 0x5D3D},
+    {0x5D3F, 0x5D43}, {0x5D45, 0x5D45}, {0x5D47, 0x5D47}, {0x5D49, 0x5D4C}, {0x5D4E, 0x5D4E}, {0x5D50, 0x5D52},
+    {0x5D55, 0x5D55}, {0x5D59, 0x5D59}, {0x5D5E, 0x5D5E}, {0x5D62, 0x5D63}, {0x5D65, 0x5D65}, {0x5D67, 0x5D69},
+    {0x5D6B, 0x5D6C}, {0x5D6F, 0x5D6F}, {0x5D71, 0x5D72}, {0x5D77, 0x5D77}, {0x5D79, 0x5D7A}, {0x5D7C, 0x5D82},
+    {0x5D84, 0x5D84}, {0x5D86, 0x5D8A}, {0x5D8D, 0x5D8D}, {0x5D92, 0x5D95}, {0x5D97, 0x5D97}, {0x5D99, 0x5D9A},
+    {0x5D9C, 0x5DA2}, {0x5DA7, 0x5DAA}, {0x5DAC, 0x5DB2}, {0x5DB4, 0x5DB5}, {0x5DB7, 0x5DB8}, {0x5DBA, 0x5DBA},
+    {0x5DBC, 0x5DBD}, {0x5DC0, 0x5DC0}, {0x5DC2, 0x5DC3}, {0x5DC6, 0x5DC7}, {0x5DC9, 0x5DC9}, {0x5DCB, 0x5DCB},
+    {0x5DCD, 0x5DCD}, {0x5DCF, 0x5DCF}, {0x5DD1, 0x5DD2}, {0x5DD4, 0x5DD6}, {0x5DD8, 0x5DD8}, {0x5DDD, 0x5DE2},
+    {0x5DE5, 0x5DE8}, {0x5DEB, 0x5DEB}, {0x5DEE, 0x5DEE}, {0x5DF0, 0x5DF4}, {0x5DF7, 0x5DF7}, {0x5DF9, 0x5DF9},
+    {0x5DFD, 0x5DFF}, {0x5E02, 0x5E04}, {0x5E06, 0x5E06}, {0x5E0A, 0x5E0A}, {0x5E0C, 0x5E0C}, {0x5E0E, 0x5E0E},
+    {0x5E11, 0x5E11}, {0x5E14, 0x5E1B}, {0x5E1D, 0x5E1D}, {0x5E1F, 0x5E25}, {0x5E28, 0x5E29}, {0x5E2B, 0x5E2B},
+    {0x5E2D, 0x5E2D}, {0x5E33, 0x5E34}, {0x5E36, 0x5E38}, {0x5E3D, 0x5E3E}, {0x5E40, 0x5E41}, {0x5E43, 0x5E45},
+    {0x5E4A, 0x5E4F}, {0x5E53, 0x5E55}, {0x5E57, 0x5E59}, {0x5E5B, 0x5E5D}, {0x5E5F, 0x5E63}, {0x5E66, 0x5E70},
+    {0x5E72, 0x5E76}, {0x5E78, 0x5E79}, {0x5E7B, 0x5E7E}, {0x5E80, 0x5E80}, {0x5E82, 0x5E82}, {0x5E84, 0x5E84},
+    {0x5E87, 0x5E8D}, {0x5E8F, 0x5E8F}, {0x5E95, 0x5E97}, {0x5E9A, 0x5E9C}, {0x5EA0, 0x5EA0}, {0x5EA2, 0x5EA8},
+    {0x5EAA, 0x5EAE}, {0x5EB0, 0x5EB9}, {0x5EBE, 0x5EBE}, {0x5EC1, 0x5EC2}, {0x5EC4, 0x5ECC}, {0x5ECE, 0x5ECE},
+    {0x5ED1, 0x5EE3}, {0x5EE5, 0x5EE9}, {0x5EEC, 0x5EEC}, {0x5EEE, 0x5EEF}, {0x5EF1, 0x5EF3}, {0x5EF6, 0x5EF7},
+    {0x5EFA, 0x5EFA}, {0x5EFE, 0x5EFF}, {0x5F01, 0x5F02}, {0x5F04, 0x5F05}, {0x5F07, 0x5F08}, {0x5F0A, 0x5F0B},
+    {0x5F0F, 0x5F0F}, {0x5F12, 0x5F15}, {0x5F17, 0x5F18}, {0x5F1A, 0x5F1B}, {0x5F1D, 0x5F1D}, {0x5F1F, 0x5F1F},
+    {0x5F22, 0x5F24}, {0x5F26, 0x5F29}, {0x5F2D, 0x5F2E}, {0x5F30, 0x5F31}, {0x5F33, 0x5F33}, {0x5F35, 0x5F38},
+    {0x5F3C, 0x5F3C}, {0x5F40, 0x5F40}, {0x5F43, 0x5F44}, {0x5F46, 0x5F46}, {0x5F48, 0x5F4C}, {0x5F4E, 0x5F4F},
+    {0x5F54, 0x5F54}, {0x5F56, 0x5F59}, {0x5F5D, 0x5F5D}, {0x5F62, 0x5F62}, {0x5F64, 0x5F65}, {0x5F67, 0x5F67},
+    {0x5F69, 0x5F6D}, {0x5F6F, 0x5F71}, {0x5F73, 0x5F74}, {0x5F76, 0x5F79}, {0x5F7C, 0x5F82}, {0x5F85, 0x5F8C},
+    {0x5F90, 0x5F92}, {0x5F96, 0x5F99}, {0x5F9B, 0x5F9C}, {0x5F9E, 0x5FA1}, {0x5FA5, 0x5FA6}, {0x5FA8, 0x5FAF},
+    {0x5FB2, 0x5FB2}, {0x5FB5, 0x5FB7}, {0x5FB9, 0x5FB9}, {0x5FBB, 0x5FC1}, {0x5FC3, 0x5FC3}, {0x5FC5, 0x5FC5},
+    {0x5FC9, 0x5FC9}, {0x5FCC, 0x5FCD}, {0x5FCF, 0x5FD2}, {0x5FD4, 0x5FD9}, {0x5FDD, 0x5FDE}, {0x5FE0, 0x5FE1},
+    {0x5FE3, 0x5FE5}, {0x5FE8, 0x5FE8}, {0x5FEA, 0x5FEB}, {0x5FED, 0x5FEF}, {0x5FF1, 0x5FF1}, {0x5FF3, 0x5FF5},
+    {0x5FF7, 0x5FF8}, {0x5FFA, 0x5FFB}, {0x5FFD, 0x5FFD}, {0x5FFF, 0x6000}, {0x6009, 0x6017}, {0x6019, 0x601E},
+    {0x6020, 0x6022}, {0x6024, 0x602F}, {0x6032, 0x6035}, {0x6037, 0x6037}, {0x6039, 0x6039}, {0x6040, 0x6047},
+    {0x6049, 0x6049}, {0x604C, 0x604D}, {0x6050, 0x6050}, {0x6053, 0x6055}, {0x6058, 0x605B}, {0x605D, 0x605F},
+    {0x6062, 0x6070}, {0x6072, 0x6072}, {0x607F, 0x6081}, {0x6083, 0x608A}, {0x608C, 0x608E}, {0x6090, 0x6090},
+    {0x6092, 0x6092}, {0x6094, 0x6097}, {0x609A, 0x609D}, {0x609F, 0x60A0}, {0x60A2, 0x60A3}, {0x60A8, 0x60A8},
+    {0x60B0, 0x60B2}, {0x60B4, 0x60C1}, {0x60C3, 0x60CF}, {0x60D1, 0x60D1}, {0x60D3, 0x60D5}, {0x60D8, 0x60DD},
+    {0x60DF, 0x60E2}, {0x60E4, 0x60E4}, {0x60E6, 0x60E6}, {0x60F0, 0x60FC}, {0x60FE, 0x6101}, {0x6103, 0x6106},
+    {0x6108, 0x610B}, {0x610D, 0x6110}, {0x6112, 0x6116}, {0x6118, 0x6118}, {0x611A, 0x611D}, {0x611F, 0x611F},
+    {0x6123, 0x6123}, {0x6127, 0x6129}, {0x612B, 0x612C}, {0x612E, 0x612F}, {0x6132, 0x6132}, {0x6134, 0x6134},
+    {0x6136, 0x6137}, {0x613B, 0x613B}, {0x613E, 0x6141}, {0x6144, 0x614F}, {0x6152, 0x6156}, {0x6158, 0x6158},
+    {0x615A, 0x615B}, {0x615D, 0x615F}, {0x6161, 0x6163}, {0x6165, 0x6168}, {0x616A, 0x616C}, {0x616E, 0x616E},
+    {0x6170, 0x6177}, {0x6179, 0x617A}, {0x617C, 0x617C}, {0x617E, 0x617E}, {0x6180, 0x6180}, {0x6182, 0x6183},
+    {0x6189, 0x618E}, {0x6190, 0x6194}, {0x6196, 0x6196}, {0x619A, 0x619B}, {0x619D, 0x619D}, {0x619F, 0x619F},
+    {0x61A1, 0x61A2}, {0x61A4, 0x61A4}, {0x61A7, 0x61B6}, {0x61B8, 0x61B8}, {0x61BA, 0x61BA}, {0x61BC, 0x61BC},
+    {0x61BE, 0x61BF}, {0x61C1, 0x61C3}, {0x61C5, 0x61CD}, {0x61D6, 0x61D6}, {0x61D8, 0x61D8}, {0x61DE, 0x61E0},
+    {0x61E3, 0x61EB}, {0x61ED, 0x61EE}, {0x61F0, 0x61F2}, {0x61F5, 0x6201}, {0x6203, 0x6204}, {0x6207, 0x620A},
+    {0x620C, 0x620E}, {0x6210, 0x6212}, {0x6214, 0x6216}, {0x6219, 0x621B}, {0x621F, 0x6225}, {0x6227, 0x6227},
+    {0x6229, 0x622B}, {0x622D, 0x622E}, {0x6230, 0x6230}, {0x6232, 0x6234}, {0x6236, 0x6236}, {0x623A, 0x623A},
+    {0x623D, 0x6243}, {0x6246, 0x624B}, {0x624D, 0x624E}, {0x6250, 0x6254}, {0x6258, 0x625C}, {0x625E, 0x625E},
+    {0x6260, 0x6266}, {0x626D, 0x6274}, {0x6276, 0x6277}, {0x6279, 0x6281}, {0x6283, 0x6284}, {0x6286, 0x628A},
+    {0x628C, 0x628C}, {0x628E, 0x628F}, {0x6291, 0x6298}, {0x62A8, 0x62B1}, {0x62B3, 0x62B6}, {0x62B8, 0x62B9},
+    {0x62BB, 0x62BF}, {0x62C2, 0x62C2}, {0x62C4, 0x62C4}, {0x62C6, 0x62D4}, {0x62D6, 0x62DC}, {0x62EB, 0x6303},
+    {0x6307, 0x6309}, {0x630B, 0x6311}, {0x6313, 0x6316}, {0x6328, 0x632D}, {0x632F, 0x632F}, {0x6332, 0x6334},
+    {0x6336, 0x6336}, {0x6338, 0x633E}, {0x6340, 0x6351}, {0x6354, 0x635A}, {0x6365, 0x6365}, {0x6367, 0x6369},
+    {0x636B, 0x636B}, {0x636D, 0x6372}, {0x6375, 0x6378}, {0x637A, 0x637D}, {0x6380, 0x6385}, {0x6387, 0x638A},
+    {0x638C, 0x6392}, {0x6394, 0x6394}, {0x6396, 0x6399}, {0x639B, 0x63A5}, {0x63A7, 0x63B1}, {0x63BD, 0x63BE},
+    {0x63C0, 0x63C0}, {0x63C2, 0x63D0}, {0x63D2, 0x63D3}, {0x63D5, 0x63DD}, {0x63DF, 0x63E1}, {0x63E3, 0x63E5},
+    {0x63E7, 0x63EB}, {0x63ED, 0x63F6}, {0x63F9, 0x63F9}, {0x6406, 0x6406}, {0x6409, 0x6410}, {0x6412, 0x6418},
+    {0x641A, 0x641C}, {0x641E, 0x6428}, {0x642A, 0x6430}, {0x6433, 0x6437}, {0x6439, 0x6439}, {0x643D, 0x6441},
+    {0x6443, 0x6443}, {0x644B, 0x644B}, {0x644D, 0x644E}, {0x6450, 0x6454}, {0x6458, 0x6459}, {0x645B, 0x6461},
+    {0x6465, 0x6469}, {0x646B, 0x6470}, {0x6472, 0x647B}, {0x647D, 0x647D}, {0x647F, 0x647F}, {0x6482, 0x6482},
+    {0x6485, 0x6485}, {0x6487, 0x648C}, {0x648F, 0x6490}, {0x6492, 0x6493}, {0x6495, 0x649A}, {0x649C, 0x64A0},
+    {0x64A2, 0x64A6}, {0x64A9, 0x64A9}, {0x64AB, 0x64AE}, {0x64B0, 0x64B3}, {0x64BB, 0x64BF}, {0x64C1, 0x64C5},
+    {0x64C7, 0x64C7}, {0x64C9, 0x64CB}, {0x64CD, 0x64D0}, {0x64D2, 0x64D2}, {0x64D4, 0x64D4}, {0x64D6, 0x64DB},
+    {0x64E0, 0x64E0}, {0x64E2, 0x64E4}, {0x64E6, 0x64E6}, {0x64E8, 0x64E9}, {0x64EB, 0x64ED}, {0x64EF, 0x64F4},
+    {0x64F7, 0x64F8}, {0x64FA, 0x6501}, {0x6503, 0x6504}, {0x6506, 0x6507}, {0x6509, 0x6509}, {0x650C, 0x6510},
+    {0x6513, 0x6519}, {0x651B, 0x651D}, {0x6520, 0x6526}, {0x6529, 0x652F}, {0x6532, 0x6533}, {0x6536, 0x6539},
+    {0x653B, 0x653B}, {0x653D, 0x653F}, {0x6541, 0x6541}, {0x6543, 0x6543}, {0x6545, 0x6546}, {0x6548, 0x654A},
+    {0x654F, 0x654F}, {0x6551, 0x6551}, {0x6553, 0x6559}, {0x655C, 0x655E}, {0x6562, 0x6568}, {0x656A, 0x656A},
+    {0x656C, 0x656C}, {0x656F, 0x656F}, {0x6572, 0x657C}, {0x657F, 0x6584}, {0x6587, 0x6587}, {0x658C, 0x658C},
+    {0x6590, 0x6592}, {0x6594, 0x6597}, {0x6599, 0x6599}, {0x659B, 0x65A2}, {0x65A4, 0x65A5}, {0x65A7, 0x65A8},
+    {0x65AA, 0x65AC}, {0x65AE, 0x65B0}, {0x65B2, 0x65B3}, {0x65B6, 0x65B9}, {0x65BB, 0x65BD}, {0x65BF, 0x65BF},
+    {0x65C1, 0x65C6}, {0x65CB, 0x65D0}, {0x65D2, 0x65D3}, {0x65D6, 0x65D7}, {0x65DA, 0x65DB}, {0x65DD, 0x65DF},
+    {0x65E1, 0x65E2}, {0x65E5, 0x65E6}, {0x65E8, 0x65E9}, {0x65EC, 0x65F5}, {0x65FA, 0x65FD}, {0x6600, 0x6600},
+    {0x6602, 0x6615}, {0x661C, 0x661D}, {0x661F, 0x6622}, {0x6624, 0x6628}, {0x662B, 0x662B}, {0x662D, 0x662F},
+    {0x6631, 0x6636}, {0x6639, 0x663A}, {0x6641, 0x6643}, {0x6645, 0x6645}, {0x6647, 0x6647}, {0x6649, 0x664A},
+    {0x664C, 0x664C}, {0x664F, 0x664F}, {0x6651, 0x6652}, {0x6659, 0x665F}, {0x6661, 0x6662}, {0x6664, 0x6666},
+    {0x6668, 0x6668}, {0x666A, 0x666A}, {0x666C, 0x666C}, {0x666E, 0x6672}, {0x6674, 0x6674}, {0x6676, 0x667C},
+    {0x667E, 0x667E}, {0x6680, 0x6680}, {0x6684, 0x6684}, {0x6686, 0x668D}, {0x6690, 0x6691}, {0x6694, 0x6699},
+    {0x669D, 0x669D}, {0x669F, 0x66A2}, {0x66A8, 0x66AB}, {0x66AE, 0x66B2}, {0x66B4, 0x66B5}, {0x66B7, 0x66BB},
+    {0x66BD, 0x66BE}, {0x66C0, 0x66C0}, {0x66C4, 0x66C4}, {0x66C6, 0x66CC}, {0x66CF, 0x66CF}, {0x66D2, 0x66D2},
+    {0x66D6, 0x66D6}, {0x66D8, 0x66DE}, {0x66E0, 0x66E0}, {0x66E3, 0x66E4}, {0x66E6, 0x66E6}, {0x66E8, 0x66E9},
+    {0x66EB, 0x66EE}, {0x66F0, 0x66F0}, {0x66F2, 0x66F4}, {0x66F6, 0x66F9}, {0x66FC, 0x66FC}, {0x66FE, 0x6701},
+    {0x6703, 0x6705}, {0x6708, 0x670B}, {0x670D, 0x670D}, {0x670F, 0x6710}, {0x6712, 0x6715}, {0x6717, 0x6718},
+    {0x671B, 0x671B}, {0x671D, 0x671D}, {0x671F, 0x6723}, {0x6726, 0x6728}, {0x672A, 0x672E}, {0x6731, 0x6731},
+    {0x6733, 0x6735}, {0x6738, 0x673F}, {0x6745, 0x6749}, {0x674B, 0x6751}, {0x6753, 0x6753}, {0x6755, 0x6757},
+    {0x6759, 0x675A}, {0x675C, 0x6760}, {0x676A, 0x676A}, {0x676C, 0x676D}, {0x676F, 0x677F}, {0x6781, 0x6781},
+    {0x6783, 0x6787}, {0x6789, 0x6789}, {0x678B, 0x678E}, {0x6790, 0x6795}, {0x6797, 0x679A}, {0x679C, 0x679D},
+    {0x679F, 0x679F}, {0x67AE, 0x67B0}, {0x67B2, 0x67BB}, {0x67C0, 0x67C6}, {0x67C8, 0x67D4}, {0x67D8, 0x67DF},
+    {0x67E2, 0x67E7}, {0x67E9, 0x67F8}, {0x67FA, 0x67FA}, {0x67FC, 0x67FC}, {0x67FF, 0x67FF}, {0x6812, 0x6814},
+    {0x6816, 0x6818}, {0x681A, 0x681A}, {0x681C, 0x681D}, {0x681F, 0x6821}, {0x6825, 0x6826}, {0x6828, 0x682B},
+    {0x682D, 0x682F}, {0x6831, 0x6835}, {0x6838, 0x683D}, {0x6840, 0x6846}, {0x6848, 0x6849}, {0x684B, 0x6851},
+    {0x6853, 0x6854}, {0x686B, 0x686B}, {0x686D, 0x686F}, {0x6871, 0x6872}, {0x6874, 0x6879}, {0x687B, 0x6883},
+    {0x6885, 0x6887}, {0x6889, 0x688C}, {0x688F, 0x6894}, {0x6896, 0x6897}, {0x689B, 0x689D}, {0x689F, 0x68A4},
+    {0x68A7, 0x68B5}, {0x68C4, 0x68C4}, {0x68C6, 0x68C9}, {0x68CB, 0x68CE}, {0x68D0, 0x68D8}, {0x68DA, 0x68DA},
+    {0x68DC, 0x68E1}, {0x68E3, 0x68E4}, {0x68E6, 0x68EC}, {0x68EE, 0x68FD}, {0x6904, 0x6908}, {0x690A, 0x6915},
+    {0x6917, 0x6917}, {0x6925, 0x6925}, {0x692A, 0x692A}, {0x692F, 0x6930}, {0x6932, 0x6935}, {0x6937, 0x6939},
+    {0x693B, 0x693D}, {0x693F, 0x6942}, {0x6944, 0x6945}, {0x6948, 0x694C}, {0x694E, 0x694F}, {0x6951, 0x6954},
+    {0x6956, 0x6960}, {0x6962, 0x6963}, {0x6965, 0x6966}, {0x6968, 0x6971}, {0x6974, 0x697B}, {0x6982, 0x6983},
+    {0x6986, 0x6986}, {0x698D, 0x698E}, {0x6990, 0x6991}, {0x6993, 0x6997}, {0x6999, 0x699C}, {0x699E, 0x699E},
+    {0x69A0, 0x69A1}, {0x69A3, 0x69B1}, {0x69B3, 0x69B7}, {0x69B9, 0x69B9}, {0x69BB, 0x69BF}, {0x69C1, 0x69C4},
+    {0x69C6, 0x69C6}, {0x69C9, 0x69D0}, {0x69D3, 0x69D4}, {0x69D9, 0x69D9}, {0x69E2, 0x69E2}, {0x69E4, 0x69E8},
+    {0x69EB, 0x69EE}, {0x69F1, 0x69F4}, {0x69F6, 0x69F8}, {0x69FB, 0x6A02}, {0x6A04, 0x6A0A}, {0x6A0D, 0x6A0D},
+    {0x6A0F, 0x6A0F}, {0x6A11, 0x6A11}, {0x6A13, 0x6A19}, {0x6A1B, 0x6A1B}, {0x6A1D, 0x6A21}, {0x6A23, 0x6A23},
+    {0x6A25, 0x6A28}, {0x6A32, 0x6A32}, {0x6A34, 0x6A35}, {0x6A38, 0x6A41}, {0x6A44, 0x6A44}, {0x6A46, 0x6A49},
+    {0x6A4B, 0x6A4B}, {0x6A4D, 0x6A51}, {0x6A54, 0x6A56}, {0x6A58, 0x6A5B}, {0x6A5D, 0x6A62}, {0x6A64, 0x6A64},
+    {0x6A66, 0x6A6B}, {0x6A6D, 0x6A6D}, {0x6A6F, 0x6A6F}, {0x6A76, 0x6A76}, {0x6A7E, 0x6A81}, {0x6A83, 0x6A85},
+    {0x6A87, 0x6A87}, {0x6A89, 0x6A89}, {0x6A8C, 0x6A8E}, {0x6A90, 0x6A97}, {0x6A9A, 0x6A9C}, {0x6A9E, 0x6AA6},
+    {0x6AA8, 0x6AA8}, {0x6AAC, 0x6AAF}, {0x6AB3, 0x6AB4}, {0x6AB6, 0x6ABB}, {0x6ABD, 0x6ABD}, {0x6AC2, 0x6AC3},
+    {0x6AC5, 0x6AC7}, {0x6ACB, 0x6ACD}, {0x6ACF, 0x6AD1}, {0x6AD3, 0x6AD3}, {0x6AD9, 0x6AE1}, {0x6AE5, 0x6AE5},
+    {0x6AE7, 0x6AE8}, {0x6AEA, 0x6AEC}, {0x6AEE, 0x6AF1}, {0x6AF3, 0x6AF3}, {0x6AF8, 0x6AFC}, {0x6B00, 0x6B00},
+    {0x6B02, 0x6B04}, {0x6B08, 0x6B0B}, {0x6B0F, 0x6B13}, {0x6B16, 0x6B1A}, {0x6B1E, 0x6B1E}, {0x6B20, 0x6B21},
+    {0x6B23, 0x6B23}, {0x6B25, 0x6B25}, {0x6B28, 0x6B28}, {0x6B2C, 0x6B2D}, {0x6B2F, 0x6B2F}, {0x6B31, 0x6B34},
+    {0x6B36, 0x6B3F}, {0x6B41, 0x6B43}, {0x6B45, 0x6B4E}, {0x6B50, 0x6B51}, {0x6B54, 0x6B56}, {0x6B59, 0x6B59},
+    {0x6B5B, 0x6B5C}, {0x6B5E, 0x6B67}, {0x6B6A, 0x6B6A}, {0x6B6D, 0x6B6D}, {0x6B72, 0x6B72}, {0x6B76, 0x6B79},
+    {0x6B7B, 0x6B7B}, {0x6B7E, 0x6B80}, {0x6B82, 0x6B84}, {0x6B86, 0x6B86}, {0x6B88, 0x6B8A}, {0x6B8C, 0x6B8F},
+    {0x6B91, 0x6B91}, {0x6B94, 0x6B99}, {0x6B9B, 0x6B9B}, {0x6B9E, 0x6BA0}, {0x6BA2, 0x6BA7}, {0x6BAA, 0x6BAB},
+    {0x6BAD, 0x6BB0}, {0x6BB2, 0x6BB3}, {0x6BB5, 0x6BB7}, {0x6BBA, 0x6BBA}, {0x6BBC, 0x6BBD}, {0x6BBF, 0x6BC0},
+    {0x6BC3, 0x6BCD}, {0x6BCF, 0x6BD0}, {0x6BD2, 0x6BD4}, {0x6BD6, 0x6BD8}, {0x6BDA, 0x6BDB}, {0x6BDE, 0x6BDE},
+    {0x6BE0, 0x6BE0}, {0x6BE2, 0x6BE4}, {0x6BE6, 0x6BE8}, {0x6BEB, 0x6BEC}, {0x6BEF, 0x6BF0}, {0x6BF2, 0x6BF3},
+    {0x6BF7, 0x6BF9}, {0x6BFB, 0x6C06}, {0x6C08, 0x6C09}, {0x6C0B, 0x6C0D}, {0x6C0F, 0x6C11}, {0x6C13, 0x6C16},
+    {0x6C18, 0x6C1B}, {0x6C1D, 0x6C1D}, {0x6C1F, 0x6C21}, {0x6C23, 0x6C28}, {0x6C2A, 0x6C2C}, {0x6C2E, 0x6C30},
+    {0x6C33, 0x6C34}, {0x6C36, 0x6C36}, {0x6C38, 0x6C38}, {0x6C3B, 0x6C3B}, {0x6C3E, 0x6C43}, {0x6C46, 0x6C46},
+    {0x6C4A, 0x6C50}, {0x6C52, 0x6C52}, {0x6C54, 0x6C55}, {0x6C57, 0x6C57}, {0x6C59, 0x6C59}, {0x6C5B, 0x6C61},
+    {0x6C65, 0x6C6B}, {0x6C6D, 0x6C6D}, {0x6C6F, 0x6C74}, {0x6C76, 0x6C76}, {0x6C78, 0x6C78}, {0x6C7A, 0x6C7B},
+    {0x6C7D, 0x6C7E}, {0x6C80, 0x6C90}, {0x6C92, 0x6C96}, {0x6C98, 0x6C9D}, {0x6CAB, 0x6CAE}, {0x6CB0, 0x6CB1},
+    {0x6CB3, 0x6CB4}, {0x6CB6, 0x6CC7}, {0x6CC9, 0x6CCA}, {0x6CCC, 0x6CCD}, {0x6CCF, 0x6CD7}, {0x6CD9, 0x6CDE},
+    {0x6CE0, 0x6CE3}, {0x6CE5, 0x6CE5}, {0x6CE7, 0x6CE9}, {0x6CEB, 0x6CF3}, {0x6CF5, 0x6CF5}, {0x6CF9, 0x6CF9},
+    {0x6D00, 0x6D01}, {0x6D03, 0x6D04}, {0x6D07, 0x6D12}, {0x6D16, 0x6D1B}, {0x6D1D, 0x6D20}, {0x6D22, 0x6D22},
+    {0x6D25, 0x6D25}, {0x6D27, 0x6D42}, {0x6D58, 0x6D5A}, {0x6D5E, 0x6D6A}, {0x6D6C, 0x6D70}, {0x6D74, 0x6D80},
+    {0x6D82, 0x6D8E}, {0x6D90, 0x6D95}, {0x6D97, 0x6D98}, {0x6DAA, 0x6DAC}, {0x6DAE, 0x6DAF}, {0x6DB2, 0x6DB5},
+    {0x6DB7, 0x6DB8}, {0x6DBA, 0x6DC0}, {0x6DC2, 0x6DC2}, {0x6DC4, 0x6DCD}, {0x6DCF, 0x6DE6}, {0x6DE8, 0x6DF7},
+    {0x6DF9, 0x6DFD}, {0x6E00, 0x6E00}, {0x6E03, 0x6E03}, {0x6E05, 0x6E05}, {0x6E19, 0x6E1D}, {0x6E1F, 0x6E28},
+    {0x6E2B, 0x6E36}, {0x6E38, 0x6E41}, {0x6E43, 0x6E47}, {0x6E49, 0x6E4B}, {0x6E4D, 0x6E4E}, {0x6E51, 0x6E56},
+    {0x6E58, 0x6E58}, {0x6E5A, 0x6E69}, {0x6E6B, 0x6E6B}, {0x6E6E, 0x6E6F}, {0x6E71, 0x6E74}, {0x6E77, 0x6E79},
+    {0x6E88, 0x6E89}, {0x6E8D, 0x6E90}, {0x6E92, 0x6E94}, {0x6E96, 0x6E99}, {0x6E9B, 0x6EA7}, {0x6EAA, 0x6EAB},
+    {0x6EAE, 0x6EB4}, {0x6EB6, 0x6EB7}, {0x6EB9, 0x6EBA}, {0x6EBC, 0x6ED6}, {0x6ED8, 0x6ED8}, {0x6EDC, 0x6EDC},
+    {0x6EEB, 0x6EEF}, {0x6EF1, 0x6EF2}, {0x6EF4, 0x6EF9}, {0x6EFB, 0x6F03}, {0x6F05, 0x6F0A}, {0x6F0D, 0x6F0F},
+    {0x6F12, 0x6F15}, {0x6F18, 0x6F1A}, {0x6F1C, 0x6F1C}, {0x6F1E, 0x6F23}, {0x6F25, 0x6F27}, {0x6F29, 0x6F33},
+    {0x6F35, 0x6F3C}, {0x6F3E, 0x6F41}, {0x6F43, 0x6F43}, {0x6F4E, 0x6F55}, {0x6F57, 0x6F58}, {0x6F5A, 0x6F5B},
+    {0x6F5D, 0x6F64}, {0x6F66, 0x6F67}, {0x6F69, 0x6F70}, {0x6F72, 0x6F73}, {0x6F76, 0x6F78}, {0x6F7A, 0x6F80},
+    {0x6F82, 0x6F82}, {0x6F84, 0x6F89}, {0x6F8B, 0x6F8E}, {0x6F90, 0x6F90}, {0x6F92, 0x6F97}, {0x6F9E, 0x6F9E},
+    {0x6FA0, 0x6FB4}, {0x6FB6, 0x6FB6}, {0x6FB8, 0x6FBA}, {0x6FBC, 0x6FBD}, {0x6FBF, 0x6FC4}, {0x6FC6, 0x6FCF},
+    {0x6FD4, 0x6FD5}, {0x6FD8, 0x6FD8}, {0x6FDB, 0x6FE4}, {0x6FE6, 0x6FE9}, {0x6FEB, 0x6FF2}, {0x6FF4, 0x6FF4},
+    {0x6FF7, 0x6FF7}, {0x6FFA, 0x6FFC}, {0x6FFE, 0x7001}, {0x7004, 0x7007}, {0x7009, 0x700F}, {0x7011, 0x7011},
+    {0x7014, 0x701D}, {0x701F, 0x7024}, {0x7026, 0x702B}, {0x702F, 0x7035}, {0x7037, 0x703C}, {0x703E, 0x7046},
+    {0x7048, 0x704A}, {0x704C, 0x704C}, {0x7051, 0x7052}, {0x7055, 0x7058}, {0x705A, 0x705B}, {0x705D, 0x7066},
+    {0x7068, 0x706B}, {0x7070, 0x7071}, {0x7074, 0x7074}, {0x7076, 0x7076}, {0x7078, 0x7078}, {0x707A, 0x707A},
+    {0x707C, 0x707D}, {0x7082, 0x7086}, {0x708A, 0x708A}, {0x708E, 0x708E}, {0x7091, 0x7096}, {0x7098, 0x709A},
+    {0x709F, 0x709F}, {0x70A1, 0x70A1}, {0x70A4, 0x70A4}, {0x70A9, 0x70A9}, {0x70AB, 0x70B1}, {0x70B3, 0x70B5},
+    {0x70B7, 0x70B8}, {0x70BA, 0x70BA}, {0x70BE, 0x70BE}, {0x70C5, 0x70C8}, {0x70CA, 0x70CB}, {0x70CD, 0x70CF},
+    {0x70D1, 0x70D4}, {0x70D7, 0x70DA}, {0x70DC, 0x70DE}, {0x70E0, 0x70E2}, {0x70E4, 0x70E4}, {0x70EF, 0x70F0},
+    {0x70F3, 0x70F4}, {0x70F6, 0x70FD}, {0x70FF, 0x7100}, {0x7102, 0x7102}, {0x7104, 0x7104}, {0x7106, 0x7106},
+    {0x7109, 0x710E}, {0x7110, 0x7110}, {0x7113, 0x7113}, {0x7117, 0x7117}, {0x7119, 0x711C}, {0x711E, 0x7123},
+    {0x7125, 0x7126}, {0x7128, 0x7128}, {0x712E, 0x7132}, {0x7136, 0x7136}, {0x713A, 0x713A}, {0x7141, 0x7144},
+    {0x7146, 0x7147}, {0x7149, 0x7149}, {0x714B, 0x714E}, {0x7150, 0x7150}, {0x7152, 0x7154}, {0x7156, 0x7156},
+    {0x7158, 0x715A}, {0x715C, 0x716A}, {0x716C, 0x716C}, {0x716E, 0x716E}, {0x7170, 0x7170}, {0x7172, 0x7172},
+    {0x7178, 0x7178}, {0x717B, 0x717B}, {0x717D, 0x717D}, {0x7180, 0x7182}, {0x7184, 0x7187}, {0x7189, 0x718A},
+    {0x718F, 0x7190}, {0x7192, 0x7192}, {0x7194, 0x7194}, {0x7197, 0x7197}, {0x7199, 0x71A1}, {0x71A4, 0x71A5},
+    {0x71A7, 0x71AA}, {0x71AC, 0x71AC}, {0x71AF, 0x71B3}, {0x71B5, 0x71B5}, {0x71B8, 0x71B9}, {0x71BC, 0x71CB},
+    {0x71CE, 0x71D0}, {0x71D2, 0x71D2}, {0x71D4, 0x71D6}, {0x71D8, 0x71DC}, {0x71DF, 0x71E2}, {0x71E4, 0x71E8},
+    {0x71EC, 0x71EE}, {0x71F0, 0x71F2}, {0x71F4, 0x71F4}, {0x71F8, 0x71F9}, {0x71FB, 0x71FF}, {0x7201, 0x7203},
+    {0x7205, 0x7207}, {0x720A, 0x720A}, {0x720C, 0x720D}, {0x7210, 0x7210}, {0x7213, 0x7214}, {0x7219, 0x721B},
+    {0x721D, 0x721F}, {0x7222, 0x7223}, {0x7226, 0x722A}, {0x722C, 0x722D}, {0x7230, 0x7230}, {0x7235, 0x7236},
+    {0x7238, 0x723B}, {0x723D, 0x723F}, {0x7241, 0x7242}, {0x7244, 0x7244}, {0x7246, 0x724C}, {0x724F, 0x724F},
+    {0x7252, 0x7253}, {0x7256, 0x7256}, {0x7258, 0x725B}, {0x725D, 0x7263}, {0x7267, 0x7267}, {0x7269, 0x726A},
+    {0x726C, 0x726C}, {0x726E, 0x7270}, {0x7272, 0x7274}, {0x7276, 0x7279}, {0x727B, 0x7281}, {0x7284, 0x7286},
+    {0x7288, 0x7289}, {0x728B, 0x728E}, {0x7290, 0x7293}, {0x7295, 0x7298}, {0x729A, 0x729B}, {0x729D, 0x729E},
+    {0x72A1, 0x72AA}, {0x72AC, 0x72AC}, {0x72AE, 0x72B0}, {0x72B4, 0x72B5}, {0x72BA, 0x72BA}, {0x72BD, 0x72BD},
+    {0x72BF, 0x72C6}, {0x72C9, 0x72CC}, {0x72CE, 0x72CE}, {0x72D0, 0x72D2}, {0x72D4, 0x72D4}, {0x72D6, 0x72DA},
+    {0x72DC, 0x72DC}, {0x72DF, 0x72E1}, {0x72E3, 0x72E4}, {0x72E6, 0x72E6}, {0x72E8, 0x72EB}, {0x72F3, 0x72F4},
+    {0x72F6, 0x7301}, {0x7307, 0x7308}, {0x730A, 0x730C}, {0x730F, 0x730F}, {0x7311, 0x7313}, {0x7316, 0x7319},
+    {0x731B, 0x731E}, {0x7322, 0x7323}, {0x7325, 0x7327}, {0x7329, 0x7329}, {0x732D, 0x732D}, {0x7330, 0x7337},
+    {0x733A, 0x733C}, {0x733E, 0x7340}, {0x7342, 0x7345}, {0x7349, 0x734A}, {0x734C, 0x734E}, {0x7350, 0x7352},
+    {0x7357, 0x735B}, {0x735D, 0x7362}, {0x7365, 0x736C}, {0x736E, 0x7370}, {0x7372, 0x7373}, {0x7375, 0x7378},
+    {0x737A, 0x738B}, {0x738E, 0x738E}, {0x7392, 0x7397}, {0x739D, 0x739D}, {0x739F, 0x73A2}, {0x73A4, 0x73A6},
+    {0x73A8, 0x73A9}, {0x73AB, 0x73AD}, {0x73B2, 0x73B9}, {0x73BB, 0x73BC}, {0x73BE, 0x73C0}, {0x73C2, 0x73C3},
+    {0x73C5, 0x73C8}, {0x73CA, 0x73CD}, {0x73D2, 0x73D4}, {0x73D6, 0x73DE}, {0x73E0, 0x73E0}, {0x73E3, 0x73E3},
+    {0x73E5, 0x73E5}, {0x73E7, 0x73EB}, {0x73ED, 0x73EE}, {0x73F4, 0x73F6}, {0x73F8, 0x73F8}, {0x73FA, 0x73FA},
+    {0x73FC, 0x7401}, {0x7403, 0x740D}, {0x7416, 0x7416}, {0x741A, 0x741B}, {0x741D, 0x741D}, {0x7420, 0x7426},
+    {0x7428, 0x7436}, {0x743A, 0x743A}, {0x743F, 0x7442}, {0x7444, 0x7444}, {0x7446, 0x7446}, {0x744A, 0x744B},
+    {0x744D, 0x7452}, {0x7454, 0x7455}, {0x7457, 0x7457}, {0x7459, 0x745C}, {0x745E, 0x745F}, {0x7462, 0x7464},
+    {0x7467, 0x7467}, {0x7469, 0x746A}, {0x746D, 0x7473}, {0x7475, 0x7475}, {0x7479, 0x7479}, {0x747C, 0x7481},
+    {0x7483, 0x7483}, {0x7485, 0x748B}, {0x7490, 0x7490}, {0x7492, 0x7492}, {0x7494, 0x7495}, {0x7497, 0x7498},
+    {0x749A, 0x749A}, {0x749C, 0x749C}, {0x749E, 0x74A1}, {0x74A3, 0x74A3}, {0x74A5, 0x74AB}, {0x74AD, 0x74AD},
+    {0x74AF, 0x74B2}, {0x74B5, 0x74B8}, {0x74BA, 0x74BB}, {0x74BD, 0x74C3}, {0x74C5, 0x74C5}, {0x74CA, 0x74CB},
+    {0x74CF, 0x74CF}, {0x74D4, 0x74E6}, {0x74E8, 0x74E9}, {0x74EC, 0x74EC}, {0x74EE, 0x74EE}, {0x74F4, 0x74F7},
+    {0x74FB, 0x74FB}, {0x74FD, 0x7500}, {0x7502, 0x7504}, {0x7507, 0x7508}, {0x750B, 0x750D}, {0x750F, 0x7518},
+    {0x751A, 0x751A}, {0x751C, 0x751D}, {0x751F, 0x751F}, {0x7521, 0x7522}, {0x7525, 0x7526}, {0x7528, 0x7533},
+    {0x7537, 0x753A}, {0x753D, 0x7540}, {0x7547, 0x7548}, {0x754B, 0x754C}, {0x754E, 0x754F}, {0x7554, 0x7554},
+    {0x7559, 0x755D}, {0x755F, 0x755F}, {0x7562, 0x7566}, {0x756A, 0x756C}, {0x756F, 0x7570}, {0x7576, 0x7579},
+    {0x757D, 0x7580}, {0x7584, 0x7584}, {0x7586, 0x7587}, {0x758A, 0x758C}, {0x758F, 0x7591}, {0x7594, 0x7595},
+    {0x7598, 0x759A}, {0x759D, 0x759D}, {0x75A2, 0x75A5}, {0x75A7, 0x75A7}, {0x75AA, 0x75AB}, {0x75B0, 0x75B0},
+    {0x75B2, 0x75B3}, {0x75B5, 0x75B6}, {0x75B8, 0x75C2}, {0x75C4, 0x75C5}, {0x75C7, 0x75C7}, {0x75CA, 0x75D2},
+    {0x75D4, 0x75D5}, {0x75D7, 0x75DB}, {0x75DD, 0x75E4}, {0x75E6, 0x75E7}, {0x75ED, 0x75ED}, {0x75EF, 0x7601},
+    {0x7603, 0x7603}, {0x7608, 0x760D}, {0x760F, 0x7611}, {0x7613, 0x7616}, {0x7619, 0x7629}, {0x762D, 0x762D},
+    {0x762F, 0x7635}, {0x7638, 0x7638}, {0x763A, 0x763A}, {0x763C, 0x763D}, {0x7642, 0x7643}, {0x7646, 0x7649},
+    {0x764C, 0x764C}, {0x7650, 0x7650}, {0x7652, 0x7653}, {0x7656, 0x765A}, {0x765C, 0x765C}, {0x765F, 0x7662},
+    {0x7664, 0x7665}, {0x7669, 0x766A}, {0x766C, 0x766E}, {0x7670, 0x7672}, {0x7675, 0x7675}, {0x7678, 0x7679},
+    {0x767B, 0x767F}, {0x7681, 0x7682}, {0x7684, 0x7684}, {0x7686, 0x768B}, {0x768E, 0x768F}, {0x7692, 0x7693},
+    {0x7695, 0x7696}, {0x7699, 0x769E}, {0x76A4, 0x76A4}, {0x76A6, 0x76A6}, {0x76AA, 0x76AB}, {0x76AD, 0x76B0},
+    {0x76B4, 0x76B5}, {0x76B8, 0x76B8}, {0x76BA, 0x76BB}, {0x76BD, 0x76BF}, {0x76C2, 0x76C6}, {0x76C8, 0x76CA},
+    {0x76CD, 0x76CE}, {0x76D2, 0x76D4}, {0x76DA, 0x76DF}, {0x76E1, 0x76E1}, {0x76E3, 0x76E7}, {0x76E9, 0x76EA},
+    {0x76EC, 0x76F5}, {0x76F7, 0x76FC}, {0x76FE, 0x76FE}, {0x7701, 0x7701}, {0x7703, 0x7705}, {0x7707, 0x770B},
+    {0x7710, 0x7713}, {0x7715, 0x7715}, {0x7719, 0x771B}, {0x771D, 0x771D}, {0x771F, 0x7720}, {0x7722, 0x7723},
+    {0x7725, 0x7725}, {0x7727, 0x7729}, {0x772D, 0x772D}, {0x772F, 0x772F}, {0x7731, 0x773E}, {0x7744, 0x7747},
+    {0x774A, 0x774F}, {0x7752, 0x7752}, {0x7754, 0x7756}, {0x7759, 0x775C}, {0x775E, 0x7763}, {0x7765, 0x776F},
+    {0x7779, 0x7779}, {0x777C, 0x7785}, {0x7787, 0x7789}, {0x778B, 0x778F}, {0x7791, 0x7791}, {0x7795, 0x7795},
+    {0x7797, 0x7797}, {0x7799, 0x77A3}, {0x77A5, 0x77A5}, {0x77A7, 0x77A8}, {0x77AA, 0x77AD}, {0x77B0, 0x77B7},
+    {0x77BA, 0x77BD}, {0x77BF, 0x77BF}, {0x77C2, 0x77C2}, {0x77C4, 0x77C4}, {0x77C7, 0x77C7}, {0x77C9, 0x77CA},
+    {0x77CC, 0x77D0}, {0x77D3, 0x77D5}, {0x77D7, 0x77DC}, {0x77DE, 0x77DE}, {0x77E0, 0x77E0}, {0x77E2, 0x77E3},
+    {0x77E5, 0x77E5}, {0x77E7, 0x77E9}, {0x77EC, 0x77F3}, {0x77F7, 0x77FD}, {0x7802, 0x7803}, {0x7805, 0x7806},
+    {0x7809, 0x7809}, {0x780C, 0x7814}, {0x781D, 0x781D}, {0x781F, 0x7823}, {0x7825, 0x7835}, {0x7837, 0x7838},
+    {0x7843, 0x7843}, {0x7845, 0x7845}, {0x7848, 0x784A}, {0x784C, 0x784E}, {0x7850, 0x7850}, {0x7852, 0x7852},
+    {0x785C, 0x785E}, {0x7860, 0x7860}, {0x7862, 0x7862}, {0x7864, 0x7865}, {0x7868, 0x7871}, {0x7879, 0x7879},
+    {0x787B, 0x787C}, {0x787E, 0x7880}, {0x7883, 0x7887}, {0x7889, 0x7889}, {0x788C, 0x788C}, {0x788E, 0x788F},
+    {0x7891, 0x7891}, {0x7893, 0x789A}, {0x789E, 0x78A5}, {0x78A7, 0x78AD}, {0x78B0, 0x78B0}, {0x78B2, 0x78B4},
+    {0x78BA, 0x78BC}, {0x78BE, 0x78BE}, {0x78C1, 0x78C1}, {0x78C3, 0x78C5}, {0x78C8, 0x78D1}, {0x78D4, 0x78D5},
+    {0x78DA, 0x78DB}, {0x78DD, 0x78E3}, {0x78E5, 0x78E5}, {0x78E7, 0x78EA}, {0x78EC, 0x78ED}, {0x78EF, 0x78EF},
+    {0x78F2, 0x78F4}, {0x78F7, 0x78F7}, {0x78F9, 0x78FF}, {0x7901, 0x7902}, {0x7904, 0x7905}, {0x7909, 0x7909},
+    {0x790C, 0x790C}, {0x790E, 0x790E}, {0x7910, 0x7914}, {0x7917, 0x7917}, {0x7919, 0x7919}, {0x791B, 0x791E},
+    {0x7921, 0x7921}, {0x7923, 0x792D}, {0x792F, 0x792F}, {0x7931, 0x7931}, {0x7935, 0x7935}, {0x7938, 0x793A},
+    {0x793D, 0x7942}, {0x7944, 0x794C}, {0x794F, 0x7957}, {0x795A, 0x7961}, {0x7963, 0x7965}, {0x7967, 0x796B},
+    {0x796D, 0x796D}, {0x7970, 0x7970}, {0x7972, 0x7974}, {0x7979, 0x797A}, {0x797C, 0x797D}, {0x797F, 0x797F},
+    {0x7981, 0x7982}, {0x7988, 0x7988}, {0x798A, 0x798B}, {0x798D, 0x7990}, {0x7992, 0x7998}, {0x799A, 0x799C},
+    {0x79A0, 0x79A2}, {0x79A4, 0x79A4}, {0x79A6, 0x79A8}, {0x79AA, 0x79AE}, {0x79B0, 0x79B4}, {0x79B6, 0x79BB},
+    {0x79BD, 0x79C1}, {0x79C5, 0x79C5}, {0x79C8, 0x79C9}, {0x79CB, 0x79CB}, {0x79CD, 0x79CF}, {0x79D1, 0x79D2},
+    {0x79D5, 0x79D6}, {0x79D8, 0x79D8}, {0x79DC, 0x79E0}, {0x79E3, 0x79E4}, {0x79E6, 0x79E7}, {0x79E9, 0x79EE},
+    {0x79F6, 0x79F8}, {0x79FA, 0x79FB}, {0x7A00, 0x7A00}, {0x7A02, 0x7A05}, {0x7A08, 0x7A08}, {0x7A0A, 0x7A0D},
+    {0x7A10, 0x7A15}, {0x7A17, 0x7A1C}, {0x7A1E, 0x7A20}, {0x7A22, 0x7A22}, {0x7A26, 0x7A26}, {0x7A28, 0x7A28},
+    {0x7A2B, 0x7A2B}, {0x7A2E, 0x7A31}, {0x7A37, 0x7A37}, {0x7A39, 0x7A39}, {0x7A3B, 0x7A3D}, {0x7A3F, 0x7A40},
+    {0x7A44, 0x7A44}, {0x7A46, 0x7A48}, {0x7A4A, 0x7A4E}, {0x7A54, 0x7A54}, {0x7A56, 0x7A58}, {0x7A5A, 0x7A5C},
+    {0x7A5F, 0x7A62}, {0x7A67, 0x7A69}, {0x7A6B, 0x7A6E}, {0x7A70, 0x7A71}, {0x7A74, 0x7A76}, {0x7A78, 0x7A7B},
+    {0x7A7E, 0x7A81}, {0x7A84, 0x7A8C}, {0x7A8F, 0x7A90}, {0x7A92, 0x7A92}, {0x7A94, 0x7A99}, {0x7A9E, 0x7AA0},
+    {0x7AA2, 0x7AA3}, {0x7AA8, 0x7AAC}, {0x7AAE, 0x7AAF}, {0x7AB1, 0x7AB8}, {0x7ABA, 0x7ABA}, {0x7ABE, 0x7AC1},
+    {0x7AC4, 0x7AC5}, {0x7AC7, 0x7AC7}, {0x7ACA, 0x7ACB}, {0x7AD1, 0x7AD1}, {0x7AD8, 0x7AD9}, {0x7ADF, 0x7AE0},
+    {0x7AE3, 0x7AE6}, {0x7AEB, 0x7AEB}, {0x7AED, 0x7AEF}, {0x7AF6, 0x7AF7}, {0x7AF9, 0x7AFB}, {0x7AFD, 0x7AFD},
+    {0x7AFF, 0x7B01}, {0x7B04, 0x7B06}, {0x7B08, 0x7B0A}, {0x7B0E, 0x7B13}, {0x7B18, 0x7B1B}, {0x7B1D, 0x7B1E},
+    {0x7B20, 0x7B20}, {0x7B22, 0x7B26}, {0x7B28, 0x7B28}, {0x7B2A, 0x7B35}, {0x7B38, 0x7B38}, {0x7B3B, 0x7B3B},
+    {0x7B40, 0x7B40}, {0x7B44, 0x7B52}, {0x7B54, 0x7B54}, {0x7B56, 0x7B56}, {0x7B58, 0x7B58}, {0x7B60, 0x7B61},
+    {0x7B63, 0x7B67}, {0x7B69, 0x7B69}, {0x7B6D, 0x7B6E}, {0x7B70, 0x7B78}, {0x7B82, 0x7B82}, {0x7B84, 0x7B85},
+    {0x7B87, 0x7B88}, {0x7B8A, 0x7B91}, {0x7B94, 0x7B99}, {0x7B9B, 0x7B9D}, {0x7BA0, 0x7BA1}, {0x7BA4, 0x7BA4},
+    {0x7BAC, 0x7BAD}, {0x7BAF, 0x7BAF}, {0x7BB1, 0x7BB1}, {0x7BB4, 0x7BB5}, {0x7BB7, 0x7BB9}, {0x7BBE, 0x7BBE},
+    {0x7BC0, 0x7BC1}, {0x7BC4, 0x7BC4}, {0x7BC6, 0x7BC7}, {0x7BC9, 0x7BCC}, {0x7BCE, 0x7BCE}, {0x7BD4, 0x7BD5},
+    {0x7BD8, 0x7BEB}, {0x7BF0, 0x7BF4}, {0x7BF7, 0x7BF9}, {0x7BFB, 0x7BFB}, {0x7BFD, 0x7C03}, {0x7C05, 0x7C07},
+    {0x7C09, 0x7C11}, {0x7C19, 0x7C19}, {0x7C1C, 0x7C23}, {0x7C25, 0x7C2D}, {0x7C30, 0x7C30}, {0x7C33, 0x7C33},
+    {0x7C37, 0x7C39}, {0x7C3B, 0x7C40}, {0x7C43, 0x7C43}, {0x7C45, 0x7C45}, {0x7C47, 0x7C4A}, {0x7C4C, 0x7C4D},
+    {0x7C50, 0x7C50}, {0x7C53, 0x7C54}, {0x7C57, 0x7C57}, {0x7C59, 0x7C5C}, {0x7C5F, 0x7C60}, {0x7C63, 0x7C67},
+    {0x7C69, 0x7C6C}, {0x7C6E, 0x7C6F}, {0x7C72, 0x7C73}, {0x7C75, 0x7C75}, {0x7C78, 0x7C7A}, {0x7C7D, 0x7C7D},
+    {0x7C7F, 0x7C81}, {0x7C84, 0x7C85}, {0x7C88, 0x7C8A}, {0x7C8C, 0x7C8D}, {0x7C91, 0x7C92}, {0x7C94, 0x7C98},
+    {0x7C9E, 0x7C9F}, {0x7CA1, 0x7CA3}, {0x7CA5, 0x7CA5}, {0x7CA8, 0x7CA8}, {0x7CAF, 0x7CAF}, {0x7CB1, 0x7CB5},
+    {0x7CB9, 0x7CBF}, {0x7CC5, 0x7CC5}, {0x7CC8, 0x7CC8}, {0x7CCA, 0x7CCC}, {0x7CCE, 0x7CCE}, {0x7CD0, 0x7CD2},
+    {0x7CD4, 0x7CD7}, {0x7CD9, 0x7CD9}, {0x7CDC, 0x7CE0}, {0x7CE2, 0x7CE2}, {0x7CE7, 0x7CE8}, {0x7CEA, 0x7CEA},
+    {0x7CEC, 0x7CEC}, {0x7CEE, 0x7CF2}, {0x7CF4, 0x7CF4}, {0x7CF6, 0x7CF8}, {0x7CFB, 0x7CFB}, {0x7CFD, 0x7CFE},
+    {0x7D00, 0x7D22}, {0x7D28, 0x7D29}, {0x7D2B, 0x7D2C}, {0x7D2E, 0x7D33}, {0x7D35, 0x7D36}, {0x7D38, 0x7D47},
+    {0x7D4A, 0x7D4A}, {0x7D4E, 0x7D56}, {0x7D58, 0x7D58}, {0x7D5B, 0x7D5C}, {0x7D5E, 0x7D5F}, {0x7D61, 0x7D63},
+    {0x7D66, 0x7D6B}, {0x7D6D, 0x7D73}, {0x7D79, 0x7D7D}, {0x7D7F, 0x7D81}, {0x7D83, 0x7D86}, {0x7D88, 0x7D88},
+    {0x7D8C, 0x7D8F}, {0x7D91, 0x7D94}, {0x7D96, 0x7D96}, {0x7D9C, 0x7DA3}, {0x7DA6, 0x7DA7}, {0x7DA9, 0x7DAA},
+    {0x7DAC, 0x7DB2}, {0x7DB4, 0x7DB5}, {0x7DB7, 0x7DC2}, {0x7DC4, 0x7DC7}, {0x7DC9, 0x7DCC}, {0x7DCE, 0x7DCE},
+    {0x7DD2, 0x7DD2}, {0x7DD7, 0x7DDB}, {0x7DDD, 0x7DE1}, {0x7DE3, 0x7DE3}, {0x7DE6, 0x7DEA}, {0x7DEC, 0x7DEC},
+    {0x7DEE, 0x7DF4}, {0x7DF6, 0x7DF7}, {0x7DF9, 0x7DFB}, {0x7E03, 0x7E03}, {0x7E08, 0x7E17}, {0x7E1A, 0x7E25},
+    {0x7E29, 0x7E2B}, {0x7E2D, 0x7E49}, {0x7E4C, 0x7E4C}, {0x7E50, 0x7E5A}, {0x7E5C, 0x7E5C}, {0x7E5E, 0x7E63},
+    {0x7E68, 0x7E6B}, {0x7E6D, 0x7E6D}, {0x7E6F, 0x7E70}, {0x7E72, 0x7E7E}, {0x7E80, 0x7E82}, {0x7E86, 0x7E88},
+    {0x7E8A, 0x7E8D}, {0x7E8F, 0x7E8F}, {0x7E91, 0x7E91}, {0x7E93, 0x7E9C}, {0x7F36, 0x7F36}, {0x7F38, 0x7F3A},
+    {0x7F3D, 0x7F3F}, {0x7F43, 0x7F45}, {0x7F48, 0x7F48}, {0x7F4A, 0x7F4D}, {0x7F4F, 0x7F51}, {0x7F54, 0x7F55},
+    {0x7F58, 0x7F58}, {0x7F5B, 0x7F61}, {0x7F63, 0x7F63}, {0x7F65, 0x7F6E}, {0x7F70, 0x7F70}, {0x7F72, 0x7F73},
+    {0x7F75, 0x7F77}, {0x7F79, 0x7F7F}, {0x7F83, 0x7F83}, {0x7F85, 0x7F8E}, {0x7F91, 0x7F92}, {0x7F94, 0x7F96},
+    {0x7F9A, 0x7F9E}, {0x7FA0, 0x7FA2}, {0x7FA4, 0x7FA9}, {0x7FAC, 0x7FAD}, {0x7FAF, 0x7FB3}, {0x7FB5, 0x7FC3},
+    {0x7FC5, 0x7FC5}, {0x7FC7, 0x7FC7}, {0x7FC9, 0x7FD2}, {0x7FD4, 0x7FD5}, {0x7FD7, 0x7FD7}, {0x7FDB, 0x7FDC},
+    {0x7FDE, 0x7FE3}, {0x7FE5, 0x7FE6}, {0x7FE8, 0x7FF5}, {0x7FF7, 0x7FF9}, {0x7FFB, 0x8001}, {0x8003, 0x8007},
+    {0x800B, 0x8012}, {0x8014, 0x8019}, {0x801B, 0x801C}, {0x801E, 0x801F}, {0x8021, 0x8021}, {0x8024, 0x8024},
+    {0x8026, 0x8026}, {0x8028, 0x802A}, {0x802C, 0x802C}, {0x8030, 0x8030}, {0x8033, 0x8037}, {0x8039, 0x8039},
+    {0x803D, 0x803F}, {0x8043, 0x8043}, {0x8046, 0x8048}, {0x804A, 0x804A}, {0x804F, 0x8052}, {0x8056, 0x8056},
+    {0x8058, 0x8058}, {0x805A, 0x805A}, {0x805C, 0x805E}, {0x8064, 0x8064}, {0x8067, 0x8067}, {0x806C, 0x806C},
+    {0x806F, 0x8073}, {0x8075, 0x8079}, {0x807D, 0x807F}, {0x8082, 0x8082}, {0x8084, 0x8087}, {0x8089, 0x808C},
+    {0x808F, 0x8090}, {0x8092, 0x8093}, {0x8095, 0x8096}, {0x8098, 0x809D}, {0x80A1, 0x80A3}, {0x80A5, 0x80A5},
+    {0x80A9, 0x80AB}, {0x80AD, 0x80AF}, {0x80B1, 0x80B2}, {0x80B4, 0x80B5}, {0x80B8, 0x80B8}, {0x80BA, 0x80BA},
+    {0x80C2, 0x80C5}, {0x80C7, 0x80CA}, {0x80CC, 0x80D1}, {0x80D4, 0x80DE}, {0x80E0, 0x80E1}, {0x80E3, 0x80E6},
+    {0x80ED, 0x80ED}, {0x80EF, 0x80F5}, {0x80F8, 0x80FE}, {0x8100, 0x8102}, {0x8105, 0x8106}, {0x8108, 0x8108},
+    {0x810A, 0x810A}, {0x8115, 0x8116}, {0x8118, 0x8119}, {0x811B, 0x811B}, {0x811D, 0x811F}, {0x8121, 0x8125},
+    {0x8127, 0x8127}, {0x8129, 0x8129}, {0x812B, 0x812D}, {0x812F, 0x8130}, {0x8139, 0x813A}, {0x813D, 0x813E},
+    {0x8143, 0x8144}, {0x8146, 0x8147}, {0x814A, 0x8155}, {0x815B, 0x815C}, {0x815E, 0x815E}, {0x8160, 0x8162},
+    {0x8164, 0x8167}, {0x8169, 0x8169}, {0x816B, 0x816B}, {0x816E, 0x8174}, {0x8176, 0x817A}, {0x817F, 0x8180},
+    {0x8182, 0x8183}, {0x8186, 0x818D}, {0x818F, 0x818F}, {0x8195, 0x8195}, {0x8197, 0x81A0}, {0x81A2, 0x81A3},
+    {0x81A6, 0x81A9}, {0x81AB, 0x81AC}, {0x81AE, 0x81AE}, {0x81B0, 0x81B5}, {0x81B7, 0x81B7}, {0x81B9, 0x81C0},
+    {0x81C2, 0x81C7}, {0x81C9, 0x81CA}, {0x81CC, 0x81CD}, {0x81CF, 0x81D2}, {0x81D5, 0x81D5}, {0x81D7, 0x81DB},
+    {0x81DD, 0x81E3}, {0x81E5, 0x81EA}, {0x81EC, 0x81EE}, {0x81F2, 0x81F4}, {0x81F7, 0x81FC}, {0x81FE, 0x8202},
+    {0x8204, 0x8205}, {0x8207, 0x820D}, {0x8210, 0x8212}, {0x8214, 0x8216}, {0x821B, 0x8222}, {0x8225, 0x8225},
+    {0x8228, 0x8228}, {0x822A, 0x822C}, {0x822F, 0x822F}, {0x8232, 0x823A}, {0x823C, 0x823D}, {0x823F, 0x8240},
+    {0x8242, 0x8242}, {0x8244, 0x8245}, {0x8247, 0x8247}, {0x8249, 0x8249}, {0x824B, 0x824B}, {0x824E, 0x8253},
+    {0x8255, 0x825C}, {0x825E, 0x825F}, {0x8261, 0x8261}, {0x8263, 0x8264}, {0x8266, 0x8266}, {0x8268, 0x8269},
+    {0x826B, 0x826F}, {0x8271, 0x8272}, {0x8274, 0x8275}, {0x8277, 0x8278}, {0x827C, 0x8280}, {0x8283, 0x8285},
+    {0x828A, 0x828B}, {0x828D, 0x8294}, {0x8298, 0x829B}, {0x829D, 0x82A5}, {0x82A7, 0x82A9}, {0x82AB, 0x82B1},
+    {0x82B3, 0x82BE}, {0x82C0, 0x82C0}, {0x82C2, 0x82C3}, {0x82D1, 0x82D7}, {0x82D9, 0x82D9}, {0x82DB, 0x82DC},
+    {0x82DE, 0x82E1}, {0x82E3, 0x82E8}, {0x82EA, 0x82ED}, {0x82EF, 0x82F6}, {0x82F9, 0x82FB}, {0x82FE, 0x82FE},
+    {0x8300, 0x8309}, {0x830C, 0x830D}, {0x8316, 0x8317}, {0x8319, 0x8319}, {0x831B, 0x831C}, {0x831E, 0x831E},
+    {0x8320, 0x8320}, {0x8322, 0x8322}, {0x8324, 0x832D}, {0x832F, 0x832F}, {0x8331, 0x833C}, {0x833F, 0x8345},
+    {0x8347, 0x8354}, {0x8356, 0x8356}, {0x8373, 0x8378}, {0x837A, 0x837F}, {0x8381, 0x8381}, {0x8383, 0x8383},
+    {0x8386, 0x8390}, {0x8392, 0x839B}, {0x839D, 0x839E}, {0x83A0, 0x83A0}, {0x83A2, 0x83AB}, {0x83AE, 0x83B0},
+    {0x83BD, 0x83BD}, {0x83BF, 0x83CC}, {0x83CE, 0x83CF}, {0x83D1, 0x83D1}, {0x83D4, 0x83D9}, {0x83DB, 0x83E5},
+    {0x83E7, 0x83EC}, {0x83EE, 0x83F6}, {0x83F8, 0x83FF}, {0x8401, 0x8401}, {0x8403, 0x8404}, {0x8406, 0x8407},
+    {0x8409, 0x8413}, {0x841B, 0x841B}, {0x8423, 0x8423}, {0x8429, 0x8429}, {0x842B, 0x842D}, {0x842F, 0x843D},
+    {0x843F, 0x8440}, {0x8442, 0x8447}, {0x8449, 0x8449}, {0x844B, 0x844E}, {0x8450, 0x8452}, {0x8454, 0x8454},
+    {0x8456, 0x8457}, {0x8459, 0x845B}, {0x845D, 0x8461}, {0x8463, 0x8463}, {0x8465, 0x8469}, {0x846B, 0x8470},
+    {0x8473, 0x847A}, {0x847D, 0x847E}, {0x8482, 0x8482}, {0x8486, 0x8486}, {0x848D, 0x8491}, {0x8494, 0x8494},
+    {0x8497, 0x84A2}, {0x84A4, 0x84A4}, {0x84A7, 0x84AC}, {0x84AE, 0x84B2}, {0x84B4, 0x84B4}, {0x84B6, 0x84B6},
+    {0x84B8, 0x84BC}, {0x84BF, 0x84C2}, {0x84C4, 0x84C7}, {0x84C9, 0x84D4}, {0x84D6, 0x84D7}, {0x84DB, 0x84DB},
+    {0x84E7, 0x84EC}, {0x84EE, 0x84F4}, {0x84F6, 0x84F7}, {0x84F9, 0x8500}, {0x8502, 0x8502}, {0x8506, 0x850F},
+    {0x8511, 0x851A}, {0x851C, 0x8521}, {0x8523, 0x8531}, {0x853B, 0x853B}, {0x853D, 0x853E}, {0x8540, 0x8541},
+    {0x8543, 0x854A}, {0x854D, 0x854E}, {0x8551, 0x8551}, {0x8553, 0x8559}, {0x855B, 0x855B}, {0x855D, 0x855E},
+    {0x8560, 0x856E}, {0x8571, 0x8571}, {0x8575, 0x857C}, {0x857E, 0x857E}, {0x8580, 0x8591}, {0x8594, 0x8596},
+    {0x8598, 0x85A4}, {0x85A6, 0x85AA}, {0x85AF, 0x85B1}, {0x85B3, 0x85BA}, {0x85BD, 0x85C0}, {0x85C2, 0x85C9},
+    {0x85CB, 0x85CB}, {0x85CD, 0x85D2}, {0x85D5, 0x85D5}, {0x85D7, 0x85DA}, {0x85DC, 0x85DF}, {0x85E1, 0x85E6},
+    {0x85E8, 0x85ED}, {0x85EF, 0x85F2}, {0x85F6, 0x85FB}, {0x85FD, 0x8601}, {0x8604, 0x8607}, {0x8609, 0x860C},
+    {0x8611, 0x8611}, {0x8617, 0x861C}, {0x861E, 0x8627}, {0x8629, 0x862A}, {0x862C, 0x862E}, {0x8631, 0x8636},
+    {0x8638, 0x863C}, {0x863E, 0x8640}, {0x8643, 0x8643}, {0x8646, 0x8648}, {0x864B, 0x864E}, {0x8650, 0x8650},
+    {0x8652, 0x8656}, {0x8659, 0x8659}, {0x865B, 0x865C}, {0x865E, 0x865F}, {0x8661, 0x8665}, {0x8667, 0x866B},
+    {0x866D, 0x8671}, {0x8673, 0x8674}, {0x8677, 0x8677}, {0x8679, 0x867C}, {0x8685, 0x8687}, {0x868A, 0x868E},
+    {0x8690, 0x8691}, {0x8693, 0x869A}, {0x869C, 0x869E}, {0x86A1, 0x86A5}, {0x86A7, 0x86AA}, {0x86AF, 0x86B1},
+    {0x86B3, 0x86C9}, {0x86CB, 0x86CC}, {0x86D0, 0x86D1}, {0x86D3, 0x86D4}, {0x86D6, 0x86DF}, {0x86E2, 0x86E4},
+    {0x86E6, 0x86E6}, {0x86E8, 0x86ED}, {0x86F5, 0x86FB}, {0x86FE, 0x86FE}, {0x8700, 0x870E}, {0x8711, 0x8713},
+    {0x8718, 0x871C}, {0x871E, 0x871E}, {0x8720, 0x872A}, {0x872C, 0x872E}, {0x8730, 0x8735}, {0x8737, 0x8738},
+    {0x873A, 0x873C}, {0x873E, 0x8743}, {0x8746, 0x8746}, {0x874C, 0x876F}, {0x8773, 0x877B}, {0x8781, 0x8785},
+    {0x8787, 0x8789}, {0x878D, 0x878D}, {0x878F, 0x8794}, {0x8796, 0x8798}, {0x879A, 0x879F}, {0x87A2, 0x87A4},
+    {0x87AA, 0x87B0}, {0x87B2, 0x87C0}, {0x87C2, 0x87C6}, {0x87C8, 0x87CC}, {0x87D1, 0x87D4}, {0x87D7, 0x87D9},
+    {0x87DB, 0x87E8}, {0x87EA, 0x87ED}, {0x87EF, 0x87EF}, {0x87F2, 0x87F4}, {0x87F6, 0x87F7}, {0x87F9, 0x87FC},
+    {0x87FE, 0x8803}, {0x8805, 0x8806}, {0x8808, 0x880D}, {0x8810, 0x8811}, {0x8813, 0x8817}, {0x8819, 0x8819},
+    {0x881B, 0x881D}, {0x881F, 0x8826}, {0x8828, 0x882C}, {0x882E, 0x8833}, {0x8835, 0x8839}, {0x883B, 0x8841},
+    {0x8843, 0x8844}, {0x8848, 0x8848}, {0x884A, 0x884E}, {0x8852, 0x8853}, {0x8855, 0x8857}, {0x8859, 0x885B},
+    {0x885D, 0x885D}, {0x8861, 0x8863}, {0x8867, 0x886B}, {0x886D, 0x886D}, {0x886F, 0x8872}, {0x8874, 0x8877},
+    {0x8879, 0x8879}, {0x887C, 0x8883}, {0x8888, 0x8889}, {0x888B, 0x888E}, {0x8891, 0x8893}, {0x8895, 0x889B},
+    {0x889E, 0x889F}, {0x88A1, 0x88A2}, {0x88A4, 0x88A4}, {0x88A7, 0x88A8}, {0x88AA, 0x88AC}, {0x88B1, 0x88B2},
+    {0x88B6, 0x88BA}, {0x88BC, 0x88BE}, {0x88C0, 0x88C2}, {0x88C9, 0x88CE}, {0x88D0, 0x88D0}, {0x88D2, 0x88D2},
+    {0x88D4, 0x88DF}, {0x88E1, 0x88E1}, {0x88E7, 0x88E8}, {0x88EB, 0x88EC}, {0x88EE, 0x88F4}, {0x88F6, 0x88FE},
+    {0x8901, 0x8902}, {0x8905, 0x8907}, {0x8909, 0x890C}, {0x890E, 0x890E}, {0x8910, 0x891A}, {0x891E, 0x891F},
+    {0x8921, 0x8923}, {0x8925, 0x8927}, {0x8929, 0x8933}, {0x8935, 0x8938}, {0x893B, 0x893E}, {0x8941, 0x8942},
+    {0x8944, 0x8944}, {0x8946, 0x8946}, {0x8949, 0x8949}, {0x894B, 0x894C}, {0x894F, 0x8953}, {0x8956, 0x8964},
+    {0x8966, 0x8966}, {0x8969, 0x896F}, {0x8971, 0x8974}, {0x8976, 0x8976}, {0x8979, 0x897C}, {0x897E, 0x897F},
+    {0x8981, 0x8983}, {0x8985, 0x8986}, {0x8988, 0x8988}, {0x898B, 0x898B}, {0x898F, 0x898F}, {0x8993, 0x8993},
+    {0x8995, 0x8998}, {0x899B, 0x899F}, {0x89A1, 0x89A4}, {0x89A6, 0x89A6}, {0x89AA, 0x89AA}, {0x89AC, 0x89AF},
+    {0x89B2, 0x89B2}, {0x89B6, 0x89B7}, {0x89B9, 0x89BA}, {0x89BD, 0x89C0}, {0x89D2, 0x89D6}, {0x89D9, 0x89DD},
+    {0x89DF, 0x89E6}, {0x89E8, 0x89E9}, {0x89EB, 0x89ED}, {0x89F0, 0x89F4}, {0x89F6, 0x89F8}, {0x89FA, 0x89FC},
+    {0x89FE, 0x8A00}, {0x8A02, 0x8A04}, {0x8A07, 0x8A08}, {0x8A0A, 0x8A0A}, {0x8A0C, 0x8A0C}, {0x8A0E, 0x8A13},
+    {0x8A15, 0x8A18}, {0x8A1B, 0x8A1B}, {0x8A1D, 0x8A1F}, {0x8A22, 0x8A23}, {0x8A25, 0x8A25}, {0x8A27, 0x8A27},
+    {0x8A2A, 0x8A2A}, {0x8A2C, 0x8A2D}, {0x8A30, 0x8A31}, {0x8A34, 0x8A34}, {0x8A36, 0x8A36}, {0x8A39, 0x8A3C},
+    {0x8A3E, 0x8A41}, {0x8A44, 0x8A46}, {0x8A48, 0x8A48}, {0x8A4A, 0x8A4A}, {0x8A4C, 0x8A52}, {0x8A54, 0x8A59},
+    {0x8A5B, 0x8A5B}, {0x8A5E, 0x8A5E}, {0x8A60, 0x8A63}, {0x8A66, 0x8A66}, {0x8A68, 0x8A69}, {0x8A6B, 0x8A6E},
+    {0x8A70, 0x8A77}, {0x8A79, 0x8A7C}, {0x8A7F, 0x8A7F}, {0x8A81, 0x8A87}, {0x8A8B, 0x8A8D}, {0x8A8F, 0x8A8F},
+    {0x8A91, 0x8A93}, {0x8A95, 0x8A96}, {0x8A98, 0x8A9A}, {0x8A9E, 0x8A9E}, {0x8AA0, 0x8AA1}, {0x8AA3, 0x8AA8},
+    {0x8AAA, 0x8AAB}, {0x8AB0, 0x8AB0}, {0x8AB2, 0x8AB2}, {0x8AB6, 0x8AB6}, {0x8AB8, 0x8AC0}, {0x8AC2, 0x8AC9},
+    {0x8ACB, 0x8ACB}, {0x8ACD, 0x8ACD}, {0x8ACF, 0x8ACF}, {0x8AD1, 0x8AD9}, {0x8ADB, 0x8AE2}, {0x8AE4, 0x8AE4},
+    {0x8AE6, 0x8AE8}, {0x8AEB, 0x8AEB}, {0x8AED, 0x8AF8}, {0x8AFA, 0x8AFC}, {0x8AFE, 0x8B02}, {0x8B04, 0x8B08},
+    {0x8B0A, 0x8B0B}, {0x8B0D, 0x8B1E}, {0x8B20, 0x8B20}, {0x8B22, 0x8B28}, {0x8B2A, 0x8B2C}, {0x8B2E, 0x8B31},
+    {0x8B33, 0x8B33}, {0x8B35, 0x8B37}, {0x8B39, 0x8B3E}, {0x8B40, 0x8B42}, {0x8B45, 0x8B4B}, {0x8B4E, 0x8B5A},
+    {0x8B5C, 0x8B5D}, {0x8B5F, 0x8B60}, {0x8B63, 0x8B63}, {0x8B65, 0x8B68}, {0x8B6A, 0x8B6D}, {0x8B6F, 0x8B70},
+    {0x8B74, 0x8B74}, {0x8B77, 0x8B7B}, {0x8B7D, 0x8B80}, {0x8B82, 0x8B82}, {0x8B84, 0x8B86}, {0x8B88, 0x8B88},
+    {0x8B8A, 0x8B8C}, {0x8B8E, 0x8B8E}, {0x8B92, 0x8B96}, {0x8B98, 0x8B9A}, {0x8B9C, 0x8B9C}, {0x8B9E, 0x8B9F},
+    {0x8C37, 0x8C37}, {0x8C39, 0x8C39}, {0x8C3B, 0x8C3F}, {0x8C41, 0x8C43}, {0x8C45, 0x8C50}, {0x8C54, 0x8C57},
+    {0x8C5A, 0x8C5A}, {0x8C5C, 0x8C5D}, {0x8C5F, 0x8C5F}, {0x8C61, 0x8C62}, {0x8C64, 0x8C66}, {0x8C68, 0x8C6D},
+    {0x8C6F, 0x8C73}, {0x8C75, 0x8C7B}, {0x8C7D, 0x8C7D}, {0x8C80, 0x8C82}, {0x8C84, 0x8C86}, {0x8C89, 0x8C8A},
+    {0x8C8C, 0x8C8D}, {0x8C8F, 0x8C95}, {0x8C97, 0x8C9A}, {0x8C9C, 0x8C9E}, {0x8CA0, 0x8CA5}, {0x8CA7, 0x8CAC},
+    {0x8CAF, 0x8CB0}, {0x8CB2, 0x8CC5}, {0x8CC7, 0x8CC8}, {0x8CCA, 0x8CCA}, {0x8CCC, 0x8CCC}, {0x8CCF, 0x8CCF},
+    {0x8CD1, 0x8CD3}, {0x8CD5, 0x8CD5}, {0x8CD7, 0x8CD7}, {0x8CD9, 0x8CDA}, {0x8CDC, 0x8CE8}, {0x8CEA, 0x8CEA},
+    {0x8CEC, 0x8CEE}, {0x8CF0, 0x8CF1}, {0x8CF3, 0x8CF5}, {0x8CF8, 0x8CFE}, {0x8D00, 0x8D00}, {0x8D02, 0x8D02},
+    {0x8D04, 0x8D0A}, {0x8D0D, 0x8D0D}, {0x8D0F, 0x8D10}, {0x8D13, 0x8D17}, {0x8D19, 0x8D19}, {0x8D1B, 0x8D1B},
+    {0x8D64, 0x8D64}, {0x8D66, 0x8D69}, {0x8D6B, 0x8D70}, {0x8D72, 0x8D74}, {0x8D76, 0x8D79}, {0x8D7B, 0x8D7B},
+    {0x8D7D, 0x8D7D}, {0x8D80, 0x8D81}, {0x8D84, 0x8D85}, {0x8D89, 0x8D8A}, {0x8D8C, 0x8D96}, {0x8D99, 0x8D99},
+    {0x8D9B, 0x8D9C}, {0x8D9F, 0x8DA1}, {0x8DA3, 0x8DA3}, {0x8DA5, 0x8DA5}, {0x8DA7, 0x8DA8}, {0x8DAA, 0x8DAF},
+    {0x8DB2, 0x8DB7}, {0x8DB9, 0x8DBA}, {0x8DBC, 0x8DBC}, {0x8DBE, 0x8DBF}, {0x8DC1, 0x8DC2}, {0x8DC5, 0x8DC8},
+    {0x8DCB, 0x8DD1}, {0x8DD3, 0x8DD3}, {0x8DD5, 0x8DDD}, {0x8DDF, 0x8DE4}, {0x8DE6, 0x8DEC}, {0x8DEE, 0x8DF4},
+    {0x8DFA, 0x8DFA}, {0x8DFC, 0x8E00}, {0x8E02, 0x8E07}, {0x8E09, 0x8E0A}, {0x8E0D, 0x8E0D}, {0x8E0F, 0x8E27},
+    {0x8E29, 0x8E29}, {0x8E2B, 0x8E2B}, {0x8E2E, 0x8E2E}, {0x8E30, 0x8E31}, {0x8E33, 0x8E36}, {0x8E38, 0x8E39},
+    {0x8E3C, 0x8E42}, {0x8E44, 0x8E45}, {0x8E47, 0x8E4E}, {0x8E50, 0x8E50}, {0x8E53, 0x8E57}, {0x8E59, 0x8E67},
+    {0x8E69, 0x8E6A}, {0x8E6C, 0x8E6D}, {0x8E6F, 0x8E6F}, {0x8E72, 0x8E74}, {0x8E76, 0x8E76}, {0x8E78, 0x8E78},
+    {0x8E7A, 0x8E7C}, {0x8E81, 0x8E82}, {0x8E84, 0x8E8E}, {0x8E90, 0x8E98}, {0x8E9A, 0x8E9A}, {0x8E9D, 0x8EA1},
+    {0x8EA3, 0x8EA6}, {0x8EA8, 0x8EAC}, {0x8EB2, 0x8EB2}, {0x8EBA, 0x8EBA}, {0x8EBD, 0x8EBD}, {0x8EC0, 0x8EC0},
+    {0x8EC2, 0x8EC2}, {0x8EC9, 0x8ECD}, {0x8ECF, 0x8ECF}, {0x8ED1, 0x8ED4}, {0x8ED7, 0x8ED8}, {0x8EDB, 0x8EE1},
+    {0x8EE5, 0x8EE9}, {0x8EEB, 0x8EEC}, {0x8EEE, 0x8EEF}, {0x8EF1, 0x8EF1}, {0x8EF4, 0x8EFC}, {0x8EFE, 0x8F03},
+    {0x8F05, 0x8F0B}, {0x8F0D, 0x8F0E}, {0x8F10, 0x8F18}, {0x8F1A, 0x8F20}, {0x8F23, 0x8F26}, {0x8F29, 0x8F2A},
+    {0x8F2C, 0x8F2C}, {0x8F2E, 0x8F2F}, {0x8F32, 0x8F39}, {0x8F3B, 0x8F3B}, {0x8F3E, 0x8F40}, {0x8F42, 0x8F49},
+    {0x8F4B, 0x8F4B}, {0x8F4D, 0x8F5B}, {0x8F5D, 0x8F64}, {0x8F9B, 0x8F9C}, {0x8F9F, 0x8F9F}, {0x8FA3, 0x8FA3},
+    {0x8FA6, 0x8FA6}, {0x8FA8, 0x8FA8}, {0x8FAD, 0x8FB2}, {0x8FB4, 0x8FB4}, {0x8FBF, 0x8FBF}, {0x8FC2, 0x8FC2},
+    {0x8FC4, 0x8FC6}, {0x8FC9, 0x8FC9}, {0x8FCB, 0x8FCB}, {0x8FCD, 0x8FCE}, {0x8FD1, 0x8FD7}, {0x8FE0, 0x8FE6},
+    {0x8FE8, 0x8FE8}, {0x8FEA, 0x8FEB}, {0x8FED, 0x8FEE}, {0x8FF0, 0x8FF0}, {0x8FF4, 0x8FF8}, {0x8FFA, 0x9006},
+    {0x900B, 0x900D}, {0x900F, 0x9011}, {0x9014, 0x9017}, {0x9019, 0x9024}, {0x902D, 0x902F}, {0x9031, 0x9032},
+    {0x9034, 0x9036}, {0x9038, 0x9038}, {0x903C, 0x903F}, {0x9041, 0x9042}, {0x9044, 0x9044}, {0x9047, 0x9047},
+    {0x9049, 0x904B}, {0x904D, 0x9055}, {0x9058, 0x9059}, {0x905B, 0x905E}, {0x9060, 0x9060}, {0x9062, 0x9063},
+    {0x9067, 0x9069}, {0x906B, 0x906B}, {0x906D, 0x9070}, {0x9072, 0x9088}, {0x908A, 0x908B}, {0x908D, 0x908D},
+    {0x908F, 0x9091}, {0x9094, 0x9095}, {0x9097, 0x9099}, {0x909B, 0x909B}, {0x909E, 0x90A3}, {0x90A5, 0x90A7},
+    {0x90AA, 0x90AA}, {0x90AF, 0x90B6}, {0x90B8, 0x90B8}, {0x90BD, 0x90BF}, {0x90C1, 0x90C1}, {0x90C3, 0x90C3},
+    {0x90C5, 0x90C5}, {0x90C7, 0x90C8}, {0x90CA, 0x90CB}, {0x90CE, 0x90CE}, {0x90D4, 0x90DD}, {0x90DF, 0x90E5},
+    {0x90E8, 0x90ED}, {0x90EF, 0x90F5}, {0x90F9, 0x9109}, {0x910B, 0x910B}, {0x910D, 0x9112}, {0x9114, 0x9114},
+    {0x9116, 0x9124}, {0x9126, 0x9136}, {0x9138, 0x913B}, {0x913E, 0x9141}, {0x9143, 0x9150}, {0x9152, 0x9153},
+    {0x9155, 0x9158}, {0x915A, 0x915A}, {0x915F, 0x9165}, {0x9168, 0x916A}, {0x916C, 0x916C}, {0x916E, 0x916F},
+    {0x9172, 0x9175}, {0x9177, 0x917A}, {0x9180, 0x9187}, {0x9189, 0x918B}, {0x918D, 0x918D}, {0x918F, 0x9193},
+    {0x9199, 0x91A3}, {0x91A5, 0x91A5}, {0x91A7, 0x91A8}, {0x91AA, 0x91B5}, {0x91B7, 0x91B7}, {0x91B9, 0x91BA},
+    {0x91BC, 0x91BE}, {0x91C0, 0x91C3}, {0x91C5, 0x91C7}, {0x91C9, 0x91C9}, {0x91CB, 0x91D1}, {0x91D3, 0x91D5},
+    {0x91D7, 0x91DA}, {0x91DC, 0x91DD}, {0x91E2, 0x91E4}, {0x91E6, 0x91EE}, {0x91F1, 0x91F1}, {0x91F3, 0x91F5},
+    {0x91F7, 0x91F9}, {0x91FD, 0x91FD}, {0x91FF, 0x9207}, {0x9209, 0x920A}, {0x920C, 0x920D}, {0x920F, 0x9212},
+    {0x9214, 0x9217}, {0x9219, 0x921A}, {0x921C, 0x921C}, {0x921E, 0x921E}, {0x9223, 0x9227}, {0x922D, 0x922E},
+    {0x9230, 0x9234}, {0x9236, 0x923A}, {0x923D, 0x9240}, {0x9245, 0x9246}, {0x9248, 0x9254}, {0x9256, 0x9257},
+    {0x925A, 0x925B}, {0x925E, 0x925E}, {0x9260, 0x9261}, {0x9263, 0x9267}, {0x926C, 0x926D}, {0x926F, 0x9270},
+    {0x9272, 0x9272}, {0x9276, 0x9276}, {0x9278, 0x9280}, {0x9282, 0x9283}, {0x9285, 0x9288}, {0x928A, 0x928E},
+    {0x9291, 0x9291}, {0x9293, 0x929D}, {0x92A0, 0x92AC}, {0x92B2, 0x92B7}, {0x92BB, 0x92BC}, {0x92C0, 0x92D3},
+    {0x92D5, 0x92D5}, {0x92D7, 0x92D9}, {0x92DD, 0x92E1}, {0x92E4, 0x92E4}, {0x92E6, 0x92EA}, {0x92EE, 0x92F1},
+    {0x92F7, 0x92FC}, {0x92FE, 0x9302}, {0x9304, 0x9304}, {0x9306, 0x9306}, {0x9308, 0x9309}, {0x930B, 0x9310},
+    {0x9312, 0x9316}, {0x9318, 0x931B}, {0x931D, 0x932B}, {0x932D, 0x932F}, {0x9333, 0x9336}, {0x9338, 0x9339},
+    {0x933C, 0x933C}, {0x9346, 0x9347}, {0x9349, 0x9352}, {0x9354, 0x935C}, {0x935E, 0x935E}, {0x9360, 0x9361},
+    {0x9363, 0x9365}, {0x9367, 0x9367}, {0x936A, 0x936A}, {0x936C, 0x936D}, {0x9370, 0x9371}, {0x9375, 0x9377},
+    {0x9379, 0x937C}, {0x937E, 0x937E}, {0x9380, 0x9380}, {0x9382, 0x9383}, {0x9388, 0x938A}, {0x938C, 0x938F},
+    {0x9391, 0x9392}, {0x9394, 0x939B}, {0x939D, 0x939F}, {0x93A1, 0x93AA}, {0x93AC, 0x93AC}, {0x93AE, 0x93B5},
+    {0x93B7, 0x93B7}, {0x93C0, 0x93C0}, {0x93C2, 0x93C4}, {0x93C7, 0x93C8}, {0x93CA, 0x93CA}, {0x93CC, 0x93D2},
+    {0x93D4, 0x93DA}, {0x93DC, 0x93DF}, {0x93E1, 0x93E4}, {0x93E6, 0x93E8}, {0x93EC, 0x93EC}, {0x93EE, 0x93EE},
+    {0x93F5, 0x9400}, {0x9403, 0x9403}, {0x9406, 0x9407}, {0x9409, 0x9416}, {0x9418, 0x9419}, {0x9420, 0x9420},
+    {0x9428, 0x942C}, {0x942E, 0x942E}, {0x9430, 0x9433}, {0x9435, 0x943D}, {0x943F, 0x9440}, {0x9444, 0x944C},
+    {0x944F, 0x9452}, {0x9455, 0x9455}, {0x9457, 0x9457}, {0x945D, 0x945E}, {0x9460, 0x9460}, {0x9462, 0x9464},
+    {0x9468, 0x946B}, {0x946D, 0x9478}, {0x947C, 0x9483}, {0x9577, 0x9577}, {0x957A, 0x957D}, {0x9580, 0x9580},
+    {0x9582, 0x9583}, {0x9586, 0x9586}, {0x9588, 0x9589}, {0x958B, 0x9594}, {0x9598, 0x9598}, {0x959B, 0x959C},
+    {0x959E, 0x959F}, {0x95A1, 0x95A1}, {0x95A3, 0x95A5}, {0x95A8, 0x95A9}, {0x95AB, 0x95AE}, {0x95B0, 0x95B1},
+    {0x95B5, 0x95B7}, {0x95B9, 0x95C0}, {0x95C3, 0x95C3}, {0x95C5, 0x95CD}, {0x95D0, 0x95D6}, {0x95DA, 0x95DC},
+    {0x95DE, 0x95E5}, {0x961C, 0x961C}, {0x961E, 0x961E}, {0x9620, 0x9624}, {0x9628, 0x9628}, {0x962A, 0x962A},
+    {0x962C, 0x9632}, {0x9639, 0x963D}, {0x963F, 0x9640}, {0x9642, 0x9644}, {0x964A, 0x9651}, {0x9653, 0x9654},
+    {0x9658, 0x9658}, {0x965B, 0x965F}, {0x9661, 0x9664}, {0x966A, 0x966D}, {0x966F, 0x9678}, {0x967C, 0x967E},
+    {0x9680, 0x9680}, {0x9683, 0x968B}, {0x968D, 0x968E}, {0x9691, 0x9695}, {0x9697, 0x9699}, {0x969B, 0x969C},
+    {0x969E, 0x969E}, {0x96A1, 0x96A2}, {0x96A4, 0x96A4}, {0x96A7, 0x96AA}, {0x96AC, 0x96AC}, {0x96AE, 0x96AE},
+    {0x96B0, 0x96B1}, {0x96B3, 0x96B4}, {0x96B8, 0x96B9}, {0x96BB, 0x96BC}, {0x96BF, 0x96CE}, {0x96D2, 0x96DF},
+    {0x96E1, 0x96E3}, {0x96E5, 0x96E5}, {0x96E8, 0x96EA}, {0x96EF, 0x96F2}, {0x96F5, 0x96FB}, {0x96FD, 0x96FD},
+    {0x96FF, 0x9700}, {0x9702, 0x9702}, {0x9704, 0x9709}, {0x970B, 0x970B}, {0x970D, 0x9713}, {0x9716, 0x9716},
+    {0x9718, 0x9719}, {0x971C, 0x9720}, {0x9722, 0x972C}, {0x972E, 0x9730}, {0x9732, 0x9732}, {0x9735, 0x9735},
+    {0x9738, 0x973A}, {0x973D, 0x973F}, {0x9742, 0x9744}, {0x9746, 0x9749}, {0x974B, 0x974B}, {0x9752, 0x9752},
+    {0x9756, 0x9756}, {0x9758, 0x9758}, {0x975A, 0x975C}, {0x975E, 0x975E}, {0x9760, 0x9762}, {0x9766, 0x9766},
+    {0x9768, 0x976A}, {0x976C, 0x976C}, {0x976E, 0x976E}, {0x9770, 0x9770}, {0x9772, 0x9774}, {0x9776, 0x9778},
+    {0x977A, 0x9785}, {0x9788, 0x9788}, {0x978A, 0x978B}, {0x978D, 0x978F}, {0x9794, 0x9794}, {0x9797, 0x979A},
+    {0x979C, 0x979E}, {0x97A0, 0x97A6}, {0x97A8, 0x97A8}, {0x97AA, 0x97AE}, {0x97B3, 0x97B3}, {0x97B6, 0x97B7},
+    {0x97B9, 0x97B9}, {0x97BB, 0x97BB}, {0x97BF, 0x97BF}, {0x97C1, 0x97C1}, {0x97C3, 0x97C7}, {0x97C9, 0x97C9},
+    {0x97CB, 0x97D0}, {0x97D3, 0x97D9}, {0x97DC, 0x97DF}, {0x97E1, 0x97E1}, {0x97E3, 0x97E3}, {0x97E5, 0x97E5},
+    {0x97ED, 0x97ED}, {0x97F0, 0x97F1}, {0x97F3, 0x97F3}, {0x97F6, 0x97F6}, {0x97F8, 0x97FB}, {0x97FD, 0x9808},
+    {0x980A, 0x980A}, {0x980C, 0x9813}, {0x9816, 0x9818}, {0x981B, 0x981E}, {0x9820, 0x9821}, {0x9824, 0x9824},
+    {0x9826, 0x9829}, {0x982B, 0x982B}, {0x982D, 0x982D}, {0x982F, 0x9830}, {0x9832, 0x9832}, {0x9835, 0x9835},
+    {0x9837, 0x9839}, {0x983B, 0x983B}, {0x9841, 0x9841}, {0x9843, 0x9846}, {0x9848, 0x984A}, {0x984C, 0x9853},
+    {0x9857, 0x9859}, {0x985B, 0x9860}, {0x9862, 0x9865}, {0x9867, 0x9867}, {0x9869, 0x986B}, {0x986F, 0x9874},
+    {0x98A8, 0x98A9}, {0x98AC, 0x98AF}, {0x98B1, 0x98B3}, {0x98B6, 0x98B6}, {0x98B8, 0x98B8}, {0x98BA, 0x98C2},
+    {0x98C4, 0x98C4}, {0x98C6, 0x98C6}, {0x98C9, 0x98C9}, {0x98CB, 0x98CC}, {0x98DB, 0x98DB}, {0x98DF, 0x98DF},
+    {0x98E2, 0x98E3}, {0x98E5, 0x98E5}, {0x98E7, 0x98E7}, {0x98E9, 0x98EB}, {0x98ED, 0x98ED}, {0x98EF, 0x98EF},
+    {0x98F2, 0x98F2}, {0x98F4, 0x98F4}, {0x98F6, 0x98F6}, {0x98F9, 0x98FA}, {0x98FC, 0x98FE}, {0x9900, 0x9900},
+    {0x9902, 0x9903}, {0x9905, 0x9905}, {0x9907, 0x990A}, {0x990C, 0x990C}, {0x9910, 0x9918}, {0x991A, 0x991B},
+    {0x991E, 0x991F}, {0x9921, 0x9921}, {0x9924, 0x9925}, {0x9927, 0x9933}, {0x9935, 0x9935}, {0x993A, 0x993A},
+    {0x993C, 0x993F}, {0x9941, 0x9941}, {0x9943, 0x9943}, {0x9945, 0x9945}, {0x9947, 0x9949}, {0x994B, 0x994C},
+    {0x994E, 0x994E}, {0x9950, 0x9959}, {0x995B, 0x995C}, {0x995E, 0x995F}, {0x9961, 0x9961}, {0x9996, 0x9999},
+    {0x999C, 0x999E}, {0x99A1, 0x99A1}, {0x99A3, 0x99A3}, {0x99A5, 0x99A8}, {0x99AB, 0x99B5}, {0x99B9, 0x99BB},
+    {0x99BD, 0x99BD}, {0x99C1, 0x99C3}, {0x99C7, 0x99C7}, {0x99C9, 0x99C9}, {0x99CB, 0x99D9}, {0x99DB, 0x99DD},
+    {0x99DF, 0x99DF}, {0x99E2, 0x99E5}, {0x99E7, 0x99E7}, {0x99E9, 0x99EA}, {0x99EC, 0x99EE}, {0x99F0, 0x99F1},
+    {0x99F4, 0x99F4}, {0x99F6, 0x99FF}, {0x9A01, 0x9A07}, {0x9A09, 0x9A0B}, {0x9A0D, 0x9A0F}, {0x9A11, 0x9A11},
+    {0x9A14, 0x9A16}, {0x9A19, 0x9A1E}, {0x9A20, 0x9A20}, {0x9A22, 0x9A25}, {0x9A27, 0x9A27}, {0x9A29, 0x9A2E},
+    {0x9A30, 0x9A32}, {0x9A34, 0x9A3A}, {0x9A3D, 0x9A46}, {0x9A48, 0x9A4A}, {0x9A4C, 0x9A50}, {0x9A52, 0x9A57},
+    {0x9A59, 0x9A5B}, {0x9A5E, 0x9A60}, {0x9A62, 0x9A62}, {0x9A64, 0x9A6B}, {0x9AA8, 0x9AA8}, {0x9AAB, 0x9AAB},
+    {0x9AAD, 0x9AAD}, {0x9AAF, 0x9AB1}, {0x9AB3, 0x9AB4}, {0x9AB7, 0x9AB9}, {0x9ABB, 0x9ABC}, {0x9ABE, 0x9AC2},
+    {0x9AC6, 0x9AC7}, {0x9ACA, 0x9ACA}, {0x9ACD, 0x9ACD}, {0x9ACF, 0x9AD6}, {0x9AD8, 0x9AD8}, {0x9ADC, 0x9ADC},
+    {0x9ADF, 0x9ADF}, {0x9AE1, 0x9AE1}, {0x9AE3, 0x9AE3}, {0x9AE6, 0x9AE7}, {0x9AEB, 0x9AEF}, {0x9AF1, 0x9AF3},
+    {0x9AF6, 0x9AF7}, {0x9AF9, 0x9AFE}, {0x9B01, 0x9B01}, {0x9B03, 0x9B06}, {0x9B08, 0x9B08}, {0x9B0A, 0x9B0E},
+    {0x9B10, 0x9B12}, {0x9B15, 0x9B1A}, {0x9B1E, 0x9B20}, {0x9B22, 0x9B25}, {0x9B27, 0x9B29}, {0x9B2B, 0x9B2B},
+    {0x9B2E, 0x9B2F}, {0x9B31, 0x9B33}, {0x9B35, 0x9B35}, {0x9B37, 0x9B37}, {0x9B3A, 0x9B3C}, {0x9B3E, 0x9B3F},
+    {0x9B41, 0x9B46}, {0x9B48, 0x9B48}, {0x9B4A, 0x9B4F}, {0x9B51, 0x9B52}, {0x9B54, 0x9B56}, {0x9B58, 0x9B5B},
+    {0x9B5F, 0x9B61}, {0x9B64, 0x9B64}, {0x9B66, 0x9B68}, {0x9B6C, 0x9B6C}, {0x9B6F, 0x9B71}, {0x9B74, 0x9B77},
+    {0x9B7A, 0x9B7E}, {0x9B80, 0x9B80}, {0x9B82, 0x9B82}, {0x9B85, 0x9B88}, {0x9B90, 0x9B93}, {0x9B95, 0x9B95},
+    {0x9B9A, 0x9B9B}, {0x9B9E, 0x9B9E}, {0x9BA0, 0x9BA2}, {0x9BA4, 0x9BA6}, {0x9BA8, 0x9BA8}, {0x9BAA, 0x9BAB},
+    {0x9BAD, 0x9BAF}, {0x9BB5, 0x9BB6}, {0x9BB8, 0x9BB9}, {0x9BBD, 0x9BBD}, {0x9BBF, 0x9BC1}, {0x9BC3, 0x9BC4},
+    {0x9BC6, 0x9BCA}, {0x9BD3, 0x9BD7}, {0x9BD9, 0x9BDC}, {0x9BDE, 0x9BDE}, {0x9BE0, 0x9BE2}, {0x9BE4, 0x9BE8},
+    {0x9BEA, 0x9BEC}, {0x9BF0, 0x9BF0}, {0x9BF7, 0x9BF8}, {0x9BFD, 0x9BFD}, {0x9C05, 0x9C09}, {0x9C0B, 0x9C0B},
+    {0x9C0D, 0x9C0E}, {0x9C12, 0x9C14}, {0x9C17, 0x9C17}, {0x9C1C, 0x9C1D}, {0x9C21, 0x9C21}, {0x9C23, 0x9C25},
+    {0x9C28, 0x9C29}, {0x9C2B, 0x9C2D}, {0x9C31, 0x9C34}, {0x9C36, 0x9C37}, {0x9C39, 0x9C39}, {0x9C3B, 0x9C41},
+    {0x9C44, 0x9C44}, {0x9C46, 0x9C46}, {0x9C48, 0x9C4E}, {0x9C50, 0x9C50}, {0x9C52, 0x9C52}, {0x9C54, 0x9C59},
+    {0x9C5E, 0x9C60}, {0x9C62, 0x9C63}, {0x9C66, 0x9C68}, {0x9C6D, 0x9C6E}, {0x9C71, 0x9C71}, {0x9C73, 0x9C75},
+    {0x9C77, 0x9C7A}, {0x9CE5, 0x9CE7}, {0x9CE9, 0x9CEA}, {0x9CED, 0x9CED}, {0x9CF1, 0x9CF7}, {0x9CF9, 0x9CFD},
+    {0x9CFF, 0x9D00}, {0x9D03, 0x9D09}, {0x9D10, 0x9D10}, {0x9D12, 0x9D12}, {0x9D14, 0x9D15}, {0x9D17, 0x9D19},
+    {0x9D1B, 0x9D1B}, {0x9D1D, 0x9D20}, {0x9D22, 0x9D23}, {0x9D25, 0x9D26}, {0x9D28, 0x9D29}, {0x9D2D, 0x9D31},
+    {0x9D33, 0x9D33}, {0x9D36, 0x9D38}, {0x9D3B, 0x9D3B}, {0x9D3D, 0x9D43}, {0x9D45, 0x9D45}, {0x9D4A, 0x9D4C},
+    {0x9D4F, 0x9D4F}, {0x9D51, 0x9D54}, {0x9D56, 0x9D5D}, {0x9D5F, 0x9D61}, {0x9D67, 0x9D6C}, {0x9D6F, 0x9D75},
+    {0x9D77, 0x9D79}, {0x9D7B, 0x9D7B}, {0x9D7D, 0x9D7D}, {0x9D7F, 0x9D82}, {0x9D84, 0x9D8C}, {0x9D90, 0x9D90},
+    {0x9D92, 0x9D92}, {0x9D94, 0x9D94}, {0x9D96, 0x9DA4}, {0x9DA6, 0x9DAA}, {0x9DAC, 0x9DAD}, {0x9DAF, 0x9DAF},
+    {0x9DB1, 0x9DBC}, {0x9DBE, 0x9DBF}, {0x9DC1, 0x9DC3}, {0x9DC5, 0x9DC5}, {0x9DC7, 0x9DC8}, {0x9DCA, 0x9DD3},
+    {0x9DD5, 0x9DDF}, {0x9DE1, 0x9DE6}, {0x9DE8, 0x9DE9}, {0x9DEB, 0x9DF0}, {0x9DF2, 0x9DFB}, {0x9DFD, 0x9E07},
+    {0x9E09, 0x9E09}, {0x9E0B, 0x9E0B}, {0x9E0D, 0x9E0D}, {0x9E0F, 0x9E15}, {0x9E17, 0x9E17}, {0x9E19, 0x9E1B},
+    {0x9E1D, 0x9E1E}, {0x9E75, 0x9E75}, {0x9E79, 0x9E7A}, {0x9E7C, 0x9E7D}, {0x9E7F, 0x9E80}, {0x9E82, 0x9E83},
+    {0x9E86, 0x9E8E}, {0x9E91, 0x9E94}, {0x9E97, 0x9E97}, {0x9E99, 0x9E9D}, {0x9E9F, 0x9EA1}, {0x9EA4, 0x9EA5},
+    {0x9EA7, 0x9EA7}, {0x9EA9, 0x9EA9}, {0x9EAD, 0x9EAE}, {0x9EB0, 0x9EB0}, {0x9EB4, 0x9EB7}, {0x9EBB, 0x9EBC},
+    {0x9EBE, 0x9EBE}, {0x9EC0, 0x9EC0}, {0x9EC2, 0x9EC3}, {0x9EC8, 0x9EC8}, {0x9ECC, 0x9ED1}, {0x9ED3, 0x9ED6},
+    {0x9ED8, 0x9ED8}, {0x9EDA, 0x9EE0}, {0x9EE4, 0x9EE8}, {0x9EEB, 0x9EEB}, {0x9EED, 0x9EF0}, {0x9EF2, 0x9EF7},
+    {0x9EF9, 0x9EFD}, {0x9EFF, 0x9F01}, {0x9F06, 0x9F07}, {0x9F09, 0x9F0A}, {0x9F0E, 0x9F10}, {0x9F12, 0x9F13},
+    {0x9F15, 0x9F16}, {0x9F18, 0x9F1C}, {0x9F1E, 0x9F1E}, {0x9F20, 0x9F20}, {0x9F22, 0x9F25}, {0x9F28, 0x9F38},
+    {0x9F3B, 0x9F3B}, {0x9F3D, 0x9F3E}, {0x9F40, 0x9F43}, {0x9F46, 0x9F4F}, {0x9F52, 0x9F52}, {0x9F54, 0x9F59},
+    {0x9F5B, 0x9F61}, {0x9F63, 0x9F67}, {0x9F6A, 0x9F6C}, {0x9F6E, 0x9F72}, {0x9F74, 0x9F7B}, {0x9F7E, 0x9F7E},
+    {0x9F8D, 0x9F8D}, {0x9F90, 0x9F92}, {0x9F94, 0x9F95}, {0x9F98, 0x9F98}, {0x9F9C, 0x9F9C}, {0x9FA0, 0x9FA0},
+    {0x9FA2, 0x9FA2}, {0x9FA4, 0x9FA4}, {0xFA0C, 0xFA0D}, {0xFE30, 0xFE31}, {0xFE33, 0xFE44}, {0xFE49, 0xFE50},
+    {0xFE52, 0xFE52}, {0xFE54, 0xFE57}, {0xFE59, 0xFE66}, {0xFE69, 0xFE6B}, {0xFF01, 0xFF01}, {0xFF03, 0xFF06},
+    {0xFF08, 0xFF3A}, {0xFF3C, 0xFF3C}, {0xFF3F, 0xFF3F}, {0xFF41, 0xFF5D}, {0xFF64, 0xFF64}, {0xFFE3, 0xFFE3},
+};
@@ -0,0 +1,509 @@
+﻿#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <nowide/iostream.hpp>
+
+#include "daemon.h"
+#include "subset.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+const char *servefail = reinterpret_cast<const char *>(u8"无法监听 %s\n");
+const char *servebusy = reinterpret_cast<const char *>(u8"%s 已有服务在运行\n");
+const char *servestart = reinterpret_cast<const char *>(
+    u8"在 %s 上等待任务，同时运行 %u 个\n");
+const char *servejobstats = reinterpret_cast<const char *>(
+    u8"任务 %lu：%s，排队 %.2f 秒，合并 %.2f 秒\n");
+const char *servejobfail = reinterpret_cast<const char *>(u8"任务 %lu 失败\n");
+const char *connectfail = reinterpret_cast<const char *>(u8"无法连接 %s\n");
+const char *requestbadargs = reinterpret_cast<const char *>(u8"任务参数错误\n");
+const char *requestfail = reinterpret_cast<const char *>(u8"合并失败，详见服务端输出\n");
+const char *requeststats = reinterpret_cast<const char *>(
+    u8"%s：排队 %.2f 秒，合并 %.2f 秒\n");
+const char *unsupported = reinterpret_cast<const char *>(
+    u8"此平台不支持 --serve、--connect\n");
+
+using json = nlohmann::json;
+
+#ifdef _WIN32
+
+int Serve(const Options &) {
+	nowide::cerr << unsupported;
+	return EXIT_FAILURE;
+}
+
+int Request(const std::string &, const std::vector<std::string> &, bool) {
+	nowide::cerr << unsupported;
+	return EXIT_FAILURE;
+}
+
+#else
+
+namespace {
+volatile sig_atomic_t stopping = 0;
+// written to on SIGINT and SIGTERM, to wake up the accept loop
+int wakeup[2] = {-1, -1};
+
+// seconds a client has to send its request
+const int requestTimeout = 5;
+
+void Stop(int) {
+	int saved = errno;
+	stopping = 1;
+	char c = 0;
+	if (write(wakeup[1], &c, 1)) {
+	}
+	errno = saved;
+}
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+	                                     start)
+	    .count();
+}
+
+bool Address(const std::string &path, sockaddr_un &address) {
+	address = {};
+	address.sun_family = AF_UNIX;
+	if (path.size() >= sizeof address.sun_path)
+		return false;
+	path.copy(address.sun_path, path.size());
+	return true;
+}
+
+int Connect(const std::string &path) {
+	sockaddr_un address;
+	if (!Address(path, address))
+		return -1;
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
+	if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof address)) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+bool WriteAll(int fd, const char *data, size_t size) {
+	while (size) {
+		ssize_t n = write(fd, data, size);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		data += n;
+		size -= size_t(n);
+	}
+	return true;
+}
+
+// the first line, without its newline. fails on a timeout of fd
+bool ReadLine(int fd, std::string &line) {
+	char buffer[65536];
+	for (;;) {
+		ssize_t n = read(fd, buffer, sizeof buffer);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		size_t start = line.size();
+		line.append(buffer, size_t(n));
+		size_t newline = line.find('\n', start);
+		if (newline != std::string::npos) {
+			line.resize(newline);
+			return true;
+		}
+	}
+}
+
+// everything until the peer shuts down its side
+bool ReadAll(int fd, std::string &data) {
+	char buffer[65536];
+	for (;;) {
+		ssize_t n = read(fd, buffer, sizeof buffer);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return false;
+		if (n == 0)
+			return true;
+		data.append(buffer, size_t(n));
+	}
+}
+
+std::string WorkingDirectory() {
+	char path[PATH_MAX];
+	return getcwd(path, sizeof path) ? path : ".";
+}
+
+// relative to the client's working directory
+std::string Resolve(const std::string &cwd, const std::string &path) {
+	if (path.empty() || path == "-" || path[0] == '/')
+		return path;
+	return cwd + "/" + path;
+}
+
+// canonical, so that inputs match resident files however they are named
+std::string ResolveInput(const std::string &cwd, const std::string &path) {
+	std::string resolved = Resolve(cwd, path);
+	char canonical[PATH_MAX];
+	return realpath(resolved.c_str(), canonical) ? canonical : resolved;
+}
+
+class Server {
+public:
+	Server(const Options &options, int listener)
+	    : options(options), listener(listener), inputs(Resident(options)),
+	      resident(options.files.begin(), options.files.end()),
+	      scheduler(options.memoryBudget, resident) {
+		if (!options.cachePath.empty())
+			cache = std::make_unique<OutlineCache>(options.cachePath);
+	}
+
+	void Run() {
+		unsigned threadCount = options.jobs ? options.jobs
+		                                    : std::thread::hardware_concurrency();
+		threadCount = std::max(1u, threadCount);
+		// SIGINT and SIGTERM go to this thread
+		sigset_t signals, previous;
+		sigemptyset(&signals);
+		sigaddset(&signals, SIGINT);
+		sigaddset(&signals, SIGTERM);
+		pthread_sigmask(SIG_BLOCK, &signals, &previous);
+		std::vector<std::thread> workers;
+		for (unsigned t = 0; t < threadCount; t++)
+			workers.emplace_back([this] { Work(); });
+		pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+		if (options.verbose) {
+			char u8buffer[4096];
+			snprintf(u8buffer, sizeof u8buffer, servestart,
+			         options.servePath.c_str(), threadCount);
+			std::lock_guard<std::mutex> lock(outputMutex);
+			nowide::cerr << u8buffer;
+		}
+
+		// a signal before poll is not lost: its byte is still in the pipe
+		pollfd fds[] = {{listener, POLLIN, 0}, {wakeup[0], POLLIN, 0}};
+		while (!stopping) {
+			if (poll(fds, 2, -1) <= 0 || !(fds[0].revents & POLLIN))
+				continue;
+			int fd = accept(listener, nullptr, nullptr);
+			if (fd < 0)
+				continue; // the client went away
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back({fd, std::chrono::steady_clock::now()});
+			ready.notify_one();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			done = true;
+			ready.notify_all();
+		}
+		for (auto &worker : workers)
+			worker.join();
+		if (cache)
+			SaveCache(*cache, options.cachePath, options.verbose);
+		if (options.verbose)
+			PrintPackStats();
+		if (options.memoryBudget && options.verbose)
+			PrintMemoryStats(options.memoryBudget, scheduler.GetStats());
+	}
+
+private:
+	struct Connection {
+		int fd;
+		std::chrono::steady_clock::time_point accepted;
+	};
+	struct Job {
+		Connection connection;
+		Options options;
+		size_t estimate;
+	};
+
+	const Options &options;
+	int listener;
+	std::unique_ptr<OutlineCache> cache;
+	InputCache inputs;
+	const std::set<std::string> resident;
+	MemoryScheduler scheduler;
+
+	std::mutex mutex;
+	std::condition_variable ready;
+	std::deque<Connection> queue;
+	bool done = false;
+	size_t jobCount = 0;
+	std::map<size_t, Job> submitted; // waiting for memory
+
+	// never released, so their inputs stay once loaded
+	static std::map<std::string, size_t> Resident(const Options &options) {
+		std::map<std::string, size_t> uses;
+		for (auto &file : options.files)
+			uses[file] = SIZE_MAX;
+		return uses;
+	}
+
+	void Work() {
+		for (;;) {
+			std::unique_lock<std::mutex> lock(mutex);
+			ready.wait(lock, [this] { return done || !queue.empty(); });
+			if (queue.empty())
+				return;
+			Connection connection = queue.front();
+			queue.pop_front();
+			size_t id = ++jobCount;
+			lock.unlock();
+
+			// a client that never sends its request holds the worker
+			// for requestTimeout at most
+			timeval timeout = {requestTimeout, 0};
+			setsockopt(connection.fd, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+			           sizeof timeout);
+			std::string text;
+			Options job;
+			json request;
+			if (!ReadLine(connection.fd, text) ||
+			    (request = json::parse(text, nullptr, false)).is_discarded() ||
+			    !Parse(request, job)) {
+				Reply(connection.fd, {{"status", "badargs"}}, "");
+				close(connection.fd);
+				continue;
+			}
+
+			/* queue the job for memory, then run whichever job is admitted,
+			   which may be another worker's
+			*/
+			std::map<MemoryScheduler::Key, size_t> shared;
+			size_t estimate = options.memoryBudget
+			                      ? EstimateMemory(job, resident, shared)
+			                      : 0;
+			lock.lock();
+			submitted[id] = {connection, std::move(job), estimate};
+			lock.unlock();
+			scheduler.Submit(id, estimate, shared);
+			id = scheduler.Admit();
+			lock.lock();
+			Job admitted = std::move(submitted[id]);
+			submitted.erase(id);
+			lock.unlock();
+
+			if (options.memoryBudget && options.verbose)
+				PrintAdmission(id, admitted.estimate, scheduler.GetStats());
+			Run(id, admitted);
+			scheduler.Finish(id);
+			close(admitted.connection.fd);
+		}
+	}
+
+	void Run(size_t id, Job &job) {
+		char u8buffer[4096];
+		double wait = Seconds(job.connection.accepted);
+		auto start = std::chrono::steady_clock::now();
+		std::string merged;
+		if (job.options.output == "-")
+			job.options.save = [&merged](const std::string &,
+			                             std::string &&json) {
+				merged = std::move(json);
+				return true;
+			};
+		// a bad request fails its job, not the server
+		int result = EXIT_FAILURE;
+		try {
+			result = Merge(job.options, cache.get(), &inputs);
+		} catch (const std::exception &) {
+			// replied and reported as failed below
+		}
+		const std::string &output = job.options.output.empty()
+		                                ? job.options.files[0]
+		                                : job.options.output;
+		Reply(job.connection.fd,
+		      {{"status", result == 0 ? "ok" : "failed"},
+		       {"output", output},
+		       {"bytes", merged.size()},
+		       {"wait", wait},
+		       {"seconds", Seconds(start)}},
+		      merged);
+
+		if (result != 0)
+			snprintf(u8buffer, sizeof u8buffer, servejobfail,
+			         (unsigned long)id);
+		else
+			snprintf(u8buffer, sizeof u8buffer, servejobstats,
+			         (unsigned long)id, output.c_str(), wait, Seconds(start));
+		if (result != 0 || options.verbose) {
+			std::lock_guard<std::mutex> lock(outputMutex);
+			nowide::cerr << u8buffer;
+		}
+	}
+
+	void Reply(int fd, const json &reply, const std::string &merged) {
+		std::string header = reply.dump() + "\n";
+		if (WriteAll(fd, header.data(), header.size()))
+			WriteAll(fd, merged.data(), merged.size());
+	}
+
+	// job options, with paths relative to the client made absolute
+	bool Parse(const json &request, Options &job) {
+		if (!request.is_object() || !request.contains("cwd") ||
+		    !request.contains("args") || !request["cwd"].is_string() ||
+		    !request["args"].is_array())
+			return false;
+		std::vector<std::string> args;
+		for (auto &arg : request["args"]) {
+			if (!arg.is_string())
+				return false;
+			args.push_back(arg);
+		}
+		// the server owns the cache, shared by all jobs
+		if (!ParseOptions(args, job) || job.files.size() < 2 || job.plan ||
+		    !job.batchPath.empty() || !job.variants.empty() ||
+		    !job.servePath.empty() || !job.connectPath.empty() ||
+		    !job.cachePath.empty())
+			return false;
+
+		std::string cwd = request["cwd"];
+		for (auto &file : job.files)
+			file = ResolveInput(cwd, file);
+		job.output = Resolve(cwd, job.output);
+		job.rulesPath = Resolve(cwd, job.rulesPath);
+		job.glyphStore = Resolve(cwd, job.glyphStore);
+		job.statsPath = Resolve(cwd, job.statsPath);
+		Charset builtin;
+		if (!job.charsetName.empty() && !builtin.LoadBuiltin(job.charsetName))
+			job.charsetName = Resolve(cwd, job.charsetName);
+		job.cachePath = options.cachePath;
+		return true;
+	}
+};
+} // namespace
+
+int Serve(const Options &options) {
+	char u8buffer[4096];
+	const std::string &path = options.servePath;
+
+	// a stale socket is replaced, a live one is left alone
+	int probe = Connect(path);
+	if (probe >= 0) {
+		close(probe);
+		snprintf(u8buffer, sizeof u8buffer, servebusy, path.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	sockaddr_un address;
+	int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(path.c_str());
+	if (!Address(path, address) || listener < 0 ||
+	    bind(listener, reinterpret_cast<sockaddr *>(&address),
+	         sizeof address) ||
+	    listen(listener, SOMAXCONN)) {
+		if (listener >= 0)
+			close(listener);
+		snprintf(u8buffer, sizeof u8buffer, servefail, path.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+
+	// non-blocking, so that a full pipe never blocks the handler
+	if (pipe(wakeup)) {
+		close(listener);
+		unlink(path.c_str());
+		snprintf(u8buffer, sizeof u8buffer, servefail, path.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	for (int fd : wakeup)
+		fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+	struct sigaction action = {};
+	action.sa_handler = Stop;
+	sigaction(SIGINT, &action, nullptr);
+	sigaction(SIGTERM, &action, nullptr);
+	signal(SIGPIPE, SIG_IGN);
+
+	Options resident = options;
+	std::string cwd = WorkingDirectory();
+	for (auto &file : resident.files)
+		file = ResolveInput(cwd, file);
+	Server(resident, listener).Run();
+
+	close(listener);
+	unlink(path.c_str());
+	for (int fd : wakeup)
+		close(fd);
+	return 0;
+}
+
+int Request(const std::string &socketPath,
+            const std::vector<std::string> &args, bool verbose) {
+	char u8buffer[4096];
+	int fd = Connect(socketPath);
+	if (fd < 0) {
+		snprintf(u8buffer, sizeof u8buffer, connectfail, socketPath.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	json request = {{"cwd", WorkingDirectory()}, {"args", args}};
+	std::string text = request.dump() + "\n";
+	std::string response;
+	bool good = WriteAll(fd, text.data(), text.size()) &&
+	            !shutdown(fd, SHUT_WR) && ReadAll(fd, response);
+	close(fd);
+
+	size_t newline = response.find('\n');
+	json reply;
+	if (good && newline != std::string::npos)
+		reply = json::parse(response.substr(0, newline), nullptr, false);
+	if (!reply.is_object() || !reply["status"].is_string()) {
+		snprintf(u8buffer, sizeof u8buffer, connectfail, socketPath.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	if (reply["status"] == "badargs") {
+		nowide::cerr << requestbadargs;
+		return EXIT_FAILURE;
+	}
+	if (reply["status"] != "ok") {
+		nowide::cerr << requestfail;
+		return EXIT_FAILURE;
+	}
+
+	size_t bytes = reply["bytes"];
+	if (response.size() - newline - 1 != bytes) {
+		snprintf(u8buffer, sizeof u8buffer, connectfail, socketPath.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	fwrite(response.data() + newline + 1, 1, bytes, stdout);
+	fflush(stdout);
+	if (verbose) {
+		std::string output = reply["output"];
+		snprintf(u8buffer, sizeof u8buffer, requeststats, output.c_str(),
+		         double(reply["wait"]), double(reply["seconds"]));
+		nowide::cerr << u8buffer;
+	}
+	return 0;
+}
+
+#endif
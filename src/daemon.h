@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "merge.h"
+
+/* listen on options.servePath and run merge jobs sent by Request, at most
+   options.jobs at a time. options.files stay resident once a job has
+   loaded them, every other input is loaded per job. options.cachePath is
+   shared by all jobs and saved when the server stops on SIGINT or SIGTERM.
+
+   a request is one line of JSON, {"cwd": ..., "args": [...]}, args as on
+   the command line, sent within 5 seconds of connecting. the reply is one line of JSON, {"status": "ok" |
+   "badargs" | "failed", "output": ..., "bytes": n, "wait": seconds,
+   "seconds": seconds}, followed by n bytes of merged JSON if the job's
+   output is "-".
+*/
+int Serve(const Options &options);
+
+/* send args as a job to the server at socketPath and wait for it. merged
+   JSON returned by the server is written to standard output.
+*/
+int Request(const std::string &socketPath,
+            const std::vector<std::string> &args, bool verbose);
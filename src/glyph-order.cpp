@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include "glyph-order.h"
+
+using json = nlohmann::json;
+
+namespace {
+constexpr int BlockShift = 8; // 256 code points
+
+struct Placer {
+	explicit Placer(const json &glyf) : glyf(glyf) {}
+
+	const json &glyf;
+	json order = json::array();
+	std::unordered_set<std::string> placed;
+
+	// glyph, then its components not placed yet
+	void Place(const std::string &name, bool components = true) {
+		auto it = glyf.find(name);
+		if (it == glyf.end() || !placed.insert(name).second)
+			return;
+		order.push_back(name);
+		if (components)
+			PlaceComponents(*it);
+	}
+	void PlaceComponents(const json &glyph) {
+		if (glyph.find("references") != glyph.end())
+			for (auto &r : glyph["references"])
+				Place(r["glyph"]);
+	}
+};
+} // namespace
+
+void OrderGlyphs(json &font, const SourceSelector &selector) {
+	// (source, code point, variation selector, glyph)
+	std::vector<std::tuple<int, int, int, std::string>> mapped;
+	if (font.find("cmap") != font.end())
+		for (auto &[u, n] : font["cmap"].items()) {
+			int codepoint = std::stoi(u);
+			mapped.emplace_back(selector.Owner(codepoint), codepoint, 0, n);
+		}
+	// keys are "<code point> <selector>"
+	if (font.find("cmap_uvs") != font.end())
+		for (auto &[key, n] : font["cmap_uvs"].items()) {
+			size_t space;
+			int codepoint = std::stoi(key, &space);
+			int variation = space < key.size() ? std::stoi(key.substr(space)) : 0;
+			mapped.emplace_back(selector.Owner(codepoint), codepoint, variation,
+			                    n);
+		}
+	std::sort(mapped.begin(), mapped.end());
+
+	Placer placer(font["glyf"]);
+	bool hasOrder = font.find("glyph_order") != font.end();
+	if (hasOrder && !font["glyph_order"].empty())
+		placer.Place(font["glyph_order"][0]);
+	placer.Place(".notdef");
+	/* mapped glyphs of a block stay consecutive, so that cmap keeps its
+	   ranges, and the components they share follow the block.
+	*/
+	for (size_t i = 0; i < mapped.size();) {
+		auto block = [&mapped](size_t k) {
+			return std::make_pair(std::get<0>(mapped[k]),
+			                      std::get<1>(mapped[k]) >> BlockShift);
+		};
+		size_t end = i;
+		for (; end < mapped.size() && block(end) == block(i); end++)
+			placer.Place(std::get<3>(mapped[end]), false);
+		// cmap may keep code points of invisible characters without glyphs
+		for (; i < end; i++) {
+			auto it = placer.glyf.find(std::get<3>(mapped[i]));
+			if (it != placer.glyf.end())
+				placer.PlaceComponents(*it);
+		}
+	}
+	if (hasOrder)
+		for (auto &n : font["glyph_order"])
+			placer.Place(n);
+	for (auto &[n, g] : font["glyf"].items())
+		placer.Place(n);
+	font["glyph_order"] = std::move(placer.order);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "source-selector.h"
+
+/* replace glyph_order with every glyph of glyf, so that glyph ids follow
+   use rather than glyph names: .notdef first, then glyphs mapped in cmap
+   and cmap_uvs grouped by source and sorted by code point, each block of
+   256 code points followed by the components its glyphs reference, then
+   the remaining glyphs in their previous order.
+*/
+void OrderGlyphs(nlohmann::json &font, const SourceSelector &selector);
@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <nowide/cstdio.hpp>
+
+#include "glyph-store.h"
+#include "skeleton.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <process.h>
+
+#include <nowide/convert.hpp>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+using nlohmann::json;
+
+// bump when the layout or the parsing of records changes.
+static const uint32_t storeVersion = 1;
+static const char storeMagic[8] = {'W', 'F', 'M', 'G', 'L', 'Y', 'P', 'H'};
+
+struct GlyphStore::Entry
+{
+	uint64_t hash;
+	uint64_t offset;
+	uint32_t nameSize;
+	uint32_t size; // of the glyph, after the name
+};
+
+struct StoreHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t reserved;
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	uint64_t count;
+	uint64_t entriesOffset;
+	uint64_t skeletonOffset;
+	uint64_t skeletonSize;
+	uint64_t tablesOffset;
+	uint64_t tablesSize;
+};
+
+static_assert(sizeof(StoreHeader) == 80, "unexpected padding");
+
+static uint64_t Hash(const char *p, size_t size)
+{
+	// FNV-1a
+	uint64_t h = 0xcbf29ce484222325;
+	for (size_t i = 0; i < size; i++)
+	{
+		h ^= uint8_t(p[i]);
+		h *= 0x100000001b3;
+	}
+	return h;
+}
+
+static bool Stamp(const std::string &path, uint64_t &size, int64_t &time)
+{
+#ifdef _WIN32
+	struct _stat64 st;
+	if (_wstat64(nowide::widen(path).c_str(), &st) != 0)
+		return false;
+#else
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0)
+		return false;
+#endif
+	size = uint64_t(st.st_size);
+	time = int64_t(st.st_mtime);
+	return true;
+}
+
+bool GlyphStore::Open(const std::string &path, const std::string &source)
+{
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	if (!Stamp(source, sourceSize, sourceTime))
+		return false;
+	if (Map(path, sourceSize, sourceTime))
+		return true;
+	return Build(path, source, sourceSize, sourceTime) &&
+	       Map(path, sourceSize, sourceTime);
+}
+
+bool GlyphStore::Map(const std::string &path, uint64_t sourceSize,
+                     int64_t sourceTime)
+{
+	entries = nullptr;
+	count = 0;
+	if (!file.Open(path))
+		return false;
+	StoreHeader header;
+	if (file.Size() >= sizeof header)
+		memcpy(&header, file.Data(), sizeof header);
+	if (file.Size() < sizeof header ||
+	    memcmp(header.magic, storeMagic, sizeof storeMagic) ||
+	    header.version != storeVersion || header.sourceSize != sourceSize ||
+	    header.sourceTime != sourceTime ||
+	    header.entriesOffset % alignof(Entry) ||
+	    file.Size() < header.entriesOffset + header.count * sizeof(Entry) ||
+	    file.Size() < header.skeletonOffset + header.skeletonSize ||
+	    file.Size() < header.tablesOffset + header.tablesSize)
+	{
+		// stale or foreign file, will be built again
+		file.Close();
+		return false;
+	}
+	entries = reinterpret_cast<const Entry *>(file.Data() + header.entriesOffset);
+	count = header.count;
+	skeletonOffset = header.skeletonOffset;
+	skeletonSize = header.skeletonSize;
+	tablesOffset = header.tablesOffset;
+	tablesSize = header.tablesSize;
+	return true;
+}
+
+bool GlyphStore::Build(const std::string &path, const std::string &source,
+                       uint64_t sourceSize, int64_t sourceTime)
+{
+	MappedFile text;
+	if (!text.Open(source))
+		return false;
+	const char *begin = text.Data(), *end = begin + text.Size();
+	// checks the whole text, nothing below throws then
+	json skeleton;
+	if (!ParseSkeleton(begin, end, skeleton))
+		skeleton = json::parse(begin, end); // malformed, throws
+
+	std::string tmp =
+	    path + ".tmp" + std::to_string(getpid()) + "-" +
+	    std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+	FILE *out = nowide::fopen(tmp.c_str(), "wb");
+	if (!out)
+		return false;
+	StoreHeader header = {};
+	bool ok = fwrite(&header, sizeof header, 1, out) == 1;
+	uint64_t offset = sizeof header;
+
+	std::vector<Entry> index;
+	json tables;
+	ParseGlyphs(
+	    begin, end, {"head", "name", "OS_2"},
+	    [&](const std::string &name, json &glyph) {
+		    std::vector<uint8_t> record = json::to_msgpack(glyph);
+		    ok = ok &&
+		         fwrite(name.data(), 1, name.size(), out) == name.size() &&
+		         fwrite(record.data(), 1, record.size(), out) == record.size();
+		    index.push_back({Hash(name.data(), name.size()), offset,
+		                     uint32_t(name.size()), uint32_t(record.size())});
+		    offset += name.size() + record.size();
+	    },
+	    tables);
+	text.Close();
+	tables.erase("glyf"); // left empty
+
+	for (auto *part : {&skeleton, &tables})
+	{
+		std::vector<uint8_t> record = json::to_msgpack(*part);
+		if (part == &skeleton)
+			header.skeletonOffset = offset, header.skeletonSize = record.size();
+		else
+			header.tablesOffset = offset, header.tablesSize = record.size();
+		ok = ok && fwrite(record.data(), 1, record.size(), out) == record.size();
+		offset += record.size();
+	}
+	static const char padding[alignof(Entry)] = {};
+	size_t pad = (alignof(Entry) - offset % alignof(Entry)) % alignof(Entry);
+	ok = ok && fwrite(padding, 1, pad, out) == pad;
+	offset += pad;
+
+	std::sort(index.begin(), index.end(),
+	          [](const Entry &a, const Entry &b) { return a.hash < b.hash; });
+	ok = ok && fwrite(index.data(), sizeof(Entry), index.size(), out) ==
+	               index.size();
+
+	memcpy(header.magic, storeMagic, sizeof storeMagic);
+	header.version = storeVersion;
+	header.sourceSize = sourceSize;
+	header.sourceTime = sourceTime;
+	header.count = index.size();
+	header.entriesOffset = offset;
+	ok = ok && fseek(out, 0, SEEK_SET) == 0 &&
+	     fwrite(&header, sizeof header, 1, out) == 1;
+	ok = fclose(out) == 0 && ok;
+
+	if (ok)
+	{
+#ifdef _WIN32
+		nowide::remove(path.c_str()); // rename does not replace on Windows
+#endif
+		ok = nowide::rename(tmp.c_str(), path.c_str()) == 0;
+	}
+	if (!ok)
+		nowide::remove(tmp.c_str());
+	return ok;
+}
+
+json GlyphStore::Skeleton() const
+{
+	const char *p = file.Data() + skeletonOffset;
+	return json::from_msgpack(p, p + skeletonSize);
+}
+
+json GlyphStore::Tables() const
+{
+	const char *p = file.Data() + tablesOffset;
+	return json::from_msgpack(p, p + tablesSize);
+}
+
+bool GlyphStore::Read(const std::string &name, json &glyph) const
+{
+	uint64_t hash = Hash(name.data(), name.size());
+	auto it = std::lower_bound(
+	    entries, entries + count, hash,
+	    [](const Entry &e, uint64_t hash) { return e.hash < hash; });
+	for (; it != entries + count && it->hash == hash; ++it)
+	{
+		const char *p = file.Data() + it->offset;
+		if (it->offset + it->nameSize + it->size > file.Size() ||
+		    name.compare(0, name.npos, p, it->nameSize))
+			continue;
+		p += it->nameSize;
+		glyph = json::from_msgpack(p, p + it->size);
+		return true;
+	}
+	return false;
+}
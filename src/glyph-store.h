@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "mapped-file.h"
+
+/* glyphs of an .otd file kept on disk, for fonts too large to hold whole.
+
+   the file is a header, one record per glyph (its name, then the glyph in
+   MessagePack), the skeleton of the font (see skeleton.h) and its head, name
+   and OS_2 tables, then a table of (hash, offset, size) entries sorted by
+   the hash of glyph names. it is memory-mapped, so a glyph is paged in only
+   when it is read. the source file's size and modification time are
+   recorded, a store that does not match them is built again.
+*/
+class GlyphStore
+{
+public:
+	GlyphStore() = default;
+	GlyphStore(const GlyphStore &) = delete;
+	GlyphStore &operator=(const GlyphStore &) = delete;
+
+	/* open the store at path for the .otd file source (both UTF-8), building
+	   it first if needed, one glyph at a time. returns false if source
+	   cannot be read or the store cannot be written. throws on malformed
+	   JSON, as json::parse does.
+	*/
+	bool Open(const std::string &path, const std::string &source);
+
+	nlohmann::json Skeleton() const;
+	// head, name and OS_2
+	nlohmann::json Tables() const;
+	// false if there is no such glyph
+	bool Read(const std::string &name, nlohmann::json &glyph) const;
+
+	size_t Count() const
+	{
+		return count;
+	}
+
+private:
+	struct Entry;
+
+	bool Map(const std::string &path, uint64_t sourceSize, int64_t sourceTime);
+	static bool Build(const std::string &path, const std::string &source,
+	                  uint64_t sourceSize, int64_t sourceTime);
+
+	MappedFile file;
+	const Entry *entries = nullptr;
+	size_t count = 0;
+	uint64_t skeletonOffset = 0, skeletonSize = 0;
+	uint64_t tablesOffset = 0, tablesSize = 0;
+};
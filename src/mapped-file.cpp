@@ -0,0 +1,91 @@
+#include "mapped-file.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+
+#include <nowide/convert.hpp>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string &path)
+{
+	Close();
+	HANDLE file = CreateFileW(nowide::widen(path).c_str(), GENERIC_READ,
+	                          FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+	                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE view = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!view)
+		return false;
+	void *p = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+	if (!p)
+	{
+		CloseHandle(view);
+		return false;
+	}
+	mapping = view;
+	data = static_cast<const char *>(p);
+	size = size_t(fileSize.QuadPart);
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (data)
+		UnmapViewOfFile(data);
+	if (mapping)
+		CloseHandle(mapping);
+	data = nullptr;
+	mapping = nullptr;
+	size = 0;
+}
+
+#else
+
+bool MappedFile::Open(const std::string &path)
+{
+	Close();
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		close(fd);
+		return false;
+	}
+	void *p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED)
+		return false;
+	data = static_cast<const char *>(p);
+	size = size_t(st.st_size);
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (data)
+		munmap(const_cast<char *>(data), size);
+	data = nullptr;
+	size = 0;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// read-only memory mapping of a whole file
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile &) = delete;
+	MappedFile &operator=(const MappedFile &) = delete;
+	~MappedFile()
+	{
+		Close();
+	}
+
+	// path is UTF-8. returns false if the file cannot be mapped.
+	bool Open(const std::string &path);
+	void Close();
+
+	const char *Data() const
+	{
+		return data;
+	}
+	size_t Size() const
+	{
+		return size;
+	}
+
+private:
+	const char *data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	void *mapping = nullptr;
+#endif
+};
@@ -2,172 +2,159 @@
 #pragma comment(lib, "shell32")
 #endif
 
-#include <algorithm>
-#include <cmath>
 #include <cstdio>
-#include <streambuf>
 #include <string>
 #include <vector>
 
-#include <nlohmann/json.hpp>
 #include <nowide/args.hpp>
-#include <nowide/cstdio.hpp>
-#include <nowide/fstream.hpp>
 #include <nowide/iostream.hpp>
 
-#include "invisible.hpp"
-#include "merge-name.h"
-#include "ps2tt.h"
-#include "tt2ps.h"
-
-const char *usage = reinterpret_cast<const char *>(u8"用法：\n\t%s 1.otd 2.otd [n.otd ...]\n");
-const char *loadfilefail = reinterpret_cast<const char *>(u8"读取文件 %s 失败\n");
-
-using json = nlohmann::json;
-
-std::string LoadFile(char *u8filename) {
-	static char u8buffer[4096];
-	nowide::ifstream file(u8filename);
-	if (!file) {
-		snprintf(u8buffer, sizeof u8buffer, loadfilefail, u8filename);
-		nowide::cerr << u8buffer << std::endl;
-		throw std::runtime_error("failed to load file");
-	}
-	std::string result{std::istreambuf_iterator<char>(file),
-	                   std::istreambuf_iterator<char>()};
-	return result;
-}
-
-bool IsPostScriptOutline(json &font) {
-	return font.find("CFF_") != font.end() || font.find("CFF2") != font.end();
-}
-
-// x' = a x + b y + dx
-// y' = c x + d y + dy
-void Transform(json &glyph, double a, double b, double c, double d, double dx,
-               double dy) {
-	glyph["advanceWidth"] = round(a * double(glyph["advanceWidth"]));
-	if (glyph.find("advanceHeight") != glyph.end()) {
-		glyph["advanceHeight"] = round(d * double(glyph["advanceHeight"]));
-		glyph["verticalOrigin"] = round(d * double(glyph["verticalOrigin"]));
+#include "alloc-profile.h"
+#include "batch.h"
+#include "daemon.h"
+#include "merge.h"
+#include "trace.h"
+
+const char *usage = reinterpret_cast<const char *>(
+    u8"用法：\n\t%s [选项] 1.otd 2.otd [n.otd ...]\n"
+    u8"选项：\n"
+    u8"\t-v, --verbose       输出曲线转换统计\n"
+    u8"\t--cache=<文件>      缓存曲线转换结果\n"
+    u8"\t--spline            PostScript 曲线转为 TrueType 时使用隐含曲线上点的样条，减少点数\n"
+    u8"\t--simplify[=<容差>] 删除多余的点，轮廓偏移小于容差（默认为 1）\n"
+    u8"\t--full-precision    保留坐标、字宽的小数部分（默认取整）\n"
+    u8"\t--charset=<字符集>  只保留字符集中的字符，字符集为 gb2312、gbk、gb18030、big5 或码位列表文件\n"
+    u8"\t--rules=<文件>      按码位范围指定字符来自哪些字体\n"
+    u8"\t--plan              只读取 cmap 和字形引用，输出各字体贡献的字符、字形统计（JSON），不修改文件\n"
+    u8"\t--output=<文件>     输出到指定文件（默认覆盖 1.otd）\n"
+    u8"\t--batch=<文件>      按任务清单批量合并，每行为一次合并的参数，共用的字体只读取、处理一次\n"
+    u8"\t--jobs=<数量>       批量合并时同时运行的任务数（默认为 CPU 线程数）\n"
+    u8"\t--memory=<MB>       批量合并时按预计内存排队，同时运行的任务不超过此预算\n"
+    u8"\t--low-memory        只解析用到的字形，处理完一个字体就释放，减少内存峰值\n"
+    u8"\t--glyph-store=<目录> 补充字体逐个字形存入目录中的字形库，之后的合并只读入用到的字形\n"
+    u8"\t--stats[=<文件>]    输出每个阶段的耗时、CPU 时间、内存峰值增加和处理的字形、码位数量，指定文件时每个任务追加一行 JSON\n"
+    u8"\t--trace=<文件>      把各阶段、各线程的耗时写入 Chrome 跟踪文件（trace event JSON），可用 Perfetto 打开\n"
+    u8"\t--variant=<文件>    其后的字体只用于输出到该文件的版本，可以有多个，基础字体只读取、处理一次\n"
+    u8"\t--serve=<套接字>    常驻后台，接收 --connect 发来的任务；其后的字体读取、处理后常驻内存\n"
+    u8"\t--connect=<套接字>  把合并任务交给常驻的 merge-otd，--output=- 时结果输出到标准输出\n"
+    u8"以下选项只作用于紧随其后的字体文件：\n"
+    u8"\t--scale=<比例>[,<纵向比例>]  缩放字形\n"
+    u8"\t--offset=<x>,<y>    缩放后平移字形（单位与 1.otd 相同）\n");
+const char *tracefail = reinterpret_cast<const char *>(u8"写入跟踪文件 %s 失败\n");
+const char *batchfail = reinterpret_cast<const char *>(u8"读取任务清单 %s 失败\n");
+const char *batchlinefail = reinterpret_cast<const char *>(u8"任务清单 %s 第 %lu 行格式错误\n");
+const char *batchjobfail = reinterpret_cast<const char *>(u8"任务清单 %s 第 %lu 个任务参数错误\n");
+
+/* run the jobs of a manifest. options on the command line apply to every
+   job, before the job's own.
+*/
+int RunBatch(const Options &options, const std::vector<std::string> &common) {
+	char u8buffer[4096];
+	const std::string &batchPath = options.batchPath;
+	std::vector<std::vector<std::string>> lines;
+	size_t errorLine;
+	if (!ReadManifest(batchPath.c_str(), lines, errorLine)) {
+		if (errorLine)
+			snprintf(u8buffer, sizeof u8buffer, batchlinefail,
+			         batchPath.c_str(), (unsigned long)errorLine);
+		else
+			snprintf(u8buffer, sizeof u8buffer, batchfail, batchPath.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
 	}
-	if (glyph.find("contours") != glyph.end())
-		for (auto &contour : glyph["contours"])
-			for (auto &point : contour) {
-				double x = point["x"];
-				double y = point["y"];
-				point["x"] = int(a * x + b * y + dx);
-				point["y"] = int(c * x + d * y + dy);
-			}
-	if (glyph.find("references") != glyph.end())
-		for (auto &reference : glyph["references"]) {
-			double x = reference["x"];
-			double y = reference["y"];
-			reference["x"] = int(a * x + b * y + dx);
-			reference["y"] = int(c * x + d * y + dy);
-		}
-}
 
-// move referenced glyphs recursively
-void MoveRef(json &glyph, json &base, json &ext) {
-	if (glyph.find("references") != glyph.end())
-		for (auto &r : glyph["references"]) {
-			std::string name = r["glyph"];
-			if (base["glyf"].find(name) == base["glyf"].end()) {
-				base["glyf"][name] = std::move(ext["glyf"][name]);
-				MoveRef(base["glyf"][name], base, ext);
-			}
+	std::vector<Options> jobs(lines.size());
+	for (size_t i = 0; i < jobs.size(); i++) {
+		std::vector<std::string> args = common;
+		args.insert(args.end(), lines[i].begin(), lines[i].end());
+		Options &job = jobs[i];
+		if (!ParseOptions(args, job) || job.files.size() < 2 || job.plan ||
+		    job.batchPath != batchPath || !job.variants.empty()) {
+			snprintf(u8buffer, sizeof u8buffer, batchjobfail, batchPath.c_str(),
+			         (unsigned long)i + 1);
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
 		}
+	}
+	return RunJobs(jobs, options.jobs, options.memoryBudget, options.verbose);
 }
 
-bool IsGidOrCid(const std::string &name) {
-	return (name.length() >= 6 && name.substr(0, 5) == "glyph") ||
-	       (name.length() >= 4 && name.substr(0, 3) == "cid");
-}
-
-void FixGlyphName(json &font, const std::string &prefix) {
-	for (auto &[u, n] : font["cmap"].items()) {
-		std::string name = n;
-		if (IsGidOrCid(name))
-			n = prefix + name;
-	}
-	std::vector<std::string> mod;
-	for (auto &[n, g] : font["glyf"].items()) {
-		if (IsGidOrCid(n))
-			mod.push_back(n);
-		if (g.find("references") != g.end()) {
-			auto &ref = g["references"];
-			for (auto &d : ref)
-				if (IsGidOrCid(d["glyph"]))
-					d["glyph"] = prefix + std::string(d["glyph"]);
-		}
-	}
-	auto &glyf = font["glyf"];
-	for (auto &n : mod) {
-		glyf[prefix + n] = glyf[n];
-		glyf.erase(n);
+/* one job per variant: the files before the first --variant, followed by
+   the variant's own. returns false if a variant has no base or fallback.
+*/
+bool SplitVariants(const Options &options, std::vector<Options> &jobs) {
+	const auto &variants = options.variants;
+	size_t common = variants[0].first;
+	if (!common)
+		return false;
+	for (size_t v = 0; v < variants.size(); v++) {
+		size_t last = v + 1 < variants.size() ? variants[v + 1].first
+		                                      : options.files.size();
+		Options job = options;
+		job.variants.clear();
+		job.output = variants[v].output;
+		job.files.assign(options.files.begin(), options.files.begin() + common);
+		job.adjusts.assign(options.adjusts.begin(),
+		                   options.adjusts.begin() + common);
+		job.files.insert(job.files.end(),
+		                 options.files.begin() + variants[v].first,
+		                 options.files.begin() + last);
+		job.adjusts.insert(job.adjusts.end(),
+		                   options.adjusts.begin() + variants[v].first,
+		                   options.adjusts.begin() + last);
+		if (job.files.size() < 2)
+			return false;
+		jobs.push_back(std::move(job));
 	}
+	return true;
 }
 
-void MergeFont(json &base, json &ext) {
-	double baseUpm = base["head"]["unitsPerEm"];
-	double extUpm = ext["head"]["unitsPerEm"];
-
-	if (baseUpm != extUpm) {
-		for (auto &glyph : ext["glyf"])
-			Transform(glyph, baseUpm / extUpm, 0, 0, baseUpm / extUpm, 0, 0);
+// what the command line asks for, once its options are parsed
+int Run(const std::vector<std::string> &args, const Options &options,
+        bool good, const char *u8argv0) {
+	static char u8buffer[4096];
+	if (good && !options.connectPath.empty()) {
+		// the server parses the job
+		std::vector<std::string> job;
+		for (auto &arg : args)
+			if (arg.substr(0, 10) != "--connect=")
+				job.push_back(arg);
+		return Request(options.connectPath, job, options.verbose);
 	}
-
-	for (json::iterator it = ext["cmap"].begin(); it != ext["cmap"].end();
-	     ++it) {
-		if (base["cmap"].find(it.key()) == base["cmap"].end()) {
-			std::string name = *it;
-			base["cmap"][it.key()] = ext["cmap"][it.key()];
-			if (base["glyf"].find(name) == base["glyf"].end()) {
-				base["glyf"][name] = std::move(ext["glyf"][name]);
-				MoveRef(base["glyf"][name], base, ext);
-			}
-		}
+	if (good && !options.servePath.empty()) {
+		// job options come with each job
+		if (options.output.empty() && options.batchPath.empty() &&
+		    options.variants.empty() && !options.plan &&
+		    options.charsetName.empty() && options.rulesPath.empty())
+			return Serve(options);
+		good = false;
 	}
-}
-
-void RemoveBlankGlyph(json &font) {
-	static UnicodeInvisible invisible;
-	std::vector<std::string> eraseList;
-
-	for (json::iterator it = font["cmap"].begin(); it != font["cmap"].end();
-	     ++it) {
-		if (!invisible.CanBeInvisible(std::stoi(it.key()))) {
-			std::string name = it.value();
-			auto &glyph = font["glyf"][name];
-			if (glyph.find("contours") == glyph.end() &&
-			    glyph.find("references") == glyph.end())
-				eraseList.push_back(it.key());
-		}
+	if (good && !options.batchPath.empty()) {
+		// the remaining arguments are common to all jobs
+		if (options.files.empty() && options.variants.empty())
+			return RunBatch(options, args);
+		good = false;
 	}
-
-	for (auto g : eraseList) {
-		std::string name = font["cmap"][g];
-		font["cmap"].erase(g);
-		if (std::find_if(font["cmap"].begin(), font["cmap"].end(),
-		                 [name](auto v) { return v == name; }) ==
-		    font["cmap"].end())
-			font["glyf"].erase(name);
+	if (good && !options.variants.empty()) {
+		std::vector<Options> jobs;
+		if (options.output.empty() && !options.plan &&
+		    SplitVariants(options, jobs))
+			return RunJobs(jobs, options.jobs, options.memoryBudget,
+			               options.verbose);
+		good = false;
+	}
+	if (options.files.size() < 2 || !good) {
+		snprintf(u8buffer, sizeof u8buffer, usage, u8argv0);
+		nowide::cout << u8buffer << std::endl;
+		return EXIT_FAILURE;
 	}
-}
-
-json MergeCodePage(std::vector<json> cpranges) {
-	json result = json::object();
-
-	for (auto &cprange : cpranges)
-		for (auto &[k, v] : cprange.items()) {
-			// std::cerr << cprange << ' ' << k << std::endl;
-			if (result.find(k) != result.end())
-				result[k] = result[k] || v;
-			else
-				result[k] = v;
-		}
 
+	std::unique_ptr<OutlineCache> cache;
+	if (!options.cachePath.empty())
+		cache = std::make_unique<OutlineCache>(options.cachePath);
+	int result = Merge(options, cache.get(), nullptr);
+	if (cache && result == 0)
+		SaveCache(*cache, options.cachePath, options.verbose);
 	return result;
 }
 
@@ -175,69 +162,20 @@ int main(int argc, char *u8argv[]) {
 	static char u8buffer[4096];
 	nowide::args _{argc, u8argv};
 
-	if (argc < 3) {
-		snprintf(u8buffer, sizeof u8buffer, usage, u8argv[0]);
-		nowide::cout << u8buffer << std::endl;
-		return EXIT_FAILURE;
-	}
-
-	std::vector<json> ulCodePageRanges1, ulCodePageRanges2;
-	std::vector<json> nametables;
-
-	json base;
-	bool basecff;
-	try {
-		auto s = LoadFile(u8argv[1]);
-		base = json::parse(s);
-	} catch (const std::runtime_error &) {
+	std::vector<std::string> args(u8argv + 1, u8argv + argc);
+	Options options;
+	bool good = ParseOptions(args, options);
+	if (good && !options.tracePath.empty())
+		StartTrace();
+	int result = Run(args, options, good, u8argv[0]);
+	if (AllocProfiling() && options.stats)
+		PrintAllocStats();
+	if (good && !options.tracePath.empty() &&
+	    !WriteTrace(options.tracePath)) {
+		snprintf(u8buffer, sizeof u8buffer, tracefail,
+		         options.tracePath.c_str());
+		nowide::cerr << u8buffer;
 		return EXIT_FAILURE;
 	}
-	basecff = IsPostScriptOutline(base);
-	RemoveBlankGlyph(base);
-	nametables.push_back(base["name"]);
-
-	for (int argi = 2; argi < argc; argi++) {
-		json ext;
-		try {
-			auto s = LoadFile(u8argv[argi]);
-			ext = json::parse(s);
-		} catch (std::runtime_error) {
-			return EXIT_FAILURE;
-		}
-		bool extcff = IsPostScriptOutline(ext);
-		if (basecff && !extcff) {
-			ext["glyf"] = Tt2Ps(ext["glyf"]);
-		} else if (!basecff && extcff) {
-			ext["glyf"] = Ps2Tt(ext["glyf"]);
-		}
-		RemoveBlankGlyph(ext);
-		nametables.push_back(ext["name"]);
-		FixGlyphName(ext, u8argv[argi] + std::string(":"));
-		MergeFont(base, ext);
-		if (ext.find("OS_2") != ext.end()) {
-			auto &OS_2 = ext["OS_2"];
-			if (OS_2.find("ulCodePageRange1") != OS_2.end())
-				ulCodePageRanges1.push_back(OS_2["ulCodePageRange1"]);
-			if (OS_2.find("ulCodePageRange2") != OS_2.end())
-				ulCodePageRanges2.push_back(OS_2["ulCodePageRange2"]);
-		}
-	}
-
-	if (base.find("OS_2") != base.end()) {
-		auto &OS_2 = base["OS_2"];
-		if (OS_2.find("ulCodePageRange1") != OS_2.end())
-			ulCodePageRanges1.push_back(OS_2["ulCodePageRange1"]);
-		if (OS_2.find("ulCodePageRange2") != OS_2.end())
-			ulCodePageRanges2.push_back(OS_2["ulCodePageRange2"]);
-
-		OS_2["ulCodePageRange1"] = MergeCodePage(ulCodePageRanges1);
-		OS_2["ulCodePageRange2"] = MergeCodePage(ulCodePageRanges2);
-	}
-
-	base["name"] = MergeNameTable(nametables);
-
-	std::string out = base.dump();
-	FILE *outfile = nowide::fopen(u8argv[1], "wb");
-	fwrite(out.c_str(), 1, out.size(), outfile);
-	return 0;
+	return result;
 }
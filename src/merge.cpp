@@ -0,0 +1,1223 @@
+﻿#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <nlohmann/json.hpp>
+#include <nowide/cstdio.hpp>
+#include <nowide/fstream.hpp>
+#include <nowide/iostream.hpp>
+
+#include "alloc-profile.h"
+#include "glyph-order.h"
+#include "glyph-store.h"
+#include "invisible.hpp"
+#include "mapped-file.h"
+#include "merge-name.h"
+#include "merge.h"
+#include "packed-glyph.h"
+#include "phase-stats.h"
+#include "ps2tt.h"
+#include "simplify.h"
+#include "skeleton.h"
+#include "source-selector.h"
+#include "subset.h"
+#include "trace.h"
+#include "tt2ps.h"
+
+const char *loadfilefail = reinterpret_cast<const char *>(u8"读取文件 %s 失败\n");
+const char *outlinestats = reinterpret_cast<const char *>(
+    u8"%s：直线轮廓 %lu，精确转换轮廓 %lu（曲线 %lu），近似转换轮廓 %lu（曲线 %lu）\n");
+const char *cachestats = reinterpret_cast<const char *>(
+    u8"曲线转换缓存：命中 %lu，未命中 %lu，节省 %.2f 秒（读取缓存 %.2f 秒，转换 %.2f 秒）\n");
+const char *simplifystats = reinterpret_cast<const char *>(
+    u8"简化轮廓：删除 %lu 个点（%lu 个字形）\n");
+const char *charsetfail = reinterpret_cast<const char *>(u8"读取字符集 %s 失败\n");
+const char *charsetlinefail = reinterpret_cast<const char *>(u8"字符集 %s 第 %lu 行格式错误\n");
+const char *rulesfail = reinterpret_cast<const char *>(u8"读取规则 %s 失败\n");
+const char *ruleslinefail = reinterpret_cast<const char *>(u8"规则 %s 第 %lu 行格式错误\n");
+const char *subsetstats = reinterpret_cast<const char *>(
+    u8"字符集：删除 %lu 个字符，%lu 个字形\n");
+const char *inputfail = reinterpret_cast<const char *>(u8"处理文件 %s 失败：%s\n");
+const char *savefilefail = reinterpret_cast<const char *>(u8"写入文件 %s 失败\n");
+const char *storefail = reinterpret_cast<const char *>(u8"读取或生成字形库 %s 失败\n");
+const char *jobfail = reinterpret_cast<const char *>(u8"任务 %lu 失败\n");
+const char *jobstats = reinterpret_cast<const char *>(u8"任务 %lu：%s，%.2f 秒\n");
+const char *cachesavefail = reinterpret_cast<const char *>(u8"写入缓存 %s 失败\n");
+const char *admitstats = reinterpret_cast<const char *>(
+    u8"任务 %lu：预计内存 %lu MB，已分配 %lu MB，排队 %lu 个\n");
+const char *memorystats = reinterpret_cast<const char *>(
+    u8"内存预算 %lu MB：分配峰值 %lu MB，实际峰值 %lu MB，最多排队 %lu 个任务\n");
+const char *packstats = reinterpret_cast<const char *>(
+    u8"共用字体的字形：压缩 %lu 个，平均 %.1f 字节（共 %.1f MB），解码 %lu 个，每秒 %.0f 个\n");
+const char *phasestats = reinterpret_cast<const char *>(
+    u8"%s：%.3f 秒，CPU %.3f 秒，内存峰值增加 %.1f MB%s\n");
+const char *phasetotal = reinterpret_cast<const char *>(
+    u8"合计：%.3f 秒，CPU %.3f 秒，内存峰值 %lu MB\n");
+const char *allocstats = reinterpret_cast<const char *>(
+    u8"%s 阶段分配：%lu 次，%.1f MB，释放 %lu 次，未释放 %.1f MB，未释放峰值 %.1f MB\n");
+
+using json = nlohmann::json;
+
+std::string LoadFile(const char *u8filename) {
+	char u8buffer[4096];
+	nowide::ifstream file(u8filename);
+	if (!file) {
+		snprintf(u8buffer, sizeof u8buffer, loadfilefail, u8filename);
+		nowide::cerr << u8buffer << std::endl;
+		throw std::runtime_error("failed to load file");
+	}
+	std::string result{std::istreambuf_iterator<char>(file),
+	                   std::istreambuf_iterator<char>()};
+	return result;
+}
+
+std::string Load(const Options &options, const std::string &file) {
+	return options.load ? options.load(file) : LoadFile(file.c_str());
+}
+
+bool IsPostScriptOutline(const json &font) {
+	return font.find("CFF_") != font.end() || font.find("CFF2") != font.end();
+}
+
+// take a glyph out of ext: moved if ext is owned, decoded if shared
+json Take(json &glyph) {
+	return std::move(glyph);
+}
+json Take(const json &glyph) {
+	return UnpackGlyph(glyph);
+}
+
+/* member of ext: null if missing, as operator[] inserts for an owned ext,
+   where const operator[] would fail an assertion
+*/
+json &Member(json &value, const std::string &key) {
+	return value[key];
+}
+const json &Member(const json &value, const std::string &key) {
+	static const json null;
+	auto it = value.find(key);
+	return it != value.end() ? *it : null;
+}
+
+// move referenced glyphs recursively
+template <typename Ext>
+void MoveRef(const json &glyph, json &base, Ext &ext,
+             std::map<std::string, std::string> &renamed,
+             std::vector<json *> &moved) {
+	if (glyph.find("references") != glyph.end())
+		for (auto &r : glyph["references"]) {
+			std::string name = r["glyph"];
+			if (base["glyf"].find(name) == base["glyf"].end()) {
+				auto &glyf = Member(ext, "glyf");
+				auto it = glyf.find(name);
+				json &moving = base["glyf"][name] =
+				    it != glyf.end() ? Take(*it) : json();
+				renamed[name] = name;
+				moved.push_back(&moving);
+				MoveRef(moving, base, ext, renamed, moved);
+			}
+		}
+}
+
+// move glyph and its references, renaming those whose names are taken
+template <typename Ext>
+std::string MoveRenamed(const std::string &name, json &base, Ext &ext,
+                        const std::string &prefix,
+                        std::map<std::string, std::string> &renamed,
+                        std::vector<json *> &moved) {
+	auto it = renamed.find(name);
+	if (it != renamed.end())
+		// already moved, renamed or not
+		return it->second;
+	auto &glyf = Member(ext, "glyf");
+	auto glyph = glyf.find(name);
+	if (glyph == glyf.end())
+		return name;
+	std::string newName = name;
+	if (base["glyf"].find(name) != base["glyf"].end())
+		newName = prefix + name;
+	renamed[name] = newName;
+	json &moving = base["glyf"][newName] = Take(*glyph);
+	moved.push_back(&moving);
+	if (moving.find("references") != moving.end())
+		for (auto &r : moving["references"])
+			r["glyph"] =
+			    MoveRenamed(r["glyph"], base, ext, prefix, renamed, moved);
+	return newName;
+}
+
+// give memory freed by a dropped font back to the system
+void ReleaseMemory() {
+#ifdef __GLIBC__
+	malloc_trim(0);
+#endif
+}
+
+// glyph store of file in directory, by its name and a hash of its path
+std::string StorePath(const std::string &directory, const std::string &file) {
+	size_t slash = file.find_last_of("/\\");
+	std::string name = slash == std::string::npos ? file : file.substr(slash + 1);
+	unsigned long long hash = 0xcbf29ce484222325; // FNV-1a
+	for (unsigned char c : file)
+		hash = (hash ^ c) * 0x100000001b3;
+	char suffix[32];
+	snprintf(suffix, sizeof suffix, "-%016llx.glyphs", hash);
+	return directory + "/" + name + suffix;
+}
+
+bool IsGidOrCid(const std::string &name) {
+	return (name.length() >= 6 && name.substr(0, 5) == "glyph") ||
+	       (name.length() >= 4 && name.substr(0, 3) == "cid");
+}
+
+void FixGlyphName(json &font, const std::string &prefix) {
+	for (auto &[u, n] : font["cmap"].items()) {
+		std::string name = n;
+		if (IsGidOrCid(name))
+			n = prefix + name;
+	}
+	std::vector<std::string> mod;
+	for (auto &[n, g] : font["glyf"].items()) {
+		if (IsGidOrCid(n))
+			mod.push_back(n);
+		if (g.find("references") != g.end()) {
+			auto &ref = g["references"];
+			for (auto &d : ref)
+				if (IsGidOrCid(d["glyph"]))
+					d["glyph"] = prefix + std::string(d["glyph"]);
+		}
+	}
+	auto &glyf = font["glyf"];
+	for (auto &n : mod) {
+		glyf[prefix + n] = glyf[n];
+		glyf.erase(n);
+	}
+}
+
+/* selected: code points of ext that it supplies. prefix: for renaming
+   glyphs of code points covered by rules, whose names may be taken. moved:
+   glyphs moved into base. ext is const when shared between jobs, its glyphs
+   are then copied. returns whether any code point was replaced.
+*/
+template <typename Ext>
+bool MoveGlyphs(json &base, Ext &ext,
+                const std::vector<SourceSelector::Selected> &selected,
+                const std::string &prefix, std::vector<json *> &moved) {
+	std::map<std::string, std::string> renamed;
+	bool replaced = false;
+	for (auto [u, ruled] : selected) {
+		std::string key = std::to_string(u);
+		std::string name = Member(Member(ext, "cmap"), key);
+		if (ruled) {
+			replaced = replaced || base["cmap"].find(key) != base["cmap"].end();
+			base["cmap"][key] =
+			    MoveRenamed(name, base, ext, prefix, renamed, moved);
+			continue;
+		}
+		base["cmap"][key] = name;
+		if (base["glyf"].find(name) == base["glyf"].end()) {
+			auto &glyf = Member(ext, "glyf");
+			auto it = glyf.find(name);
+			json &moving = base["glyf"][name] =
+			    it != glyf.end() ? Take(*it) : json();
+			renamed[name] = name;
+			moved.push_back(&moving);
+			MoveRef(moving, base, ext, renamed, moved);
+		}
+	}
+	return replaced;
+}
+
+template <typename Ext>
+bool MergeFont(json &base, Ext &ext,
+               const std::vector<SourceSelector::Selected> &selected,
+               const std::string &prefix, const Affine &adjust,
+               bool roundToInt) {
+	double baseUpm = base["head"]["unitsPerEm"];
+	double extUpm = Member(Member(ext, "head"), "unitsPerEm");
+	Affine transform =
+	    adjust * Affine::Scale(baseUpm / extUpm, baseUpm / extUpm);
+
+	std::vector<json *> moved;
+	bool replaced = MoveGlyphs(base, ext, selected, prefix, moved);
+
+	// only glyphs moved into base, in one pass
+	if (!transform.IsIdentity())
+		TransformGlyphs(moved, transform, roundToInt);
+	return replaced;
+}
+template bool MergeFont(json &base, json &ext,
+                        const std::vector<SourceSelector::Selected> &selected,
+                        const std::string &prefix, const Affine &adjust,
+                        bool roundToInt);
+
+void RoundToInteger(json &value) {
+	if (value.is_number_float())
+		value = int(round(double(value)));
+}
+
+// font units as json integers, so that they are dumped without ".0"
+void RoundGlyphs(json &glyf) {
+	for (auto &glyph : glyf) {
+		for (const char *key :
+		     {"advanceWidth", "advanceHeight", "verticalOrigin"})
+			if (glyph.find(key) != glyph.end())
+				RoundToInteger(glyph[key]);
+		if (glyph.find("contours") != glyph.end())
+			for (auto &contour : glyph["contours"])
+				for (auto &point : contour) {
+					RoundToInteger(point["x"]);
+					RoundToInteger(point["y"]);
+				}
+		if (glyph.find("references") != glyph.end())
+			for (auto &reference : glyph["references"]) {
+				RoundToInteger(reference["x"]);
+				RoundToInteger(reference["y"]);
+			}
+	}
+}
+
+void RemoveBlankGlyph(json &font) {
+	static UnicodeInvisible invisible;
+	std::vector<std::string> eraseList;
+
+	for (json::iterator it = font["cmap"].begin(); it != font["cmap"].end();
+	     ++it) {
+		if (!invisible.CanBeInvisible(std::stoi(it.key()))) {
+			std::string name = it.value();
+			auto &glyph = font["glyf"][name];
+			if (glyph.find("contours") == glyph.end() &&
+			    glyph.find("references") == glyph.end())
+				eraseList.push_back(it.key());
+		}
+	}
+
+	for (auto g : eraseList) {
+		std::string name = font["cmap"][g];
+		font["cmap"].erase(g);
+		if (std::find_if(font["cmap"].begin(), font["cmap"].end(),
+		                 [name](auto v) { return v == name; }) ==
+		    font["cmap"].end())
+			font["glyf"].erase(name);
+	}
+}
+
+json MergeCodePage(std::vector<json> cpranges) {
+	json result = json::object();
+
+	for (auto &cprange : cpranges)
+		for (auto &[k, v] : cprange.items()) {
+			// std::cerr << cprange << ' ' << k << std::endl;
+			if (result.find(k) != result.end())
+				result[k] = result[k] || v;
+			else
+				result[k] = v;
+		}
+
+	return result;
+}
+
+// "x" or "x,y", returns count of numbers
+int ParseNumbers(const std::string &s, double &x, double &y) {
+	const char *p = s.c_str();
+	char *end;
+	x = strtod(p, &end);
+	if (end == p)
+		return 0;
+	if (*end == 0) {
+		y = x;
+		return 1;
+	}
+	if (*end != ',')
+		return 0;
+	p = end + 1;
+	y = strtod(p, &end);
+	return end != p && *end == 0 ? 2 : 0;
+}
+
+void PrintOutlineStats(const char *direction, const OutlineStats &stats) {
+	char u8buffer[4096];
+	snprintf(u8buffer, sizeof u8buffer, outlinestats, direction,
+	         (unsigned long)stats.lineContours,
+	         (unsigned long)stats.exactContours,
+	         (unsigned long)stats.exactSegments,
+	         (unsigned long)stats.approxContours,
+	         (unsigned long)stats.approxSegments);
+	nowide::cerr << u8buffer;
+}
+
+// contour points of every glyph
+size_t CountPoints(const json &glyf) {
+	size_t points = 0;
+	for (auto &glyph : glyf) {
+		auto contours = glyph.find("contours");
+		if (contours != glyph.end())
+			for (auto &contour : *contours)
+				points += contour.size();
+	}
+	return points;
+}
+
+// entries of font removed since it had cmap code points and glyphs glyphs
+void CountErased(PhaseStats &phases, const json &font, size_t cmap,
+                 size_t glyphs) {
+	phases.Count("cmapErased", cmap - font["cmap"].size());
+	phases.Count("glyphsErased", glyphs - font["glyf"].size());
+}
+
+/* print the phases of the job writing output, or append them to
+   options.statsPath as a line of JSON, one per job. returns EXIT_FAILURE if
+   the file cannot be written.
+*/
+int ReportPhases(const PhaseStats &phases, const Options &options,
+                 const std::string &output) {
+	char u8buffer[4096];
+	if (options.stats) {
+		std::lock_guard<std::mutex> lock(outputMutex);
+		double seconds = 0, cpuSeconds = 0;
+		for (auto &phase : phases.Phases()) {
+			std::string phaseName = phase.name, counts;
+			if (!phase.input.empty())
+				phaseName += " " + phase.input;
+			for (auto &[kind, n] : phase.counts)
+				counts += reinterpret_cast<const char *>(u8"，") + kind + " " +
+				          std::to_string(n);
+			snprintf(u8buffer, sizeof u8buffer, phasestats, phaseName.c_str(),
+			         phase.seconds, phase.cpuSeconds,
+			         phase.peakGrowth / 1048576.0, counts.c_str());
+			nowide::cerr << u8buffer;
+			seconds += phase.seconds;
+			cpuSeconds += phase.cpuSeconds;
+		}
+		snprintf(u8buffer, sizeof u8buffer, phasetotal, seconds, cpuSeconds,
+		         (unsigned long)(PeakMemory() >> 20));
+		nowide::cerr << u8buffer;
+	}
+	if (!options.statsPath.empty()) {
+		json report = phases.Report();
+		report["output"] = output;
+		std::lock_guard<std::mutex> lock(outputMutex);
+		nowide::ofstream file(options.statsPath.c_str(), std::ios::app);
+		if (!(file << report.dump() << std::endl)) {
+			snprintf(u8buffer, sizeof u8buffer, savefilefail,
+			         options.statsPath.c_str());
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
+		}
+	}
+	return 0;
+}
+
+void PrintCacheStats(const OutlineCache::Stats &stats) {
+	char u8buffer[4096];
+	snprintf(u8buffer, sizeof u8buffer, cachestats, (unsigned long)stats.hits,
+	         (unsigned long)stats.misses,
+	         stats.savedSeconds - stats.hitSeconds, stats.hitSeconds,
+	         stats.missSeconds);
+	nowide::cerr << u8buffer;
+}
+
+// "4E00" or "4E00-9FFF", as accepted by --charset files
+std::string FormatRange(int first, int last) {
+	char buffer[32];
+	if (first == last)
+		snprintf(buffer, sizeof buffer, "%04X", first);
+	else
+		snprintf(buffer, sizeof buffer, "%04X-%04X", first, last);
+	return buffer;
+}
+
+/* merge skeletons the way main merges fonts, without outlines, and report
+   which source supplies each code point and glyph as JSON on stdout.
+*/
+int Plan(const std::vector<std::string> &files, const Charset *charset,
+         const std::string &charsetName, SourceSelector &selector) {
+	char u8buffer[4096];
+	auto start = std::chrono::steady_clock::now();
+
+	json report = {{"sources", json::array()}};
+	json base;
+	bool basecff = false;
+	bool collect = false;
+	for (size_t i = 0; i < files.size(); i++) {
+		json font;
+		if (!LoadSkeleton(files[i].c_str(), font)) {
+			snprintf(u8buffer, sizeof u8buffer, loadfilefail,
+			         files[i].c_str());
+			nowide::cerr << u8buffer << std::endl;
+			return EXIT_FAILURE;
+		}
+		bool cff = IsPostScriptOutline(font);
+		for (auto &glyph : font["glyf"])
+			glyph["source"] = i;
+		if (i == 0)
+			RemoveBlankGlyph(font);
+		if (charset) {
+			SubsetCmap(font, *charset);
+			CollectGarbage(font, i == 0);
+		}
+		json source = {
+		    {"file", files[i]},
+		    {"outline", cff ? "PostScript" : "TrueType"},
+		    {"unitsPerEm", font["head"]["unitsPerEm"]},
+		    {"codepoints", font["cmap"].size()},
+		    {"glyphs", font["glyf"].size()},
+		    {"converted", i > 0 && cff != basecff ? font["glyf"].size() : 0}};
+
+		if (i == 0) {
+			basecff = cff;
+			base = std::move(font);
+			auto selected = selector.Select(base["cmap"], 0);
+			if (selected.size() != base["cmap"].size()) {
+				json cmap = json::object();
+				for (auto [u, ruled] : selected) {
+					std::string key = std::to_string(u);
+					cmap[key] = std::move(base["cmap"][key]);
+				}
+				base["cmap"] = std::move(cmap);
+				collect = true;
+			}
+			source["moved"] = base["glyf"].size();
+		} else {
+			RemoveBlankGlyph(font);
+			FixGlyphName(font, files[i] + std::string(":"));
+			std::vector<json *> moved;
+			if (MoveGlyphs(base, font, selector.Select(font["cmap"], int(i)),
+			               files[i] + std::string(":"), moved))
+				collect = true;
+			source["moved"] = moved.size();
+		}
+		report["sources"].push_back(std::move(source));
+	}
+	if (collect)
+		CollectGarbage(base, true);
+
+	// final assignment, after later sources and rules took their share
+	std::vector<size_t> codepoints(files.size()), glyphs(files.size());
+	std::vector<int> assigned;
+	for (auto &[u, n] : base["cmap"].items()) {
+		int codepoint = std::stoi(u);
+		assigned.push_back(codepoint);
+		int owner = selector.Owner(codepoint);
+		if (owner >= 0)
+			codepoints[owner]++;
+	}
+	for (auto &glyph : base["glyf"])
+		glyphs[glyph["source"].get<size_t>()]++;
+	report["unused"] = json::array();
+	for (size_t i = 0; i < files.size(); i++) {
+		report["sources"][i]["final"] = {{"codepoints", codepoints[i]},
+		                                 {"glyphs", glyphs[i]}};
+		if (!codepoints[i])
+			report["unused"].push_back(files[i]);
+	}
+	report["total"] = {{"codepoints", base["cmap"].size()},
+	                   {"glyphs", base["glyf"].size()}};
+
+	if (charset) {
+		std::sort(assigned.begin(), assigned.end());
+		size_t size = 0, covered = 0;
+		json missing = json::array();
+		auto u = assigned.begin();
+		for (auto [first, last] : charset->Ranges()) {
+			size += last - first + 1;
+			u = std::lower_bound(u, assigned.end(), first);
+			int gap = first;
+			for (; u != assigned.end() && *u <= last; ++u) {
+				if (*u > gap)
+					missing.push_back(FormatRange(gap, *u - 1));
+				gap = *u + 1;
+				covered++;
+			}
+			if (gap <= last)
+				missing.push_back(FormatRange(gap, last));
+		}
+		report["charset"] = {{"name", charsetName},
+		                     {"size", size},
+		                     {"covered", covered},
+		                     {"missing", size - covered},
+		                     {"missingRanges", std::move(missing)}};
+	}
+
+	report["seconds"] = std::chrono::duration<double>(
+	                        std::chrono::steady_clock::now() - start)
+	                        .count();
+	nowide::cout << report.dump(2) << std::endl;
+	return 0;
+}
+
+bool ParseOptions(const std::vector<std::string> &args, Options &options) {
+	double scaleX = 1, scaleY = 1, offsetX = 0, offsetY = 0;
+	bool badOption = false;
+	for (auto &arg : args) {
+		if (arg == "-v" || arg == "--verbose")
+			options.verbose = true;
+		else if (arg.substr(0, 8) == "--cache=")
+			options.cachePath = arg.substr(8);
+		else if (arg == "--spline")
+			options.spline = true;
+		else if (arg.substr(0, 8) == "--rules=")
+			options.rulesPath = arg.substr(8);
+		else if (arg.substr(0, 10) == "--charset=")
+			options.charsetName = arg.substr(10);
+		else if (arg == "--full-precision")
+			options.fullPrecision = true;
+		else if (arg == "--low-memory")
+			options.lowMemory = true;
+		else if (arg == "--stats")
+			options.stats = true;
+		else if (arg.substr(0, 8) == "--stats=")
+			options.statsPath = arg.substr(8);
+		else if (arg.substr(0, 8) == "--trace=")
+			options.tracePath = arg.substr(8);
+		else if (arg == "--plan")
+			options.plan = true;
+		else if (arg.substr(0, 9) == "--output=")
+			options.output = arg.substr(9);
+		else if (arg.substr(0, 8) == "--batch=")
+			options.batchPath = arg.substr(8);
+		else if (arg.substr(0, 8) == "--serve=")
+			options.servePath = arg.substr(8);
+		else if (arg.substr(0, 10) == "--connect=")
+			options.connectPath = arg.substr(10);
+		else if (arg.substr(0, 14) == "--glyph-store=")
+			options.glyphStore = arg.substr(14);
+		else if (arg.substr(0, 10) == "--variant=")
+			options.variants.push_back({arg.substr(10), options.files.size()});
+		else if (arg.substr(0, 9) == "--memory=") {
+			options.memoryBudget =
+			    size_t(strtoull(arg.c_str() + 9, nullptr, 10)) << 20;
+			badOption = badOption || !options.memoryBudget;
+		} else if (arg.substr(0, 7) == "--jobs=") {
+			options.jobs = unsigned(strtoul(arg.c_str() + 7, nullptr, 10));
+			badOption = badOption || !options.jobs;
+		} else if (arg == "--simplify")
+			options.tolerance = 1;
+		else if (arg.substr(0, 11) == "--simplify=") {
+			options.tolerance = strtod(arg.c_str() + 11, nullptr);
+			badOption = badOption || !(options.tolerance > 0);
+		} else if (arg.substr(0, 8) == "--scale=")
+			badOption = badOption ||
+			            !ParseNumbers(arg.substr(8), scaleX, scaleY) ||
+			            !scaleX || !scaleY;
+		else if (arg.substr(0, 9) == "--offset=")
+			badOption = badOption ||
+			            ParseNumbers(arg.substr(9), offsetX, offsetY) != 2;
+		else {
+			options.files.push_back(arg);
+			options.adjusts.push_back(Affine::Translate(offsetX, offsetY) *
+			                          Affine::Scale(scaleX, scaleY));
+			scaleX = scaleY = 1;
+			offsetX = offsetY = 0;
+		}
+	}
+	// per-font options must be followed by a file
+	return !badOption && scaleX == 1 && scaleY == 1 && !offsetX && !offsetY;
+}
+
+std::mutex outputMutex;
+
+/* what the preprocessing of a shared input depends on, besides its file:
+   the charset, and for fallback fonts the outline format of base
+*/
+std::string InputVariant(const Options &options, bool isBase, bool basecff) {
+	if (isBase)
+		return options.charsetName;
+	return options.charsetName +
+	       (basecff ? options.fullPrecision ? "\nPostScript full"
+	                                        : "\nPostScript"
+	        : options.spline ? "\nTrueType spline"
+	                         : "\nTrueType");
+}
+
+int Merge(const Options &options, OutlineCache *cache, InputCache *inputs) {
+	char u8buffer[4096];
+	const auto &files = options.files;
+	bool roundToInt = !options.fullPrecision;
+
+	std::unique_ptr<Charset> charset;
+	if (!options.charsetName.empty()) {
+		const std::string &charsetName = options.charsetName;
+		charset = std::make_unique<Charset>();
+		size_t errorLine;
+		if (!charset->LoadBuiltin(charsetName) &&
+		    !charset->LoadFile(charsetName.c_str(), errorLine)) {
+			if (errorLine)
+				snprintf(u8buffer, sizeof u8buffer, charsetlinefail,
+				         charsetName.c_str(), (unsigned long)errorLine);
+			else
+				snprintf(u8buffer, sizeof u8buffer, charsetfail,
+				         charsetName.c_str());
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
+		}
+	}
+	size_t subsetCodepoints = 0, subsetGlyphs = 0;
+
+	SourceSelector selector;
+	if (!options.rulesPath.empty()) {
+		const std::string &rulesPath = options.rulesPath;
+		size_t errorLine;
+		if (!selector.LoadRules(rulesPath.c_str(), files, errorLine)) {
+			if (errorLine)
+				snprintf(u8buffer, sizeof u8buffer, ruleslinefail,
+				         rulesPath.c_str(), (unsigned long)errorLine);
+			else
+				snprintf(u8buffer, sizeof u8buffer, rulesfail,
+				         rulesPath.c_str());
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (options.plan)
+		return Plan(files, charset.get(), options.charsetName, selector);
+
+	// code points replaced or removed by rules leave garbage glyphs
+	bool collect = false;
+
+	std::vector<json> ulCodePageRanges1, ulCodePageRanges2;
+	std::vector<json> nametables;
+
+	PhaseStats phases;
+	// text of file, then its JSON
+	auto parse = [&](const std::string &file) {
+		phases.Begin("load", file);
+		std::string text = Load(options, file);
+		phases.Count("bytes", text.size());
+		phases.Begin("parse", file);
+		json font = json::parse(text);
+		phases.Count("glyphs", font["glyf"].size());
+		phases.Count("cmap", font["cmap"].size());
+		return font;
+	};
+
+	json base;
+	auto prepareBase = [&] {
+		json font = parse(files[0]);
+		phases.Begin("prepare", files[0]);
+		size_t cmap = font["cmap"].size(), glyphs = font["glyf"].size();
+		RemoveBlankGlyph(font);
+		if (charset) {
+			subsetCodepoints += SubsetCmap(font, *charset);
+			subsetGlyphs += CollectGarbage(font, true);
+		}
+		CountErased(phases, font, cmap, glyphs);
+		return font;
+	};
+	try {
+		// a shared base is copied, the job modifies it
+		if (inputs && inputs->Shared(files[0])) {
+			phases.Begin("wait", files[0]);
+			auto shared = inputs->Get(
+			    files[0], InputVariant(options, true, false), prepareBase);
+			phases.Begin("copy", files[0]);
+			base = *shared;
+		} else
+			base = prepareBase();
+	} catch (const std::runtime_error &) {
+		return EXIT_FAILURE; // reported by Load
+	} catch (const std::exception &e) {
+		// malformed JSON, also rethrown to jobs sharing the input
+		snprintf(u8buffer, sizeof u8buffer, inputfail, files[0].c_str(),
+		         e.what());
+		std::lock_guard<std::mutex> lock(outputMutex);
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	bool basecff = IsPostScriptOutline(base);
+	phases.Begin("select", files[0]);
+	auto selected = selector.Select(base["cmap"], 0);
+	phases.Count("cmapErased", base["cmap"].size() - selected.size());
+	if (selected.size() != base["cmap"].size()) {
+		json cmap = json::object();
+		for (auto [u, ruled] : selected) {
+			std::string key = std::to_string(u);
+			cmap[key] = std::move(base["cmap"][key]);
+		}
+		base["cmap"] = std::move(cmap);
+		collect = true;
+	}
+	if (!options.adjusts[0].IsIdentity()) {
+		std::vector<json *> glyphs;
+		for (auto &glyph : base["glyf"])
+			glyphs.push_back(&glyph);
+		TransformGlyphs(glyphs, options.adjusts[0], roundToInt);
+		phases.Count("glyphsTransformed", glyphs.size());
+	}
+	nametables.push_back(base["name"]);
+
+	OutlineStats tt2psStats, ps2ttStats;
+	for (size_t i = 1; i < files.size(); i++) {
+		std::string prefix = files[i] + ":";
+		auto subset = [&](json &font) {
+			phases.Begin("subset", files[i]);
+			size_t cmap = font["cmap"].size(), glyphs = font["glyf"].size();
+			subsetCodepoints += SubsetCmap(font, *charset);
+			subsetGlyphs += CollectGarbage(font, false);
+			CountErased(phases, font, cmap, glyphs);
+		};
+		// outlines of ext in the format of base
+		auto convert = [&](json &ext, bool extcff) {
+			if (basecff == extcff)
+				return;
+			phases.Begin("convert", files[i]);
+			if (basecff)
+				ext["glyf"] =
+				    Tt2Ps(std::move(ext["glyf"]), roundToInt, &tt2psStats, cache);
+			else
+				ext["glyf"] = Ps2Tt(std::move(ext["glyf"]), 1, &ps2ttStats,
+				                    cache, options.spline);
+			phases.Count("glyphsConverted", ext["glyf"].size());
+			phases.Count("points", CountPoints(ext["glyf"]));
+		};
+		auto prepareExt = [&] {
+			json ext = parse(files[i]);
+			bool extcff = IsPostScriptOutline(ext);
+			// before conversion, only cmap and references matter in ext
+			if (charset)
+				subset(ext);
+			convert(ext, extcff);
+			phases.Begin("prepare", files[i]);
+			size_t cmap = ext["cmap"].size(), glyphs = ext["glyf"].size();
+			RemoveBlankGlyph(ext);
+			CountErased(phases, ext, cmap, glyphs);
+			phases.Begin("fixName", files[i]);
+			FixGlyphName(ext, prefix);
+			return ext;
+		};
+		/* only the glyphs ext can supply, found from its skeleton before the
+		   full parse, which skips the rest, or read from its glyph store.
+		   other tables are not needed.
+		*/
+		auto prepareClosure = [&](std::vector<SourceSelector::Selected>
+		                              &selected) {
+			std::string text;
+			GlyphStore store;
+			json skeleton;
+			bool stored = !options.glyphStore.empty() && !options.load;
+			if (stored) {
+				phases.Begin("open", files[i]);
+				std::string path = StorePath(options.glyphStore, files[i]);
+				if (!store.Open(path, files[i])) {
+					snprintf(u8buffer, sizeof u8buffer, storefail, path.c_str());
+					std::lock_guard<std::mutex> lock(outputMutex);
+					nowide::cerr << u8buffer;
+					throw std::runtime_error("failed to open glyph store");
+				}
+				skeleton = store.Skeleton();
+			} else {
+				phases.Begin("load", files[i]);
+				text = Load(options, files[i]);
+				phases.Count("bytes", text.size());
+				phases.Begin("skeleton", files[i]);
+				if (!ParseSkeleton(text.data(), text.data() + text.size(),
+				                   skeleton))
+					skeleton = json::parse(text); // malformed, throws
+			}
+			phases.Count("glyphs", skeleton["glyf"].size());
+			phases.Count("cmap", skeleton["cmap"].size());
+			bool extcff = IsPostScriptOutline(skeleton);
+			if (charset)
+				subset(skeleton);
+			phases.Begin("prepare", files[i]);
+			size_t cmap = skeleton["cmap"].size(),
+			       glyphs = skeleton["glyf"].size();
+			// conversion gives every glyph contours, before blanks are removed
+			if (basecff != extcff)
+				for (auto &glyph : skeleton["glyf"])
+					if (glyph.find("contours") == glyph.end())
+						glyph["contours"] = json::array();
+			RemoveBlankGlyph(skeleton);
+			CountErased(phases, skeleton, cmap, glyphs);
+			phases.Begin("fixName", files[i]);
+			FixGlyphName(skeleton, prefix);
+			phases.Begin("closure", files[i]);
+			selected = selector.Select(skeleton["cmap"], int(i));
+
+			// selected glyphs and their components, by name in the file
+			std::set<std::string> closure;
+			std::vector<std::string> pending;
+			for (auto [u, ruled] : selected)
+				pending.push_back(skeleton["cmap"][std::to_string(u)]);
+			auto &glyf = skeleton["glyf"];
+			while (!pending.empty()) {
+				std::string name = std::move(pending.back());
+				pending.pop_back();
+				auto glyph = glyf.find(name);
+				std::string original = name;
+				if (!name.compare(0, prefix.size(), prefix) &&
+				    IsGidOrCid(name.substr(prefix.size())))
+					original = name.substr(prefix.size());
+				if (glyph == glyf.end() || !closure.insert(original).second)
+					continue;
+				if (glyph->find("references") != glyph->end())
+					for (auto &r : (*glyph)["references"])
+						pending.push_back(r["glyph"]);
+			}
+			phases.Count("glyphs", closure.size());
+
+			json ext;
+			phases.Begin("parse", files[i]);
+			if (stored) {
+				ext = store.Tables();
+				auto &glyf = ext["glyf"] = json::object();
+				for (auto &name : closure) {
+					json glyph;
+					if (store.Read(name, glyph))
+						glyf[name] = std::move(glyph);
+				}
+			} else {
+				ParseSubset(text.data(), text.data() + text.size(),
+				            {"head", "name", "OS_2", "glyf"}, closure, ext);
+				text = std::string();
+			}
+			phases.Count("glyphs", ext["glyf"].size());
+			// cmap is already fixed
+			FixGlyphName(ext, prefix);
+			ext["cmap"] = std::move(skeleton["cmap"]);
+			skeleton = json();
+			convert(ext, extcff);
+			return ext;
+		};
+		auto merge = [&](auto &ext,
+		                 const std::vector<SourceSelector::Selected> &selected) {
+			phases.Begin("merge", files[i]);
+			size_t glyphs = base["glyf"].size();
+			nametables.push_back(Member(ext, "name"));
+			if (MergeFont(base, ext, selected, prefix, options.adjusts[i],
+			              roundToInt))
+				collect = true;
+			phases.Count("cmapMoved", selected.size());
+			phases.Count("glyphsMoved", base["glyf"].size() - glyphs);
+			if (ext.find("OS_2") != ext.end()) {
+				auto &OS_2 = Member(ext, "OS_2");
+				if (OS_2.find("ulCodePageRange1") != OS_2.end())
+					ulCodePageRanges1.push_back(OS_2["ulCodePageRange1"]);
+				if (OS_2.find("ulCodePageRange2") != OS_2.end())
+					ulCodePageRanges2.push_back(OS_2["ulCodePageRange2"]);
+			}
+		};
+		try {
+			if (inputs && inputs->Shared(files[i])) {
+				std::string variant = InputVariant(options, false, basecff);
+				// resident, mostly unread: glyphs packed until taken
+				phases.Begin("wait", files[i]);
+				auto ext = inputs->Get(files[i], variant, [&] {
+					json ext = prepareExt();
+					phases.Begin("pack", files[i]);
+					PackGlyphs(ext["glyf"]);
+					phases.Count("glyphs", ext["glyf"].size());
+					return ext;
+				});
+				merge(*ext, selector.Select(Member(*ext, "cmap"), int(i)));
+			} else if (options.lowMemory || !options.glyphStore.empty()) {
+				std::vector<SourceSelector::Selected> selected;
+				json ext = prepareClosure(selected);
+				merge(ext, selected);
+				ext = json();
+				ReleaseMemory();
+			} else {
+				json ext = prepareExt();
+				merge(ext, selector.Select(ext["cmap"], int(i)));
+			}
+		} catch (const std::runtime_error &) {
+			return EXIT_FAILURE; // reported by Load
+		} catch (const std::exception &e) {
+			snprintf(u8buffer, sizeof u8buffer, inputfail, files[i].c_str(),
+			         e.what());
+			std::lock_guard<std::mutex> lock(outputMutex);
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
+		}
+	}
+
+	phases.Begin("finish");
+	if (base.find("OS_2") != base.end()) {
+		auto &OS_2 = base["OS_2"];
+		if (OS_2.find("ulCodePageRange1") != OS_2.end())
+			ulCodePageRanges1.push_back(OS_2["ulCodePageRange1"]);
+		if (OS_2.find("ulCodePageRange2") != OS_2.end())
+			ulCodePageRanges2.push_back(OS_2["ulCodePageRange2"]);
+
+		OS_2["ulCodePageRange1"] = MergeCodePage(ulCodePageRanges1);
+		OS_2["ulCodePageRange2"] = MergeCodePage(ulCodePageRanges2);
+	}
+
+	base["name"] = MergeNameTable(nametables);
+
+	if (collect)
+		phases.Count("glyphsErased", CollectGarbage(base, true));
+	OrderGlyphs(base, selector);
+
+	SimplifyStats simplifyStats;
+	if (options.tolerance > 0) {
+		simplifyStats = Simplify(base["glyf"], options.tolerance, basecff);
+		phases.Count("pointsErased", simplifyStats.points);
+	}
+	if (roundToInt)
+		RoundGlyphs(base["glyf"]);
+	phases.Count("glyphs", base["glyf"].size());
+	phases.End();
+
+	if (options.verbose) {
+		std::lock_guard<std::mutex> lock(outputMutex);
+		PrintOutlineStats("TrueType -> PostScript", tt2psStats);
+		PrintOutlineStats("PostScript -> TrueType", ps2ttStats);
+		if (charset) {
+			snprintf(u8buffer, sizeof u8buffer, subsetstats,
+			         (unsigned long)subsetCodepoints,
+			         (unsigned long)subsetGlyphs);
+			nowide::cerr << u8buffer;
+		}
+		if (options.tolerance > 0) {
+			snprintf(u8buffer, sizeof u8buffer, simplifystats,
+			         (unsigned long)simplifyStats.points,
+			         (unsigned long)simplifyStats.glyphs);
+			nowide::cerr << u8buffer;
+		}
+	}
+
+	const std::string &output =
+	    options.output.empty() ? files[0] : options.output;
+	if (options.lowMemory && !options.save) {
+		// serialized as it is written, without the whole text in memory
+		phases.Begin("write", output);
+		nowide::ofstream outfile(output.c_str(), std::ios::binary);
+		if (!(outfile << base) || !outfile.flush()) {
+			snprintf(u8buffer, sizeof u8buffer, savefilefail, output.c_str());
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
+		}
+	} else {
+		phases.Begin("dump", output);
+		std::string out = base.dump();
+		phases.Count("bytes", out.size());
+		phases.Begin("write", output);
+		if (options.save) {
+			if (!options.save(output, std::move(out)))
+				return EXIT_FAILURE;
+		} else {
+			FILE *outfile = nowide::fopen(output.c_str(), "wb");
+			if (!outfile) {
+				snprintf(u8buffer, sizeof u8buffer, savefilefail,
+				         output.c_str());
+				nowide::cerr << u8buffer;
+				return EXIT_FAILURE;
+			}
+			fwrite(out.c_str(), 1, out.size(), outfile);
+			fclose(outfile);
+		}
+	}
+	phases.End();
+	return ReportPhases(phases, options, output);
+}
+
+void SaveCache(OutlineCache &cache, const std::string &cachePath,
+               bool verbose) {
+	char u8buffer[4096];
+	if (verbose)
+		PrintCacheStats(cache.GetStats());
+	if (!cache.Save()) {
+		snprintf(u8buffer, sizeof u8buffer, cachesavefail, cachePath.c_str());
+		nowide::cerr << u8buffer;
+	}
+}
+
+/* a parsed font takes about 16 times the size of its JSON text, with
+   TrueType outlines converted to PostScript 2.5 times that. measured on
+   the fonts of the README.
+*/
+const size_t parsedRatio = 16;
+
+// size of an input, and whether its outlines are PostScript
+bool PeekInput(const std::string &file, size_t &size, bool &postScript) {
+	MappedFile mapped;
+	if (!mapped.Open(file))
+		return false;
+	size = mapped.Size();
+	// the table may come anywhere, a scan is still far cheaper than parsing
+	std::string_view text(mapped.Data(), size);
+	postScript = text.find("\"CFF_\"") != text.npos ||
+	             text.find("\"CFF2\"") != text.npos;
+	return true;
+}
+
+size_t EstimateMemory(const Options &job,
+                      const std::set<std::string> &sharedFiles,
+                      std::map<MemoryScheduler::Key, size_t> &shared) {
+	size_t size;
+	bool basecff, extcff;
+	// unreadable files fail the job as soon as it starts
+	if (!PeekInput(job.files[0], size, basecff))
+		return 0;
+	size_t own = parsedRatio * size;
+	// keyed as Merge asks InputCache for them
+	if (sharedFiles.count(job.files[0]))
+		shared[{job.files[0], InputVariant(job, true, basecff)}] = own;
+	for (size_t i = 1; i < job.files.size(); i++) {
+		if (!PeekInput(job.files[i], size, extcff))
+			continue;
+		size_t bytes = parsedRatio * size;
+		if (basecff && !extcff)
+			bytes = bytes * 5 / 2;
+		// a shared ext is held once, but its glyphs are copied by each job
+		own += bytes;
+		if (sharedFiles.count(job.files[i]))
+			shared[{job.files[i], InputVariant(job, false, basecff)}] = bytes;
+	}
+	return own;
+}
+
+void PrintAdmission(size_t job, size_t bytes,
+                    const MemoryScheduler::Stats &stats) {
+	char u8buffer[4096];
+	snprintf(u8buffer, sizeof u8buffer, admitstats, (unsigned long)job,
+	         (unsigned long)(bytes >> 20), (unsigned long)(stats.admitted >> 20),
+	         (unsigned long)stats.queued);
+	std::lock_guard<std::mutex> lock(outputMutex);
+	nowide::cerr << u8buffer;
+}
+
+void PrintPackStats() {
+	char u8buffer[4096];
+	PackStats stats = GetPackStats();
+	if (!stats.glyphs)
+		return;
+	snprintf(u8buffer, sizeof u8buffer, packstats, (unsigned long)stats.glyphs,
+	         double(stats.bytes) / stats.glyphs, stats.bytes / 1048576.0,
+	         (unsigned long)stats.decoded,
+	         stats.decodeSeconds > 0 ? stats.decoded / stats.decodeSeconds : 0);
+	std::lock_guard<std::mutex> lock(outputMutex);
+	nowide::cerr << u8buffer;
+}
+
+void PrintAllocStats() {
+	char u8buffer[4096];
+	std::lock_guard<std::mutex> lock(outputMutex);
+	for (auto &stats : GetAllocStats()) {
+		snprintf(u8buffer, sizeof u8buffer, allocstats, stats.phase,
+		         (unsigned long)stats.allocations, stats.bytes / 1048576.0,
+		         (unsigned long)stats.frees, stats.live / 1048576.0,
+		         stats.peakLive / 1048576.0);
+		nowide::cerr << u8buffer;
+	}
+}
+
+void PrintMemoryStats(size_t budget, const MemoryScheduler::Stats &stats) {
+	char u8buffer[4096];
+	snprintf(u8buffer, sizeof u8buffer, memorystats,
+	         (unsigned long)(budget >> 20),
+	         (unsigned long)(stats.peakAdmitted >> 20),
+	         (unsigned long)(PeakMemory() >> 20),
+	         (unsigned long)stats.peakQueued);
+	std::lock_guard<std::mutex> lock(outputMutex);
+	nowide::cerr << u8buffer;
+}
+
+int RunJobs(const std::vector<Options> &jobs, unsigned threadCount,
+            size_t memoryBudget, bool verbose) {
+	std::map<std::string, size_t> uses;
+	std::map<std::string, std::unique_ptr<OutlineCache>> caches;
+	for (auto &job : jobs) {
+		for (auto &file : std::set<std::string>(job.files.begin(),
+		                                        job.files.end()))
+			uses[file]++;
+		if (!job.cachePath.empty() && !caches.count(job.cachePath))
+			caches[job.cachePath] =
+			    std::make_unique<OutlineCache>(job.cachePath);
+	}
+
+	InputCache inputs(uses);
+	MemoryScheduler scheduler(memoryBudget);
+	std::vector<size_t> estimates(jobs.size());
+	std::set<std::string> sharedFiles;
+	for (auto &[file, count] : uses)
+		if (count > 1)
+			sharedFiles.insert(file);
+	for (size_t i = 0; i < jobs.size(); i++) {
+		std::map<MemoryScheduler::Key, size_t> shared;
+		if (memoryBudget)
+			estimates[i] = EstimateMemory(jobs[i], sharedFiles, shared);
+		scheduler.Submit(i, estimates[i], shared);
+	}
+
+	std::atomic<size_t> next{0};
+	std::atomic<bool> failed{false};
+	auto worker = [&] {
+		char u8buffer[4096];
+		while (next++ < jobs.size()) {
+			auto queued = std::chrono::steady_clock::now();
+			size_t i = scheduler.Admit();
+			if (memoryBudget && verbose)
+				PrintAdmission(i + 1, estimates[i], scheduler.GetStats());
+			const Options &job = jobs[i];
+			auto start = std::chrono::steady_clock::now();
+			TraceSpan("admit", "job", queued, start, {{"job", i + 1}});
+			OutlineCache *cache = job.cachePath.empty()
+			                          ? nullptr
+			                          : caches.at(job.cachePath).get();
+			// a job that throws fails alone, not the whole batch
+			int result = EXIT_FAILURE;
+			try {
+				result = Merge(job, cache, &inputs);
+			} catch (const std::exception &) {
+				// reported as failed below
+			}
+			for (auto &file : std::set<std::string>(job.files.begin(),
+			                                        job.files.end()))
+				inputs.Release(file);
+			scheduler.Finish(i);
+			const std::string &output =
+			    job.output.empty() ? job.files[0] : job.output;
+			TraceSpan("job", "job", start, std::chrono::steady_clock::now(),
+			          {{"job", i + 1}, {"output", output}});
+			if (result != 0) {
+				failed = true;
+				snprintf(u8buffer, sizeof u8buffer, jobfail,
+				         (unsigned long)i + 1);
+			} else if (job.verbose)
+				snprintf(u8buffer, sizeof u8buffer, jobstats,
+				         (unsigned long)i + 1, output.c_str(),
+				         std::chrono::duration<double>(
+				             std::chrono::steady_clock::now() - start)
+				             .count());
+			else
+				continue;
+			std::lock_guard<std::mutex> lock(outputMutex);
+			nowide::cerr << u8buffer;
+		}
+	};
+	if (!threadCount)
+		threadCount = std::thread::hardware_concurrency();
+	threadCount = std::max(1u, std::min(threadCount, unsigned(jobs.size())));
+	std::vector<std::thread> threads;
+	for (unsigned t = 1; t < threadCount; t++)
+		threads.emplace_back(worker);
+	worker();
+	for (auto &thread : threads)
+		thread.join();
+
+	for (auto &[path, cache] : caches)
+		SaveCache(*cache, path, verbose);
+	if (verbose)
+		PrintPackStats();
+	if (memoryBudget && verbose)
+		PrintMemoryStats(memoryBudget, scheduler.GetStats());
+	return failed ? EXIT_FAILURE : 0;
+}
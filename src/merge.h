@@ -0,0 +1,116 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "batch.h"
+#include "outline-cache.h"
+#include "source-selector.h"
+#include "transform.h"
+
+struct Options {
+	bool verbose = false;
+	bool spline = false;
+	bool fullPrecision = false;
+	bool plan = false;
+	bool lowMemory = false;
+	bool stats = false;    // print time and memory of each phase
+	std::string statsPath; // or write them as JSON
+	std::string tracePath; // Chrome trace-event JSON of the run
+	std::string charsetName;
+	std::string rulesPath;
+	double tolerance = 0;
+	std::string cachePath;
+	std::string output; // files[0] if empty
+	std::string batchPath;
+	std::string servePath;   // socket to listen on
+	std::string connectPath; // socket of a running server
+	std::string glyphStore;  // directory of glyph stores of fallback fonts
+	unsigned jobs = 0; // hardware concurrency if 0
+	size_t memoryBudget = 0; // bytes of concurrent jobs, unlimited if 0
+	std::vector<std::string> files;
+	std::vector<Affine> adjusts;
+
+	// output and fallback files of each variant, which start at first
+	struct Variant {
+		std::string output;
+		size_t first;
+	};
+	std::vector<Variant> variants;
+
+	/* JSON text of an input, and where the merged JSON goes; files if
+	   unset. load reports its errors and throws std::runtime_error.
+	*/
+	std::function<std::string(const std::string &file)> load;
+	std::function<bool(const std::string &output, std::string &&json)> save;
+};
+
+// serializes messages of concurrent jobs
+extern std::mutex outputMutex;
+
+// returns false if an option is malformed
+bool ParseOptions(const std::vector<std::string> &args, Options &options);
+
+/* merge options.files into options.output. inputs: files shared with
+   other jobs, or null. other files are loaded and consumed in place.
+*/
+int Merge(const Options &options, OutlineCache *cache, InputCache *inputs);
+
+// steps of Merge, also run by the pipeline benchmark
+
+// reports its errors and throws std::runtime_error
+std::string LoadFile(const char *u8filename);
+/* drop code points of visible characters whose glyphs have neither
+   contours nor references, and such glyphs once unmapped
+*/
+void RemoveBlankGlyph(nlohmann::json &font);
+// prefix glyph names that are only an index, glyphN or cidN
+void FixGlyphName(nlohmann::json &font, const std::string &prefix);
+
+/* move the glyphs of selected code points of ext into base, with their
+   references. glyphs of ruled code points are renamed with prefix if their
+   names are taken. adjust: per-font transform, applied after UPM
+   normalization. returns whether any code point was replaced.
+*/
+template <typename Ext>
+bool MergeFont(nlohmann::json &base, Ext &ext,
+               const std::vector<SourceSelector::Selected> &selected,
+               const std::string &prefix, const Affine &adjust,
+               bool roundToInt);
+extern template bool
+MergeFont(nlohmann::json &base, nlohmann::json &ext,
+          const std::vector<SourceSelector::Selected> &selected,
+          const std::string &prefix, const Affine &adjust, bool roundToInt);
+
+void SaveCache(OutlineCache &cache, const std::string &cachePath,
+               bool verbose);
+
+/* estimated peak memory of job in bytes, from the sizes and outline formats
+   of its files. returns what the job holds itself, and adds the inputs in
+   sharedFiles, held once for all jobs, to shared.
+*/
+size_t EstimateMemory(const Options &job,
+                      const std::set<std::string> &sharedFiles,
+                      std::map<MemoryScheduler::Key, size_t> &shared);
+
+// what admitting a job is charged, and the totals once all jobs ran
+void PrintAdmission(size_t job, size_t bytes,
+                    const MemoryScheduler::Stats &stats);
+void PrintMemoryStats(size_t budget, const MemoryScheduler::Stats &stats);
+
+// glyphs packed in shared inputs, and how fast the taken ones were decoded
+void PrintPackStats();
+
+// allocations of each phase, in builds that profile them
+void PrintAllocStats();
+
+/* run jobs in parallel, sharing the files that several jobs use, and
+   admitting them while their estimated memory fits memoryBudget. returns
+   EXIT_FAILURE if any job fails.
+*/
+int RunJobs(const std::vector<Options> &jobs, unsigned threadCount,
+            size_t memoryBudget, bool verbose);
@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <nowide/cstdio.hpp>
+
+#include "outline-cache.h"
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+using nlohmann::json;
+
+// bump when the output of Ps2Tt or Tt2Ps changes.
+static const uint32_t cacheVersion = 1;
+static const char cacheMagic[8] = {'W', 'F', 'M', 'O', 'C', 'A', 'C', 'H'};
+
+struct OutlineCache::Entry
+{
+	uint64_t key;
+	uint64_t offset;
+	uint32_t size;
+	float cost; // seconds spent converting
+};
+
+struct Header
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t reserved;
+	uint64_t count;
+};
+
+static_assert(sizeof(Header) == 24, "unexpected padding");
+
+static uint64_t Mix(uint64_t h, uint64_t v)
+{
+	// splitmix64 finalizer
+	h ^= v + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+	h ^= h >> 30;
+	h *= 0xbf58476d1ce4e5b9;
+	h ^= h >> 27;
+	h *= 0x94d049bb133111eb;
+	h ^= h >> 31;
+	return h;
+}
+
+static uint64_t Bits(double x)
+{
+	x += 0.0; // -0 -> +0
+	uint64_t v;
+	memcpy(&v, &x, sizeof v);
+	return v;
+}
+
+uint64_t OutlineCache::Key(const json &contours, Direction direction,
+                           double errorBound, bool roundToInt)
+{
+	uint64_t h = Mix(direction, Bits(errorBound));
+	h = Mix(h, roundToInt);
+	for (const json &contour : contours)
+	{
+		h = Mix(h, contour.size());
+		for (const json &point : contour)
+		{
+			h = Mix(h, Bits(point["x"]));
+			h = Mix(h, Bits(point["y"]));
+			h = Mix(h, bool(point["on"]));
+		}
+	}
+	return h;
+}
+
+template <typename T> static void Put(std::string &out, T value)
+{
+	out.append(reinterpret_cast<const char *>(&value), sizeof value);
+}
+
+// false if value would end past end
+template <typename T> static bool Get(const char *&p, const char *end, T &value)
+{
+	if (size_t(end - p) < sizeof value)
+		return false;
+	memcpy(&value, p, sizeof value);
+	p += sizeof value;
+	return true;
+}
+
+/* contour count, then for each contour its point count and points.
+   rounded outlines are stored as int32, others as double.
+*/
+static std::string Encode(const json &contours, bool roundToInt)
+{
+	std::string out;
+	Put<uint8_t>(out, roundToInt);
+	Put<uint32_t>(out, uint32_t(contours.size()));
+	for (const json &contour : contours)
+	{
+		Put<uint32_t>(out, uint32_t(contour.size()));
+		for (const json &point : contour)
+		{
+			if (roundToInt)
+			{
+				Put<int32_t>(out, point["x"]);
+				Put<int32_t>(out, point["y"]);
+			}
+			else
+			{
+				Put<double>(out, point["x"]);
+				Put<double>(out, point["y"]);
+			}
+			Put<uint8_t>(out, bool(point["on"]));
+		}
+	}
+	return out;
+}
+
+/* the entry from p to end. false if its counts run past end, as in a
+   truncated or corrupt file.
+*/
+static bool Decode(const char *p, const char *end, json &contours)
+{
+	uint8_t isInt, on;
+	uint32_t nContour, nPoint;
+	if (!Get(p, end, isInt) || !Get(p, end, nContour))
+		return false;
+	contours = json::array();
+	for (uint32_t i = 0; i < nContour; i++)
+	{
+		if (!Get(p, end, nPoint))
+			return false;
+		json contour = json::array();
+		for (uint32_t j = 0; j < nPoint; j++)
+		{
+			json point = json::object();
+			if (isInt)
+			{
+				int32_t x, y;
+				if (!Get(p, end, x) || !Get(p, end, y))
+					return false;
+				point["x"] = x;
+				point["y"] = y;
+			}
+			else
+			{
+				double x, y;
+				if (!Get(p, end, x) || !Get(p, end, y))
+					return false;
+				point["x"] = x;
+				point["y"] = y;
+			}
+			if (!Get(p, end, on))
+				return false;
+			point["on"] = bool(on);
+			contour.push_back(std::move(point));
+		}
+		contours.push_back(std::move(contour));
+	}
+	return true;
+}
+
+OutlineCache::OutlineCache(const std::string &path) : path(path)
+{
+	if (!file.Open(path))
+		return;
+	Header header;
+	if (file.Size() >= sizeof header)
+		memcpy(&header, file.Data(), sizeof header);
+	if (file.Size() < sizeof header ||
+	    memcmp(header.magic, cacheMagic, sizeof cacheMagic) ||
+	    header.version != cacheVersion ||
+	    header.count > (file.Size() - sizeof header) / sizeof(Entry))
+	{
+		// stale or foreign file, will be overwritten
+		file.Close();
+		return;
+	}
+	entries = reinterpret_cast<const Entry *>(file.Data() + sizeof header);
+	count = header.count;
+}
+
+const OutlineCache::Entry *OutlineCache::Find(uint64_t key) const
+{
+	auto it = std::lower_bound(
+	    entries, entries + count, key,
+	    [](const Entry &e, uint64_t key) { return e.key < key; });
+	if (it != entries + count && it->key == key && Valid(*it))
+		return it;
+	return nullptr;
+}
+
+bool OutlineCache::Valid(const Entry &e) const
+{
+	return e.offset <= file.Size() && e.size <= file.Size() - e.offset;
+}
+
+bool OutlineCache::Lookup(uint64_t key, json &contours)
+{
+	auto start = std::chrono::steady_clock::now();
+	const Entry *e = Find(key);
+	const char *data = e ? file.Data() + e->offset : nullptr;
+	json decoded;
+	if (!e || !Decode(data, data + e->size, decoded))
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stats.misses++;
+		return false;
+	}
+	contours = std::move(decoded);
+	std::lock_guard<std::mutex> lock(mutex);
+	stats.hits++;
+	stats.savedSeconds += e->cost;
+	stats.hitSeconds += std::chrono::duration<double>(
+	                        std::chrono::steady_clock::now() - start)
+	                        .count();
+	return true;
+}
+
+void OutlineCache::Store(uint64_t key, const json &contours, bool roundToInt,
+                         double seconds)
+{
+	std::string encoded = Encode(contours, roundToInt);
+	std::lock_guard<std::mutex> lock(mutex);
+	stats.missSeconds += seconds;
+	pending.emplace(key, std::make_pair(std::move(encoded), float(seconds)));
+}
+
+bool OutlineCache::Save()
+{
+	if (pending.empty())
+		return true;
+
+	struct Item
+	{
+		uint64_t key;
+		const char *data;
+		uint32_t size;
+		float cost;
+	};
+	std::vector<Item> items;
+	items.reserve(count + pending.size());
+	for (size_t i = 0; i < count; i++)
+		if (Valid(entries[i]))
+			items.push_back({entries[i].key, file.Data() + entries[i].offset,
+			                 entries[i].size, entries[i].cost});
+	for (auto &[key, value] : pending)
+		items.push_back({key, value.first.data(), uint32_t(value.first.size()),
+		                 value.second});
+	std::sort(items.begin(), items.end(),
+	          [](const Item &a, const Item &b) { return a.key < b.key; });
+	items.erase(std::unique(items.begin(), items.end(),
+	                        [](const Item &a, const Item &b) {
+		                        return a.key == b.key;
+	                        }),
+	            items.end());
+
+	Header header;
+	memcpy(header.magic, cacheMagic, sizeof cacheMagic);
+	header.version = cacheVersion;
+	header.reserved = 0;
+	header.count = items.size();
+
+	std::string tmp = path + ".tmp" + std::to_string(getpid());
+	FILE *out = nowide::fopen(tmp.c_str(), "wb");
+	if (!out)
+		return false;
+	bool ok = fwrite(&header, sizeof header, 1, out) == 1;
+	uint64_t offset = sizeof header + items.size() * sizeof(Entry);
+	for (auto &item : items)
+	{
+		Entry e = {item.key, offset, item.size, item.cost};
+		ok = ok && fwrite(&e, sizeof e, 1, out) == 1;
+		offset += item.size;
+	}
+	for (auto &item : items)
+		ok = ok && fwrite(item.data, 1, item.size, out) == item.size;
+	ok = fclose(out) == 0 && ok;
+
+	// the old entries point into the mapping, release it only now
+	entries = nullptr;
+	count = 0;
+	file.Close();
+	pending.clear();
+	if (ok)
+	{
+#ifdef _WIN32
+		nowide::remove(path.c_str()); // rename does not replace on Windows
+#endif
+		ok = nowide::rename(tmp.c_str(), path.c_str()) == 0;
+	}
+	if (!ok)
+		nowide::remove(tmp.c_str());
+	return ok;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+#include "mapped-file.h"
+
+/* persistent cache of converted contours.
+
+   the file is a sorted table of (key, offset, size, cost) entries followed by
+   the encoded contours, and is memory-mapped when opened. new entries are kept
+   in memory and merged into the file by Save(). Lookup() and Store() may be
+   called from several threads.
+*/
+class OutlineCache
+{
+public:
+	struct Stats
+	{
+		size_t hits = 0;
+		size_t misses = 0;
+		double hitSeconds = 0;   // spent decoding hits
+		double savedSeconds = 0; // conversion time recorded for the hits
+		double missSeconds = 0;  // spent converting misses
+	};
+
+	enum Direction : uint8_t
+	{
+		ToQuadratic = 'Q',
+		ToQuadraticSpline = 'S',
+		ToCubic = 'C',
+	};
+
+	// opens (or prepares to create) the cache file at path (UTF-8).
+	explicit OutlineCache(const std::string &path);
+
+	/* key of normalized input contours, conversion direction and parameters.
+	   coordinates are hashed as doubles, so 1 and 1.0 give the same key.
+	*/
+	static uint64_t Key(const nlohmann::json &contours, Direction direction,
+	                    double errorBound, bool roundToInt);
+
+	// replace contours with the cached result, if any.
+	bool Lookup(uint64_t key, nlohmann::json &contours);
+	// record the contours converted in the given time.
+	void Store(uint64_t key, const nlohmann::json &contours, bool roundToInt,
+	           double seconds);
+
+	// write back new entries. returns false on I/O error.
+	bool Save();
+
+	const Stats &GetStats() const
+	{
+		return stats;
+	}
+
+private:
+	struct Entry;
+
+	const Entry *Find(uint64_t key) const;
+	// whether the data of e lies within the file
+	bool Valid(const Entry &e) const;
+
+	std::string path;
+	MappedFile file;
+	const Entry *entries = nullptr;
+	size_t count = 0;
+	std::mutex mutex; // guards pending and stats
+	std::unordered_map<uint64_t, std::pair<std::string, float>> pending;
+	Stats stats;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+// how contours went through Ps2Tt / Tt2Ps
+struct OutlineStats
+{
+	size_t lineContours = 0;   // no off-curve point, cleanup only
+	size_t exactContours = 0;  // every curve converted exactly
+	size_t approxContours = 0; // at least one curve approximated
+	size_t exactSegments = 0;
+	size_t approxSegments = 0;
+
+	OutlineStats &operator+=(const OutlineStats &rhs)
+	{
+		lineContours += rhs.lineContours;
+		exactContours += rhs.exactContours;
+		approxContours += rhs.approxContours;
+		exactSegments += rhs.exactSegments;
+		approxSegments += rhs.approxSegments;
+		return *this;
+	}
+};
@@ -0,0 +1,219 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "packed-glyph.h"
+
+using nlohmann::json;
+
+static std::atomic<size_t> packedGlyphs{0}, packedBytes{0}, decodedGlyphs{0};
+static std::atomic<uint64_t> decodeNanoseconds{0};
+
+static void PutVarint(std::string &out, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		out += char(value | 0x80);
+		value >>= 7;
+	}
+	out += char(value);
+}
+
+static uint64_t GetVarint(const char *&p)
+{
+	uint64_t value = 0;
+	for (int shift = 0;; shift += 7)
+	{
+		uint8_t byte = uint8_t(*p++);
+		value |= uint64_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return value;
+	}
+}
+
+static uint64_t ZigZag(int64_t value)
+{
+	return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+}
+
+static int64_t UnZigZag(uint64_t value)
+{
+	return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+// an integer coordinate that fits int32
+static bool Coordinate(const json &value, int64_t &result)
+{
+	if (value.is_number_unsigned())
+	{
+		uint64_t u = value;
+		result = int64_t(u);
+		return u <= INT32_MAX;
+	}
+	if (!value.is_number_integer())
+		return false;
+	result = value;
+	return result >= INT32_MIN && result <= INT32_MAX;
+}
+
+/* point count of each contour, on-curve flags, x and y deltas. false if a
+   point is not integer {x, y, on}.
+*/
+static bool PackContours(const json &contours, std::string &out)
+{
+	if (!contours.is_array())
+		return false;
+	std::string flags, deltas;
+	size_t n = 0;
+	int64_t lastX = 0, lastY = 0, x, y;
+	for (const json &contour : contours)
+	{
+		if (!contour.is_array())
+			return false;
+		PutVarint(out, contour.size());
+		for (const json &point : contour)
+		{
+			if (!point.is_object() || point.size() != 3)
+				return false;
+			// keys are sorted
+			auto it = point.get_ref<const json::object_t &>().begin();
+			if (it->first != "on" || !it->second.is_boolean())
+				return false;
+			bool on = it->second;
+			++it;
+			if (it->first != "x" || !Coordinate(it->second, x))
+				return false;
+			++it;
+			if (it->first != "y" || !Coordinate(it->second, y))
+				return false;
+
+			if (n % 8 == 0)
+				flags += char(0);
+			if (on)
+				flags.back() |= char(1 << n % 8);
+			n++;
+			PutVarint(deltas, ZigZag(x - lastX));
+			PutVarint(deltas, ZigZag(y - lastY));
+			lastX = x;
+			lastY = y;
+		}
+	}
+	out += flags;
+	out += deltas;
+	return true;
+}
+
+/* contour count + 1, the contours, and the rest of the glyph in
+   MessagePack, or 0 and the whole glyph in MessagePack.
+*/
+static std::string Pack(const json &glyph)
+{
+	std::string out;
+	auto contours = glyph.is_object() ? glyph.find("contours") : glyph.end();
+	if (contours != glyph.end() && contours->is_array())
+	{
+		PutVarint(out, contours->size() + 1);
+		if (PackContours(*contours, out))
+		{
+			json rest = json::object();
+			for (auto it = glyph.begin(); it != glyph.end(); ++it)
+				if (it.key() != "contours")
+					rest[it.key()] = it.value();
+			std::vector<uint8_t> encoded = json::to_msgpack(rest);
+			out.append(encoded.begin(), encoded.end());
+			return out;
+		}
+		out.clear();
+	}
+	PutVarint(out, 0);
+	std::vector<uint8_t> encoded = json::to_msgpack(glyph);
+	out.append(encoded.begin(), encoded.end());
+	return out;
+}
+
+// as the JSON parser stores them
+static json Number(int64_t value)
+{
+	return value >= 0 ? json(uint64_t(value)) : json(value);
+}
+
+static json Unpack(const std::string &packed)
+{
+	const char *p = packed.data(), *end = p + packed.size();
+	uint64_t tag = GetVarint(p);
+	if (!tag)
+		return json::from_msgpack(p, end);
+
+	std::vector<size_t> sizes(tag - 1);
+	size_t n = 0;
+	for (auto &size : sizes)
+	{
+		size = GetVarint(p);
+		n += size;
+	}
+	const char *flags = p;
+	p += (n + 7) / 8;
+	json contours = json::array();
+	int64_t x = 0, y = 0;
+	size_t k = 0;
+	for (size_t size : sizes)
+	{
+		json contour = json::array();
+		auto &points = contour.get_ref<json::array_t &>();
+		points.reserve(size);
+		for (size_t j = 0; j < size; j++, k++)
+		{
+			x += UnZigZag(GetVarint(p));
+			y += UnZigZag(GetVarint(p));
+			// in key order, without the lookups of operator[]
+			auto &point =
+			    points.emplace_back(json::object()).get_ref<json::object_t &>();
+			point.emplace_hint(point.end(), "on",
+			                   bool(uint8_t(flags[k / 8]) >> k % 8 & 1));
+			point.emplace_hint(point.end(), "x", Number(x));
+			point.emplace_hint(point.end(), "y", Number(y));
+		}
+		contours.push_back(std::move(contour));
+	}
+	json glyph = json::from_msgpack(p, end);
+	glyph["contours"] = std::move(contours);
+	return glyph;
+}
+
+void PackGlyphs(json &glyf)
+{
+	size_t bytes = 0;
+	for (auto &glyph : glyf)
+	{
+		std::string packed = Pack(glyph);
+		bytes += packed.size();
+		glyph = std::move(packed);
+	}
+	packedGlyphs += glyf.size();
+	packedBytes += bytes;
+}
+
+json UnpackGlyph(const json &glyph)
+{
+	if (!glyph.is_string())
+		return glyph;
+	auto start = std::chrono::steady_clock::now();
+	json result = Unpack(glyph.get_ref<const std::string &>());
+	decodeNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+	                         std::chrono::steady_clock::now() - start)
+	                         .count();
+	decodedGlyphs++;
+	return result;
+}
+
+PackStats GetPackStats()
+{
+	PackStats stats;
+	stats.glyphs = packedGlyphs;
+	stats.bytes = packedBytes;
+	stats.decoded = decodedGlyphs;
+	stats.decodeSeconds = decodeNanoseconds * 1e-9;
+	return stats;
+}
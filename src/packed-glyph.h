@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+#include <nlohmann/json.hpp>
+
+/* compact form of glyphs that stay resident but are seldom read, as in
+   inputs shared between jobs.
+
+   a packed glyph is a JSON string. contours whose points are all integer
+   {x, y, on} are stored as zigzag varint deltas, with the on-curve flags
+   packed 8 to a byte. the rest of the glyph is stored as MessagePack.
+*/
+struct PackStats
+{
+	size_t glyphs = 0;  // packed
+	size_t bytes = 0;   // of the packed glyphs
+	size_t decoded = 0; // glyphs
+	double decodeSeconds = 0;
+};
+
+// replace every glyph of glyf by its packed form
+void PackGlyphs(nlohmann::json &glyf);
+
+// glyph of a packed glyf, decoded. a glyph not packed is copied.
+nlohmann::json UnpackGlyph(const nlohmann::json &glyph);
+
+// totals of all threads
+PackStats GetPackStats();
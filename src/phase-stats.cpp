@@ -0,0 +1,107 @@
+#include <cstdint>
+
+#include "phase-stats.h"
+#include "alloc-profile.h"
+#include "batch.h"
+#include "trace.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using json = nlohmann::json;
+
+void PhaseStats::Begin(const char *name, const std::string &input) {
+	End();
+	Phase phase;
+	phase.name = name;
+	phase.input = input;
+	phases.push_back(std::move(phase));
+	running = true;
+	SetAllocPhase(name);
+	ThreadAllocations(allocationsStart, bytesStart);
+	peakStart = PeakMemory();
+	cpuStart = ThreadCpuSeconds();
+	start = std::chrono::steady_clock::now();
+}
+
+void PhaseStats::End() {
+	if (!running)
+		return;
+	auto end = std::chrono::steady_clock::now();
+	Phase &phase = phases.back();
+	phase.seconds = std::chrono::duration<double>(end - start).count();
+	phase.cpuSeconds = ThreadCpuSeconds() - cpuStart;
+	size_t peak = PeakMemory();
+	phase.peakGrowth = peak > peakStart ? peak - peakStart : 0;
+	if (AllocProfiling()) {
+		size_t allocations, bytes;
+		ThreadAllocations(allocations, bytes);
+		SetAllocPhase(nullptr);
+		Count("allocations", allocations - allocationsStart);
+		Count("allocatedBytes", bytes - bytesStart);
+	}
+	running = false;
+	if (TraceEnabled()) {
+		json args = {{"input", phase.input}};
+		for (auto &[kind, n] : phase.counts)
+			args[kind] = n;
+		TraceSpan(phase.name.c_str(), "phase", start, end, std::move(args));
+	}
+}
+
+void PhaseStats::Count(const char *kind, size_t n) {
+	if (!running)
+		return;
+	auto &counts = phases.back().counts;
+	for (auto &count : counts)
+		if (count.first == kind) {
+			count.second += n;
+			return;
+		}
+	counts.emplace_back(kind, n);
+}
+
+json PhaseStats::Report() const {
+	json report = {{"phases", json::array()}};
+	double seconds = 0, cpuSeconds = 0;
+	for (auto &phase : phases) {
+		json counts = json::object();
+		for (auto &[kind, n] : phase.counts)
+			counts[kind] = n;
+		report["phases"].push_back({{"phase", phase.name},
+		                            {"input", phase.input},
+		                            {"seconds", phase.seconds},
+		                            {"cpuSeconds", phase.cpuSeconds},
+		                            {"peakGrowth", phase.peakGrowth},
+		                            {"counts", std::move(counts)}});
+		seconds += phase.seconds;
+		cpuSeconds += phase.cpuSeconds;
+	}
+	report["seconds"] = seconds;
+	report["cpuSeconds"] = cpuSeconds;
+	report["peakMemory"] = PeakMemory();
+	return report;
+}
+
+double ThreadCpuSeconds() {
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+		return 0;
+	auto ticks = [](const FILETIME &t) {
+		return double(uint64_t(t.dwHighDateTime) << 32 | t.dwLowDateTime);
+	};
+	return (ticks(kernel) + ticks(user)) * 1e-7; // 100 ns ticks
+#else
+	timespec t;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t))
+		return 0;
+	return double(t.tv_sec) + t.tv_nsec * 1e-9;
+#endif
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+/* wall time, CPU time, growth of peak memory and item counts of the phases
+   of a job, which run one after another on one thread. a phase costs a few
+   clock reads, so stats are always collected. phases are also spans of the
+   trace, if tracing, and tag allocations in builds that profile them (see
+   alloc-profile.h), which count them per phase.
+
+   CPU time is that of the calling thread. peak memory is that of the
+   process, so concurrent jobs share its growth.
+*/
+class PhaseStats {
+public:
+	struct Phase {
+		std::string name;
+		std::string input; // file the phase works on, empty if none
+		double seconds = 0;
+		double cpuSeconds = 0;
+		size_t peakGrowth = 0; // bytes
+		std::vector<std::pair<std::string, size_t>> counts;
+	};
+
+	// end the running phase, if any, and start name
+	void Begin(const char *name, const std::string &input = std::string());
+	void End();
+
+	// add n to the count of kind in the running phase
+	void Count(const char *kind, size_t n);
+
+	const std::vector<Phase> &Phases() const { return phases; }
+
+	// {"phases": [...], "seconds", "cpuSeconds", "peakMemory"}
+	nlohmann::json Report() const;
+
+private:
+	std::vector<Phase> phases;
+	bool running = false;
+	std::chrono::steady_clock::time_point start;
+	double cpuStart = 0;
+	size_t peakStart = 0;
+	size_t allocationsStart = 0, bytesStart = 0;
+};
+
+// CPU time of the calling thread in seconds, 0 if unknown
+double ThreadCpuSeconds();
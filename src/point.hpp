@@ -64,6 +64,15 @@ inline double abs(Point a)
 	return sqrt(a * a);
 }
 
+// distance from p2 to the line through p1 and p3
+inline double DistanceToLine(Point p1, Point p2, Point p3)
+{
+	double a = p3.y - p1.y;
+	double b = p1.x - p3.x;
+	double c = p1.y * p3.x - p1.x * p3.y;
+	return abs(a * p2.x + b * p2.y + c) / sqrt(a * a + b * b);
+}
+
 inline void RoundInPlace(nlohmann::json &glyph)
 {
 	for (auto &contour : glyph["contours"])
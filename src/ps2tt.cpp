@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <iterator>
 #include <utility>
@@ -9,6 +10,7 @@
 
 #include "point.hpp"
 #include "ps2tt.h"
+#include "trace.h"
 
 using nlohmann::json;
 
@@ -31,13 +33,8 @@ void Line(json &quadContour, Point p1)
 	if (length >= 2 && quadContour[length - 2]["on"])
 	{
 		// 2 lines, merge if the are collinear.
-		Point p2 = quadContour[length - 1];
-		Point p3 = quadContour[length - 2];
-		double a = p3.y - p1.y;
-		double b = p1.x - p3.x;
-		double c = p1.y * p3.x - p1.x * p3.y;
-		double distance = abs(a * p2.x + b * p2.y + c) / sqrt(a * a + b * b);
-		if (distance < 1)
+		if (DistanceToLine(p1, quadContour[length - 1],
+		                   quadContour[length - 2]) < 1)
 			quadContour.erase(length - 1);
 	}
 	quadContour.push_back(p1.ToJson(true));
@@ -81,11 +78,7 @@ void Finish(json &quadContour)
 	if (quadContour[1]["on"])
 	{
 		// 2 lines, merge if the are collinear.
-		double a = p3.y - p1.y;
-		double b = p1.x - p3.x;
-		double c = p1.y * p3.x - p1.x * p3.y;
-		double distance = abs(a * p2.x + b * p2.y + c) / sqrt(a * a + b * b);
-		if (distance < 1)
+		if (DistanceToLine(p1, p2, p3) < 1)
 			quadContour.erase(0);
 	}
 	else if (abs((p1 + p3) / 2 - p2) < 1)
@@ -342,18 +335,215 @@ static void ApproximateCurve(Segment s, json &quadContour, double error)
 	ApproximateSimpleSegment(curve, quadContour, error);
 }
 
-static json Convert(json glyph, double error)
+/* Approximate cubic segment with a quadratic spline whose joins are implied
+   on-curve points (mid-points of adjacent off-curve points), so n pieces
+   cost n off-curve points only. Control points are taken on the tangent
+   lines of n equal sub-curves, interpolated so that neighbouring pieces
+   stay tangent-continuous. Algorithm from fontTools’ cu2qu:
+   https://github.com/fonttools/fonttools/blob/main/Lib/fontTools/cu2qu/cu2qu.py
+*/
+
+// check that a cubic with these control point errors stays within error
+static bool CubicFitsInside(Point p0, Point p1, Point p2, Point p3,
+                            double error)
+{
+	if (abs(p2) <= error && abs(p1) <= error)
+		return true;
+	Point mid = (p0 + 3 * (p1 + p2) + p3) * 0.125;
+	if (abs(mid) > error)
+		return false;
+	Point deriv3 = (p3 + p2 - p1 - p0) * 0.125;
+	return CubicFitsInside(p0, (p0 + p1) * 0.5, mid - deriv3, mid, error) &&
+	       CubicFitsInside(mid, mid + deriv3, (p2 + p3) * 0.5, p3, error);
+}
+
+// n sub-curves of equal parameter length
+static std::vector<Segment> SplitCubic(Segment s, int n)
+{
+	auto [d, c, b, a] = CalcPowerCoefficients(s);
+	std::vector<Segment> result;
+	double dt = 1.0 / n;
+	for (int i = 0; i < n; i++)
+	{
+		double t = i * dt;
+		Point a1 = a * (dt * dt * dt);
+		Point b1 = (3 * a * t + b) * (dt * dt);
+		Point c1 = (2 * b * t + c + 3 * a * t * t) * dt;
+		Point d1 = ((a * t + b) * t + c) * t + d;
+		Point p1 = c1 / 3 + d1;
+		Point p2 = (b1 + c1) / 3 + p1;
+		result.push_back({d1, p1, p2, a1 + b1 + c1 + d1});
+	}
+	return result;
+}
+
+// off-curve points of the spline, empty if it does not fit
+static std::vector<Point> SplineControls(Segment s, int n, double error)
+{
+	// control point of the tangents at both ends, interpolated by t
+	auto control = [](double t, Segment c) {
+		Point q1 = c[0] + (c[1] - c[0]) * 1.5;
+		Point q2 = c[3] + (c[2] - c[3]) * 1.5;
+		return q1 + (q2 - q1) * t;
+	};
+
+	if (n == 1)
+	{
+		// intersection of end tangents
+		Point ab = s[1] - s[0], cd = s[3] - s[2];
+		Point normal = {-ab.y, ab.x};
+		double denom = normal * cd;
+		if (!denom)
+			return {};
+		Point q = s[2] + cd * ((normal * (s[0] - s[2])) / denom);
+		if (!CubicFitsInside({}, s[0] + (q - s[0]) * (2.0 / 3) - s[1],
+		                     s[3] + (q - s[3]) * (2.0 / 3) - s[2], {}, error))
+			return {};
+		return {q};
+	}
+
+	std::vector<Segment> cubics = SplitCubic(s, n);
+	std::vector<Point> controls;
+	Point q2 = s[0], d1 = {};
+	Point nextQ1 = control(0, cubics[0]);
+	for (int i = 1; i <= n; i++)
+	{
+		Segment c = cubics[i - 1];
+		Point q0 = q2;
+		Point q1 = nextQ1;
+		controls.push_back(q1);
+		if (i < n)
+		{
+			nextQ1 = control(double(i) / (n - 1), cubics[i]);
+			q2 = (q1 + nextQ1) * 0.5;
+		}
+		else
+			q2 = c[3];
+		Point d0 = d1;
+		d1 = q2 - c[3];
+		if (abs(d1) > error ||
+		    !CubicFitsInside(d0, q0 + (q1 - q0) * (2.0 / 3) - c[1],
+		                     q2 + (q1 - q2) * (2.0 / 3) - c[2], d1, error))
+			return {};
+	}
+	return controls;
+}
+
+static bool ApproximateSpline(Segment s, json &quadContour, double error)
+{
+	const int maxPieces = 16;
+	for (int n = 1; n <= maxPieces; n++)
+	{
+		std::vector<Point> controls = SplineControls(s, n, error);
+		if (controls.empty())
+			continue;
+		// implied on-curve points are dropped by ConstructTtPath::Curve
+		for (size_t i = 0; i + 1 < controls.size(); i++)
+			ConstructTtPath::Curve(quadContour, controls[i],
+			                       (controls[i] + controls[i + 1]) / 2);
+		ConstructTtPath::Curve(quadContour, controls.back(), s[3]);
+		return true;
+	}
+	return false;
+}
+
+// the shorter of the spline and the piecewise approximation
+static void ApproximateShortest(Segment s, json &quadContour, double error)
+{
+	// ConstructTtPath::Curve may rewrite the last 2 points
+	size_t keep = std::min<size_t>(quadContour.size(), 2);
+	json tail(quadContour.end() - keep, quadContour.end());
+	json piecewise = tail;
+	ApproximateCurve(s, piecewise, error);
+	json spline = tail;
+	if (ApproximateSpline(s, spline, error) && spline.size() < piecewise.size())
+		piecewise = std::move(spline);
+	quadContour.erase(quadContour.end() - keep, quadContour.end());
+	quadContour.insert(quadContour.end(), piecewise.begin(), piecewise.end());
+}
+
+/* a cubic segment is a degree-elevated quadratic if
+   3 c1 - p1 = 3 c2 - p2 = 2 q, where q is the quadratic control point.
+*/
+static bool IsElevatedQuad(Segment s, Point &q)
+{
+	auto [p1, c1, c2, p2] = s;
+	Point q1 = 3 * c1 - p1;
+	Point q2 = 3 * c2 - p2;
+	if (q1.x != q2.x || q1.y != q2.y)
+		return false;
+	q = q1 / 2;
+	return true;
+}
+
+static bool IsLineContour(const json &contour)
+{
+	return std::all_of(contour.begin(), contour.end(),
+	                   [](const json &point) { return bool(point["on"]); });
+}
+
+/* contour without off-curve points. only duplicate and collinear points are
+   removed, exactly as ConstructTtPath::Line and Finish would do.
+*/
+static json ConvertLineContour(const json &contour)
+{
+	std::vector<Point> path;
+	path.reserve(contour.size() + 1);
+	auto line = [&path](Point p1) {
+		size_t length = path.size();
+		if (length >= 2 && DistanceToLine(p1, path[length - 1],
+		                                  path[length - 2]) < 1)
+			path.pop_back();
+		path.push_back(p1);
+	};
+
+	// in reversed direction, back to the initial point
+	path.push_back(contour[0]);
+	for (size_t i = contour.size() - 1; i > 0; i--)
+		line(contour[i]);
+	line(contour[0]);
+
+	size_t length = path.size();
+	if (abs(path[0] - path[length - 1]) < 1)
+	{
+		path.pop_back();
+		length--;
+	}
+	if (length > 2 && DistanceToLine(path[1], path[0], path[length - 1]) < 1)
+		path.erase(path.begin());
+
+	json quadContour = json::array();
+	for (Point p : path)
+		quadContour.push_back(p.ToJson(true));
+	return quadContour;
+}
+
+static void StripHints(json &glyph)
 {
 	glyph.erase("stemH");
 	glyph.erase("stemV");
 	glyph.erase("hintMasks");
 	glyph.erase("contourMasks");
+}
+
+static void Convert(json &glyph, double error, bool spline,
+                    OutlineStats &stats)
+{
+	StripHints(glyph);
 
 	for (json &contour : glyph["contours"])
 	{
 		if (contour.size() <= 1)
 			continue;
 
+		if (IsLineContour(contour))
+		{
+			contour = ConvertLineContour(contour);
+			stats.lineContours++;
+			continue;
+		}
+
+		size_t approxSegments = 0;
 		json quadContour = json::array();
 		Segment s;
 		auto beg = contour.cbegin();
@@ -384,26 +574,78 @@ static json Convert(json glyph, double error)
 				s[2] = *q;
 				q = advance(q);
 				s[3] = *q;
-				ApproximateCurve(s, quadContour, error);
+				Point c;
+				if (IsElevatedQuad(s, c))
+				{
+					ConstructTtPath::Curve(quadContour, c, s[3]);
+					stats.exactSegments++;
+				}
+				else
+				{
+					if (spline)
+						ApproximateShortest(s, quadContour, error);
+					else
+						ApproximateCurve(s, quadContour, error);
+					approxSegments++;
+				}
 				s[0] = s[3];
 				cnt -= 3;
 			}
 		}
 
 		ConstructTtPath::Finish(quadContour);
-		contour = quadContour;
+		// drop the cubic contour right away
+		contour = std::move(quadContour);
+		if (approxSegments)
+			stats.approxContours++;
+		else
+			stats.exactContours++;
+		stats.approxSegments += approxSegments;
 	}
-
-	return glyph;
 }
 
-json Ps2Tt(const json &glyf, double errorBound)
+// convert in place, contour by contour
+json Ps2Tt(json &&glyf, double errorBound, OutlineStats *stats,
+           OutlineCache *cache, bool spline)
 {
-	json glyfQuad;
-	for (const auto &[name, glyph] : glyf.items())
+	OutlineStats local;
+	TraceChunks chunks("ps2tt", "convert", 1024);
+	for (auto &[name, glyph] : glyf.items())
 	{
-		glyfQuad[name] = Convert(glyph, errorBound);
-		RoundInPlace(glyfQuad[name]);
+		chunks.Next();
+		auto it = glyph.find("contours");
+		if (cache && it != glyph.end() && it->is_array() && !it->empty())
+		{
+			json &contours = *it;
+			uint64_t key = OutlineCache::Key(
+			    contours,
+			    spline ? OutlineCache::ToQuadraticSpline
+			           : OutlineCache::ToQuadratic,
+			    errorBound, true);
+			if (cache->Lookup(key, contours))
+			{
+				StripHints(glyph);
+				continue;
+			}
+			auto start = std::chrono::steady_clock::now();
+			Convert(glyph, errorBound, spline, local);
+			RoundInPlace(glyph);
+			cache->Store(key, contours, true,
+			             std::chrono::duration<double>(
+			                 std::chrono::steady_clock::now() - start)
+			                 .count());
+			continue;
+		}
+		Convert(glyph, errorBound, spline, local);
+		RoundInPlace(glyph);
 	}
-	return glyfQuad;
+	if (stats)
+		*stats += local;
+	return std::move(glyf);
+}
+
+json Ps2Tt(const json &glyf, double errorBound, OutlineStats *stats,
+           OutlineCache *cache, bool spline)
+{
+	return Ps2Tt(json(glyf), errorBound, stats, cache, spline);
 }
@@ -2,4 +2,15 @@
 
 #include <nlohmann/json.hpp>
 
-nlohmann::json Ps2Tt(const nlohmann::json &glyf, double errorBound = 1);
+#include "outline-cache.h"
+#include "outline-stats.h"
+
+/* spline: approximate each cubic with a quadratic spline whose joins are
+   implied on-curve points, which stores fewer points.
+*/
+nlohmann::json Ps2Tt(const nlohmann::json &glyf, double errorBound = 1,
+                     OutlineStats *stats = nullptr,
+                     OutlineCache *cache = nullptr, bool spline = false);
+nlohmann::json Ps2Tt(nlohmann::json &&glyf, double errorBound = 1,
+                     OutlineStats *stats = nullptr,
+                     OutlineCache *cache = nullptr, bool spline = false);
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <vector>
+
+#include "point.hpp"
+#include "simplify.h"
+
+using nlohmann::json;
+
+namespace
+{
+/* contour as a circular doubly linked list. error is how far removed
+   points may be from the segment that ends at this node.
+*/
+struct Node
+{
+	Point p;
+	bool on;
+	bool removed;
+	double error;
+	size_t prev;
+	size_t next;
+};
+
+class ContourSimplifier
+{
+public:
+	ContourSimplifier(const json &contour, double tolerance, bool cubic)
+	    : tolerance(tolerance), cubic(cubic), live(contour.size())
+	{
+		size_t n = contour.size();
+		nodes.reserve(n);
+		for (size_t i = 0; i < n; i++)
+			nodes.push_back({contour[i], bool(contour[i]["on"]), false, 0,
+			                 (i + n - 1) % n, (i + 1) % n});
+	}
+
+	// returns number of points removed
+	size_t Run()
+	{
+		size_t n = nodes.size();
+		for (size_t i = n; i > 0; i--)
+			pending.push_back(i - 1);
+		while (!pending.empty())
+		{
+			size_t i = pending.back();
+			pending.pop_back();
+			if (!nodes[i].removed)
+				TryRemove(i);
+		}
+		return n - live;
+	}
+
+	// kept points, starting from the first kept on-curve point
+	json Result(json &contour) const
+	{
+		size_t start = nodes.size();
+		for (size_t i = 0; i < nodes.size(); i++)
+			if (!nodes[i].removed && (nodes[i].on || start == nodes.size()))
+			{
+				start = i;
+				if (nodes[i].on)
+					break;
+			}
+		json result = json::array();
+		size_t i = start;
+		do
+		{
+			result.push_back(std::move(contour[i]));
+			i = nodes[i].next;
+		} while (i != start);
+		return result;
+	}
+
+private:
+	double tolerance;
+	bool cubic;
+	size_t live;
+	std::vector<Node> nodes;
+	std::vector<size_t> pending;
+
+	// distance from m to segment ab, or tolerance if it is not beside ab
+	double DistanceToSegment(Point a, Point m, Point b) const
+	{
+		Point ab = b - a;
+		double t = (m - a) * ab;
+		if (t < 0 || t > ab * ab)
+			return tolerance;
+		double d = DistanceToLine(a, m, b);
+		return std::isnan(d) ? tolerance : d;
+	}
+
+	void TryRemove(size_t i)
+	{
+		// keep at least 3 points
+		if (live <= 3)
+			return;
+		Node &m = nodes[i];
+		const Node &a = nodes[m.prev];
+		const Node &b = nodes[m.next];
+		double d = tolerance;
+		if (m.on && a.on)
+			d = std::min(d, abs(m.p - a.p));
+		if (m.on && b.on)
+			d = std::min(d, abs(m.p - b.p));
+		if (a.on && b.on && (m.on || !cubic))
+			// collinear point, or quadratic curve on the chord
+			d = std::min(d, DistanceToSegment(a.p, m.p, b.p));
+		if (!cubic && m.on && !a.on && !b.on)
+			// implied on-curve point
+			d = std::min(d, abs((a.p + b.p) / 2 - m.p));
+		if (Remove(i, i, d))
+			return;
+
+		// cubic curve on the chord
+		if (cubic && !m.on && a.on && !b.on && live > 4)
+		{
+			const Node &c = nodes[b.next];
+			if (c.on)
+				Remove(i, m.next,
+				       std::max(DistanceToSegment(a.p, m.p, c.p),
+				                DistanceToSegment(a.p, b.p, c.p)));
+		}
+	}
+
+	// remove nodes first..last if the outline stays within tolerance
+	bool Remove(size_t first, size_t last, double d)
+	{
+		size_t a = nodes[first].prev;
+		size_t b = nodes[last].next;
+		double error = nodes[b].error;
+		for (size_t i = first; i != b; i = nodes[i].next)
+			error = std::max(error, nodes[i].error);
+		error += d;
+		if (error >= tolerance)
+			return false;
+
+		for (size_t i = first; i != b; i = nodes[i].next)
+		{
+			nodes[i].removed = true;
+			live--;
+		}
+		nodes[a].next = b;
+		nodes[b].prev = a;
+		nodes[b].error = error;
+		pending.push_back(nodes[b].next);
+		pending.push_back(b);
+		pending.push_back(nodes[a].prev);
+		pending.push_back(a);
+		return true;
+	}
+};
+
+bool HasPointReference(const json &glyph)
+{
+	for (const char *key : {"instructions", "hintMasks", "contourMasks"})
+	{
+		auto it = glyph.find(key);
+		if (it != glyph.end() && !it->empty())
+			return true;
+	}
+	return false;
+}
+} // namespace
+
+SimplifyStats Simplify(json &glyf, double tolerance, bool cubic)
+{
+	SimplifyStats stats;
+	for (auto &[name, glyph] : glyf.items())
+	{
+		auto it = glyph.find("contours");
+		if (it == glyph.end() || !it->is_array() || HasPointReference(glyph))
+			continue;
+		size_t removed = 0;
+		for (json &contour : *it)
+		{
+			if (contour.size() <= 3)
+				continue;
+			ContourSimplifier simplifier(contour, tolerance, cubic);
+			size_t n = simplifier.Run();
+			if (n)
+			{
+				contour = simplifier.Result(contour);
+				removed += n;
+			}
+		}
+		if (removed)
+		{
+			stats.glyphs++;
+			stats.points += removed;
+		}
+	}
+	return stats;
+}
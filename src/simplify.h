@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+#include <nlohmann/json.hpp>
+
+struct SimplifyStats
+{
+	size_t glyphs = 0; // glyphs with at least one point removed
+	size_t points = 0; // points removed
+};
+
+/* remove redundant points from contours of all glyphs in place:
+   coincident on-curve points, collinear on-curve points, curves whose
+   off-curve points lie on the chord, and (TrueType) on-curve points at
+   the middle of 2 off-curve points. the outline moves less than tolerance.
+   glyphs with instructions or hint masks are left untouched since they
+   refer to point indices.
+*/
+SimplifyStats Simplify(nlohmann::json &glyf, double tolerance, bool cubic);
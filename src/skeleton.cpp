@@ -0,0 +1,267 @@
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "mapped-file.h"
+#include "skeleton.h"
+
+using json = nlohmann::json;
+
+namespace {
+class SkeletonSax : public nlohmann::json_sax<json> {
+public:
+	explicit SkeletonSax(json &font) : font(font) {}
+
+	bool null() override {
+		return true;
+	}
+	bool boolean(bool) override {
+		return true;
+	}
+	bool number_integer(number_integer_t val) override {
+		return Number(val);
+	}
+	bool number_unsigned(number_unsigned_t val) override {
+		return Number(val);
+	}
+	bool number_float(number_float_t val, const string_t &) override {
+		return Number(val);
+	}
+
+	bool string(string_t &val) override {
+		size_t depth = path.size();
+		if (depth == 2 && (path[1] == "cmap" || path[1] == "cmap_uvs"))
+			font[path[1]][pending] = std::move(val);
+		else if (depth == 5 && path[1] == "glyf" && path[3] == "references" &&
+		         pending == "glyph")
+			(*glyph)["references"].push_back({{"glyph", std::move(val)}});
+		else if (depth == 2 && path[1] == "glyph_order" &&
+		         font["glyph_order"].empty())
+			font["glyph_order"].push_back(std::move(val));
+		else if (depth >= 2 && path[1] == "GSUB")
+			font["GSUB"].push_back(std::move(val));
+		return true;
+	}
+
+	bool start_object(std::size_t) override {
+		if (path.size() == 2 && path[1] == "glyf")
+			glyph = &(font["glyf"][pending] = json::object());
+		Enter(false);
+		return true;
+	}
+	bool key(string_t &val) override {
+		if (path.size() == 1 && (val == "CFF_" || val == "CFF2"))
+			font[val] = true;
+		else if (path.size() == 1 && val == "GSUB")
+			font["GSUB"] = json::array();
+		else if (path.size() >= 2 && path[1] == "GSUB")
+			// substitution tables use glyph names as keys too
+			font["GSUB"].push_back(val);
+		pending = val;
+		return true;
+	}
+	bool end_object() override {
+		Leave();
+		return true;
+	}
+
+	bool start_array(std::size_t) override {
+		if (path.size() == 3 && path[1] == "glyf" &&
+		    (pending == "contours" || pending == "references"))
+			(*glyph)[pending] = json::array();
+		else if (path.size() == 1 && pending == "glyph_order")
+			font["glyph_order"] = json::array();
+		Enter(true);
+		return true;
+	}
+	bool end_array() override {
+		Leave();
+		return true;
+	}
+
+	bool parse_error(std::size_t, const std::string &,
+	                 const nlohmann::detail::exception &) override {
+		return false;
+	}
+
+private:
+	json &font;
+	json *glyph = nullptr;
+	// names of open containers, "[]" for array elements
+	std::vector<std::string> path;
+	std::vector<bool> inArray;
+	std::string pending;
+
+	template <typename T> bool Number(T val) {
+		if (path.size() == 2 && path[1] == "head" && pending == "unitsPerEm")
+			font["head"]["unitsPerEm"] = val;
+		return true;
+	}
+
+	void Enter(bool array) {
+		path.push_back(path.empty() ? ""
+		                            : inArray.back() ? "[]" : pending);
+		inArray.push_back(array);
+	}
+	void Leave() {
+		path.pop_back();
+		inArray.pop_back();
+	}
+};
+
+using GlyphCallback = std::function<void(const std::string &, json &)>;
+
+/* forwards to a DOM parser what is not skipped. with each, every glyph is
+   parsed into a DOM of its own and handed over.
+*/
+class SubsetSax : public nlohmann::json_sax<json> {
+public:
+	SubsetSax(json &font, const std::set<std::string> &tables,
+	          const std::set<std::string> &glyphs,
+	          const GlyphCallback *each = nullptr)
+	    : dom(font), tables(tables), glyphs(glyphs), each(each) {}
+
+	bool null() override {
+		return Skip() || Dom().null();
+	}
+	bool boolean(bool val) override {
+		return Skip() || Dom().boolean(val);
+	}
+	bool number_integer(number_integer_t val) override {
+		return Skip() || Dom().number_integer(val);
+	}
+	bool number_unsigned(number_unsigned_t val) override {
+		return Skip() || Dom().number_unsigned(val);
+	}
+	bool number_float(number_float_t val, const string_t &s) override {
+		return Skip() || Dom().number_float(val, s);
+	}
+	bool string(string_t &val) override {
+		return Skip() || Dom().string(val);
+	}
+
+	bool start_object(std::size_t elements) override {
+		return Enter() || Dom().start_object(elements);
+	}
+	bool key(string_t &val) override {
+		if (skipping)
+			return true;
+		if (depth == 1) {
+			table = val;
+			skipNext = !tables.count(val) && !(each && val == "glyf");
+		} else if (depth == 2 && table == "glyf" && each) {
+			name = val;
+			glyphNext = true;
+			return true;
+		} else if (depth == 2 && table == "glyf")
+			skipNext = !glyphs.count(val);
+		return skipNext || Dom().key(val);
+	}
+	bool end_object() override {
+		return Leave() || (Dom().end_object() && Done());
+	}
+
+	bool start_array(std::size_t elements) override {
+		return Enter() || Dom().start_array(elements);
+	}
+	bool end_array() override {
+		return Leave() || (Dom().end_array() && Done());
+	}
+
+	bool parse_error(std::size_t position, const std::string &token,
+	                 const nlohmann::detail::exception &ex) override {
+		return dom.parse_error(position, token, ex);
+	}
+
+private:
+	nlohmann::detail::json_sax_dom_parser<json> dom;
+	const std::set<std::string> &tables;
+	const std::set<std::string> &glyphs;
+	const GlyphCallback *each;
+	std::unique_ptr<nlohmann::detail::json_sax_dom_parser<json>> glyphDom;
+	json glyph;
+	std::string table, name;
+	int depth = 0;          // containers open in the DOM
+	int skipping = 0;       // containers open in a skipped value
+	bool skipNext = false;  // the value of a skipped key
+	bool glyphNext = false; // the value of a glyph key, with each
+
+	nlohmann::detail::json_sax_dom_parser<json> &Dom() {
+		return glyphDom ? *glyphDom : dom;
+	}
+	// true if a scalar is skipped
+	bool Skip() {
+		if (skipping)
+			return true;
+		bool skip = skipNext || glyphNext;
+		skipNext = glyphNext = false;
+		return skip;
+	}
+	// true if a container is skipped
+	bool Enter() {
+		if (skipping || skipNext) {
+			skipping++;
+			skipNext = false;
+			return true;
+		}
+		depth++;
+		if (glyphNext) {
+			glyph = json();
+			glyphDom = std::make_unique<
+			    nlohmann::detail::json_sax_dom_parser<json>>(glyph);
+			glyphNext = false;
+		}
+		return false;
+	}
+	// hand over a glyph once it is closed
+	bool Done() {
+		if (glyphDom && depth == 2) {
+			glyphDom.reset();
+			(*each)(name, glyph);
+		}
+		return true;
+	}
+	bool Leave() {
+		if (skipping) {
+			skipping--;
+			return true;
+		}
+		depth--;
+		return false;
+	}
+};
+} // namespace
+
+bool LoadSkeleton(const char *u8filename, json &font) {
+	MappedFile file;
+	if (!file.Open(u8filename))
+		return false;
+	const char *data = file.Data();
+	return ParseSkeleton(data, data + file.Size(), font);
+}
+
+bool ParseSkeleton(const char *begin, const char *end, json &font) {
+	font = json::object();
+	SkeletonSax sax(font);
+	return json::sax_parse(begin, end, &sax);
+}
+
+void ParseSubset(const char *begin, const char *end,
+                 const std::set<std::string> &tables,
+                 const std::set<std::string> &glyphs, json &font) {
+	font = json::object();
+	SubsetSax sax(font, tables, glyphs);
+	json::sax_parse(begin, end, &sax);
+}
+
+void ParseGlyphs(const char *begin, const char *end,
+                 const std::set<std::string> &tables,
+                 const std::function<void(const std::string &, json &)> &each,
+                 json &font) {
+	font = json::object();
+	std::set<std::string> glyphs; // not used with each
+	SubsetSax sax(font, tables, glyphs, &each);
+	json::sax_parse(begin, end, &sax);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <functional>
+#include <set>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+/* load only what merging decisions depend on: cmap, cmap_uvs,
+   head.unitsPerEm, the first entry of glyph_order, presence of CFF_/CFF2,
+   every string in GSUB as a flat list, and per glyph, whether it has contours and which glyphs it references.
+   outlines are skipped by a SAX parser over the mapped file, nothing else
+   is stored. returns false if the file cannot be read or parsed.
+*/
+bool LoadSkeleton(const char *u8filename, nlohmann::json &font);
+
+// the same from JSON text in memory
+bool ParseSkeleton(const char *begin, const char *end, nlohmann::json &font);
+
+/* parse only the given top-level tables, and of glyf only the given glyphs.
+   the rest is skipped without being stored. throws on malformed JSON, as
+   json::parse does.
+*/
+void ParseSubset(const char *begin, const char *end,
+                 const std::set<std::string> &tables,
+                 const std::set<std::string> &glyphs, nlohmann::json &font);
+
+/* the same, but every glyph is passed to each as soon as it is parsed, with
+   its name, instead of being stored in font.
+*/
+void ParseGlyphs(
+    const char *begin, const char *end, const std::set<std::string> &tables,
+    const std::function<void(const std::string &, nlohmann::json &)> &each,
+    nlohmann::json &font);
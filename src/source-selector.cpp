@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <utility>
+
+#include <nowide/fstream.hpp>
+
+#include "source-selector.h"
+#include "subset.h"
+
+using json = nlohmann::json;
+
+SourceSelector::SourceSelector() : owner(0x110000, -1) {}
+
+// file name without directory
+static std::string BaseName(const std::string &path) {
+	size_t slash = path.find_last_of("/\\");
+	return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static bool ParseSource(const std::string &token,
+                        const std::vector<std::string> &sources, int &source) {
+	if (std::all_of(token.begin(), token.end(), ::isdigit)) {
+		source = std::stoi(token) - 1;
+		return source >= 0 && source < int(sources.size());
+	}
+	for (size_t i = 0; i < sources.size(); i++)
+		if (token == sources[i] || token == BaseName(sources[i])) {
+			source = int(i);
+			return true;
+		}
+	return false;
+}
+
+bool SourceSelector::LoadRules(const char *u8filename,
+                               const std::vector<std::string> &sources,
+                               size_t &errorLine) {
+	nowide::ifstream file(u8filename);
+	errorLine = 0;
+	if (!file)
+		return false;
+
+	std::vector<std::pair<int, int>> ranges;
+	std::string line;
+	for (size_t lineNo = 1; std::getline(file, line); lineNo++) {
+		std::istringstream tokens(line.substr(0, line.find('#')));
+		std::string token;
+		if (!(tokens >> token))
+			continue;
+		std::pair<int, int> range;
+		std::vector<int> rule;
+		int source;
+		if (!ParseCodepointRange(token, range)) {
+			errorLine = lineNo;
+			return false;
+		}
+		while (tokens >> token) {
+			if (!ParseSource(token, sources, source)) {
+				errorLine = lineNo;
+				return false;
+			}
+			rule.push_back(source);
+		}
+		if (rule.empty()) {
+			errorLine = lineNo;
+			return false;
+		}
+		ranges.push_back(range);
+		rules.push_back(std::move(rule));
+	}
+	BuildIntervals(ranges);
+	return true;
+}
+
+/* sweep over range boundaries. between 2 boundaries the latest active rule
+   applies.
+*/
+void SourceSelector::BuildIntervals(
+    const std::vector<std::pair<int, int>> &ranges) {
+	// (position, rule), rule + 1 starts, -(rule + 1) ends
+	std::vector<std::pair<int, int>> events;
+	for (size_t i = 0; i < ranges.size(); i++) {
+		events.emplace_back(ranges[i].first, int(i) + 1);
+		events.emplace_back(ranges[i].second + 1, -(int(i) + 1));
+	}
+	std::sort(events.begin(), events.end());
+
+	std::set<int> active;
+	intervals.clear();
+	for (size_t i = 0; i < events.size();) {
+		int position = events[i].first;
+		for (; i < events.size() && events[i].first == position; i++)
+			if (events[i].second > 0)
+				active.insert(events[i].second - 1);
+			else
+				active.erase(-events[i].second - 1);
+		if (active.empty() || i == events.size())
+			continue;
+		int rule = *active.rbegin();
+		int last = events[i].first - 1;
+		if (!intervals.empty() && intervals.back().rule == rule &&
+		    intervals.back().last == position - 1)
+			intervals.back().last = last;
+		else
+			intervals.push_back({position, last, rule});
+	}
+}
+
+std::vector<SourceSelector::Selected> SourceSelector::Select(const json &cmap,
+                                                             int source) {
+	std::vector<int> codepoints;
+	codepoints.reserve(cmap.size());
+	for (auto &[u, n] : cmap.items())
+		codepoints.push_back(std::stoi(u));
+	std::sort(codepoints.begin(), codepoints.end());
+
+	std::vector<Selected> result;
+	auto interval = intervals.begin();
+	for (int u : codepoints) {
+		if (u < 0 || u >= int(owner.size()))
+			continue;
+		while (interval != intervals.end() && interval->last < u)
+			++interval;
+		int current = owner[u];
+		bool ruled = interval != intervals.end() && interval->first <= u;
+		bool take;
+		if (!ruled)
+			take = current < 0;
+		else {
+			const auto &rule = rules[interval->rule];
+			auto rank = [&rule](int s) {
+				return std::find(rule.begin(), rule.end(), s) - rule.begin();
+			};
+			take = rank(source) < rank(current);
+		}
+		if (take) {
+			owner[u] = int16_t(source);
+			result.push_back({u, ruled});
+		}
+	}
+	return result;
+}
+
+int SourceSelector::Owner(int codepoint) const {
+	if (codepoint < 0 || codepoint >= int(owner.size()))
+		return -1;
+	return owner[codepoint];
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+/* which source font supplies each code point. sources are numbered by
+   command line position, 0 being the base font.
+
+   without rules, the first source that has a code point wins. a rule maps
+   a code point range to an ordered list of sources: the first listed
+   source that has the code point wins, and unlisted sources never supply
+   it. later rules override earlier ones where they overlap.
+*/
+class SourceSelector {
+public:
+	SourceSelector();
+
+	/* one rule per line, a range followed by sources, e.g.
+	   "0030-0039 latin.otd" or "F900..FAFF 3 1". a source is a position
+	   (1 for the base font) or a file name as given on the command line,
+	   with or without directory. "#" starts a comment.
+	   on failure, errorLine is the first malformed line, or 0 if the file
+	   cannot be read.
+	*/
+	bool LoadRules(const char *u8filename,
+	               const std::vector<std::string> &sources, size_t &errorLine);
+
+	struct Selected {
+		int codepoint;
+		bool ruled; // covered by a rule, may replace a previous source
+	};
+
+	/* code points of cmap that source supplies, in one sweep over sorted
+	   code points and rule intervals. owners are updated.
+	*/
+	std::vector<Selected> Select(const nlohmann::json &cmap, int source);
+
+	// -1 if no source supplies codepoint
+	int Owner(int codepoint) const;
+
+private:
+	struct Interval {
+		int first;
+		int last;
+		int rule;
+	};
+
+	std::vector<std::vector<int>> rules;
+	std::vector<Interval> intervals; // sorted and disjoint
+	std::vector<int16_t> owner;      // -1 if none
+
+	void BuildIntervals(const std::vector<std::pair<int, int>> &ranges);
+};
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+#include <nowide/fstream.hpp>
+
+#include "charset-table.hpp"
+#include "subset.h"
+
+using json = nlohmann::json;
+
+bool Charset::LoadBuiltin(const std::string &name) {
+	std::string lower;
+	std::transform(name.begin(), name.end(), std::back_inserter(lower),
+	               [](unsigned char c) { return std::tolower(c); });
+
+	auto load = [this](const auto &table) {
+		for (auto &r : table)
+			ranges.emplace_back(r.first, r.last);
+		Normalize();
+		return true;
+	};
+	if (lower == "gb2312")
+		return load(Gb2312Ranges);
+	if (lower == "gbk")
+		return load(GbkRanges);
+	if (lower == "gb18030")
+		return load(Gb18030Ranges);
+	if (lower == "big5")
+		return load(Big5Ranges);
+	return false;
+}
+
+// hex code point with optional "U+" or "0x" prefix
+static bool ParseCodepoint(const std::string &s, size_t &pos, int &codepoint) {
+	if (s.compare(pos, 2, "U+") == 0 || s.compare(pos, 2, "u+") == 0 ||
+	    s.compare(pos, 2, "0x") == 0 || s.compare(pos, 2, "0X") == 0)
+		pos += 2;
+	size_t begin = pos;
+	while (pos < s.size() && std::isxdigit((unsigned char)s[pos]))
+		pos++;
+	if (pos == begin || pos - begin > 6)
+		return false;
+	codepoint = std::stoi(s.substr(begin, pos - begin), nullptr, 16);
+	return codepoint <= 0x10FFFF;
+}
+
+bool ParseCodepointRange(const std::string &token, std::pair<int, int> &range) {
+	size_t pos = 0;
+	if (!ParseCodepoint(token, pos, range.first))
+		return false;
+	range.second = range.first;
+	if (pos == token.size())
+		return true;
+	if (token.compare(pos, 2, "..") == 0)
+		pos += 2;
+	else if (token[pos] == '-')
+		pos++;
+	else
+		return false;
+	return ParseCodepoint(token, pos, range.second) && pos == token.size() &&
+	       range.first <= range.second;
+}
+
+bool Charset::LoadFile(const char *u8filename, size_t &errorLine) {
+	nowide::ifstream file(u8filename);
+	errorLine = 0;
+	if (!file)
+		return false;
+
+	std::string line;
+	for (size_t lineNo = 1; std::getline(file, line); lineNo++) {
+		line = line.substr(0, line.find('#'));
+		std::replace(line.begin(), line.end(), ',', ' ');
+		std::istringstream tokens(line);
+		std::string token;
+		while (tokens >> token) {
+			std::pair<int, int> range;
+			if (!ParseCodepointRange(token, range)) {
+				errorLine = lineNo;
+				return false;
+			}
+			ranges.push_back(range);
+		}
+	}
+	Normalize();
+	return true;
+}
+
+void Charset::Normalize() {
+	std::sort(ranges.begin(), ranges.end());
+	std::vector<std::pair<int, int>> merged;
+	for (auto &r : ranges)
+		if (!merged.empty() && r.first <= merged.back().second + 1)
+			merged.back().second = std::max(merged.back().second, r.second);
+		else
+			merged.push_back(r);
+	ranges = std::move(merged);
+}
+
+bool Charset::Contains(int codepoint) const {
+	auto it = std::upper_bound(
+	    ranges.begin(), ranges.end(), codepoint,
+	    [](int c, const std::pair<int, int> &r) { return c < r.first; });
+	return it != ranges.begin() && codepoint <= std::prev(it)->second;
+}
+
+size_t SubsetCmap(json &font, const Charset &charset) {
+	size_t dropped = 0;
+	// cmap keys are code points, cmap_uvs keys are "<code point> <selector>"
+	for (const char *table : {"cmap", "cmap_uvs"}) {
+		if (font.find(table) == font.end())
+			continue;
+		auto &cmap = font[table];
+		std::vector<std::string> eraseList;
+		for (auto &[u, n] : cmap.items())
+			if (!charset.Contains(std::stoi(u)))
+				eraseList.push_back(u);
+		for (auto &u : eraseList)
+			cmap.erase(u);
+		if (std::string(table) == "cmap")
+			dropped = eraseList.size();
+	}
+	return dropped;
+}
+
+// every glyph name in a layout table, as a key or as a value
+template <typename Mark> static void MarkLayout(const json &table, Mark &mark) {
+	if (table.is_string())
+		mark(table.get<std::string>());
+	else if (table.is_array())
+		for (auto &item : table)
+			MarkLayout(item, mark);
+	else if (table.is_object())
+		for (auto &[k, v] : table.items()) {
+			mark(k);
+			MarkLayout(v, mark);
+		}
+}
+
+size_t CollectGarbage(json &font, bool layoutRoots) {
+	auto &glyf = font["glyf"];
+	std::unordered_set<std::string> marked;
+	std::vector<const json *> stack;
+	auto mark = [&](const std::string &name) {
+		auto it = glyf.find(name);
+		if (it != glyf.end() && marked.insert(name).second)
+			stack.push_back(&*it);
+	};
+
+	mark(".notdef");
+	if (font.find("glyph_order") != font.end() && !font["glyph_order"].empty())
+		mark(font["glyph_order"][0]);
+	for (const char *table : {"cmap", "cmap_uvs"})
+		if (font.find(table) != font.end())
+			for (auto &[u, n] : font[table].items())
+				mark(n);
+	if (layoutRoots && font.find("GSUB") != font.end())
+		MarkLayout(font["GSUB"], mark);
+
+	while (!stack.empty()) {
+		const json &glyph = *stack.back();
+		stack.pop_back();
+		if (glyph.find("references") != glyph.end())
+			for (auto &r : glyph["references"])
+				mark(r["glyph"]);
+	}
+
+	std::vector<std::string> eraseList;
+	for (auto &[n, g] : glyf.items())
+		if (marked.find(n) == marked.end())
+			eraseList.push_back(n);
+	for (auto &n : eraseList)
+		glyf.erase(n);
+
+	if (font.find("glyph_order") != font.end()) {
+		json order = json::array();
+		for (auto &n : font["glyph_order"])
+			if (marked.find(n.get<std::string>()) != marked.end())
+				order.push_back(std::move(n));
+		font["glyph_order"] = std::move(order);
+	}
+	return eraseList.size();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+class Charset {
+public:
+	// gb2312, gbk, gb18030 or big5, case insensitive
+	bool LoadBuiltin(const std::string &name);
+
+	/* code points or ranges in hex, separated by spaces, commas or lines,
+	   e.g. "U+4E00", "4E00-9FFF", "U+3400..U+4DBF". "#" starts a comment.
+	   on failure, errorLine is the first malformed line, or 0 if the file
+	   cannot be read.
+	*/
+	bool LoadFile(const char *u8filename, size_t &errorLine);
+
+	bool Contains(int codepoint) const;
+
+	const std::vector<std::pair<int, int>> &Ranges() const {
+		return ranges;
+	}
+
+private:
+	std::vector<std::pair<int, int>> ranges; // sorted and disjoint
+
+	void Normalize();
+};
+
+// "4E00", "U+4E00", "4E00-9FFF" or "U+3400..U+4DBF"
+bool ParseCodepointRange(const std::string &token, std::pair<int, int> &range);
+
+// drop cmap entries outside charset, returns number of entries dropped
+size_t SubsetCmap(nlohmann::json &font, const Charset &charset);
+
+/* mark glyphs reachable from .notdef, cmap, cmap_uvs (and GSUB if
+   layoutRoots) through references, then sweep the rest from glyf and
+   glyph_order. returns number of glyphs removed.
+*/
+size_t CollectGarbage(nlohmann::json &font, bool layoutRoots);
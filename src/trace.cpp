@@ -0,0 +1,75 @@
+#include <mutex>
+#include <vector>
+
+#include <nowide/fstream.hpp>
+
+#include "trace.h"
+
+using json = nlohmann::json;
+
+std::atomic<bool> tracing{false};
+
+namespace {
+
+struct Event {
+	std::string name;
+	const char *category;
+	unsigned thread;
+	TraceClock::time_point start, end;
+	json args;
+};
+
+std::mutex mutex;
+std::vector<Event> events;
+TraceClock::time_point origin;
+
+// small numbers in the order threads first record a span
+unsigned ThreadNumber() {
+	static std::atomic<unsigned> threads{0};
+	thread_local unsigned number = ++threads;
+	return number;
+}
+
+} // namespace
+
+void StartTrace() {
+	origin = TraceClock::now();
+	tracing = true;
+}
+
+bool WriteTrace(const std::string &path) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto micro = [](TraceClock::duration d) {
+		return std::chrono::duration<double, std::micro>(d).count();
+	};
+	json trace = {{"traceEvents", json::array()}, {"displayTimeUnit", "ms"}};
+	auto &out = trace["traceEvents"];
+	for (auto &event : events)
+		out.push_back({{"name", event.name},
+		               {"cat", event.category},
+		               {"ph", "X"},
+		               {"ts", micro(event.start - origin)},
+		               {"dur", micro(event.end - event.start)},
+		               {"pid", 1},
+		               {"tid", event.thread},
+		               {"args", event.args}});
+	nowide::ofstream file(path.c_str());
+	return bool(file << trace.dump() << std::endl);
+}
+
+void TraceSpan(const char *name, const char *category,
+               TraceClock::time_point start, TraceClock::time_point end,
+               json args) {
+	if (!TraceEnabled())
+		return;
+	Event event{name, category, ThreadNumber(), start, end, std::move(args)};
+	std::lock_guard<std::mutex> lock(mutex);
+	events.push_back(std::move(event));
+}
+
+void TraceChunks::Flush() {
+	if (!count)
+		return;
+	TraceSpan(name, category, start, TraceClock::now(), {{"items", count}});
+	count = 0;
+}
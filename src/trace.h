@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+/* spans of every thread in Chrome trace-event JSON, for chrome://tracing
+   or Perfetto. each span is a complete event ("ph": "X") on the thread
+   that ran it, in microseconds since StartTrace. until then nothing is
+   recorded, and a span costs a flag test.
+*/
+using TraceClock = std::chrono::steady_clock;
+
+extern std::atomic<bool> tracing;
+
+inline bool TraceEnabled() {
+	return tracing.load(std::memory_order_relaxed);
+}
+
+void StartTrace();
+
+// every span recorded so far. false if path cannot be written.
+bool WriteTrace(const std::string &path);
+
+// span of the calling thread. category groups spans in the viewer.
+void TraceSpan(const char *name, const char *category,
+               TraceClock::time_point start, TraceClock::time_point end,
+               nlohmann::json args = nlohmann::json::object());
+
+/* a loop over many items as spans of size items each, so that its
+   progress shows in the trace. call Next before each item.
+*/
+class TraceChunks {
+public:
+	TraceChunks(const char *name, const char *category, size_t size)
+	    : name(name), category(category), size(size) {}
+	~TraceChunks() { Flush(); }
+
+	TraceChunks(const TraceChunks &) = delete;
+	TraceChunks &operator=(const TraceChunks &) = delete;
+
+	void Next() {
+		if (!TraceEnabled())
+			return;
+		if (count == size)
+			Flush();
+		if (!count++)
+			start = TraceClock::now();
+	}
+
+private:
+	void Flush();
+
+	const char *name;
+	const char *category;
+	size_t size;
+	size_t count = 0;
+	TraceClock::time_point start;
+};
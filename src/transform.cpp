@@ -0,0 +1,280 @@
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                   \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORM_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define TRANSFORM_NEON
+#endif
+
+#include "transform.h"
+
+using nlohmann::json;
+
+Affine operator*(const Affine &t, const Affine &s)
+{
+	Affine r;
+	r.a = t.a * s.a + t.b * s.c;
+	r.b = t.a * s.b + t.b * s.d;
+	r.c = t.c * s.a + t.d * s.c;
+	r.d = t.c * s.b + t.d * s.d;
+	r.dx = t.a * s.dx + t.b * s.dy + t.dx;
+	r.dy = t.c * s.dx + t.d * s.dy + t.dy;
+	return r;
+}
+
+void AffineApply(const Affine &t, double *x, double *y, size_t n)
+{
+	size_t i = 0;
+#if defined(TRANSFORM_SSE2)
+	__m128d a = _mm_set1_pd(t.a), b = _mm_set1_pd(t.b);
+	__m128d c = _mm_set1_pd(t.c), d = _mm_set1_pd(t.d);
+	__m128d dx = _mm_set1_pd(t.dx), dy = _mm_set1_pd(t.dy);
+	for (; i + 2 <= n; i += 2)
+	{
+		__m128d vx = _mm_loadu_pd(x + i);
+		__m128d vy = _mm_loadu_pd(y + i);
+		_mm_storeu_pd(x + i, _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, vx),
+		                                           _mm_mul_pd(b, vy)),
+		                                dx));
+		_mm_storeu_pd(y + i, _mm_add_pd(_mm_add_pd(_mm_mul_pd(c, vx),
+		                                           _mm_mul_pd(d, vy)),
+		                                dy));
+	}
+#elif defined(TRANSFORM_NEON)
+	float64x2_t a = vdupq_n_f64(t.a), b = vdupq_n_f64(t.b);
+	float64x2_t c = vdupq_n_f64(t.c), d = vdupq_n_f64(t.d);
+	float64x2_t dx = vdupq_n_f64(t.dx), dy = vdupq_n_f64(t.dy);
+	for (; i + 2 <= n; i += 2)
+	{
+		float64x2_t vx = vld1q_f64(x + i);
+		float64x2_t vy = vld1q_f64(y + i);
+		vst1q_f64(x + i, vaddq_f64(vaddq_f64(vmulq_f64(a, vx),
+		                                     vmulq_f64(b, vy)),
+		                           dx));
+		vst1q_f64(y + i, vaddq_f64(vaddq_f64(vmulq_f64(c, vx),
+		                                     vmulq_f64(d, vy)),
+		                           dy));
+	}
+#endif
+	for (; i < n; i++)
+	{
+		double vx = x[i], vy = y[i];
+		x[i] = t.a * vx + t.b * vy + t.dx;
+		y[i] = t.c * vx + t.d * vy + t.dy;
+	}
+}
+
+#if defined(TRANSFORM_SSE2)
+/* SSE2 has no round-half-away: truncate, then step away from zero if the
+   (exact) fraction is at least 1/2.
+*/
+static inline __m128i RoundToInt32(__m128d v)
+{
+	const __m128d half = _mm_set1_pd(0.5), one = _mm_set1_pd(1);
+	__m128d t = _mm_cvtepi32_pd(_mm_cvttpd_epi32(v));
+	__m128d f = _mm_sub_pd(v, t);
+	__m128d up = _mm_and_pd(_mm_cmpge_pd(f, half), one);
+	__m128d down = _mm_and_pd(_mm_cmple_pd(f, _mm_sub_pd(_mm_setzero_pd(),
+	                                                      half)),
+	                          one);
+	return _mm_cvttpd_epi32(_mm_add_pd(t, _mm_sub_pd(up, down)));
+}
+#endif
+
+void AffineRound(const Affine &t, const double *x, const double *y, size_t n,
+                 int32_t *outX, int32_t *outY)
+{
+	size_t i = 0;
+#if defined(TRANSFORM_SSE2)
+	__m128d a = _mm_set1_pd(t.a), b = _mm_set1_pd(t.b);
+	__m128d c = _mm_set1_pd(t.c), d = _mm_set1_pd(t.d);
+	__m128d dx = _mm_set1_pd(t.dx), dy = _mm_set1_pd(t.dy);
+	for (; i + 2 <= n; i += 2)
+	{
+		__m128d vx = _mm_loadu_pd(x + i);
+		__m128d vy = _mm_loadu_pd(y + i);
+		__m128d rx =
+		    _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, vx), _mm_mul_pd(b, vy)), dx);
+		__m128d ry =
+		    _mm_add_pd(_mm_add_pd(_mm_mul_pd(c, vx), _mm_mul_pd(d, vy)), dy);
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(outX + i),
+		                 RoundToInt32(rx));
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(outY + i),
+		                 RoundToInt32(ry));
+	}
+#elif defined(TRANSFORM_NEON)
+	float64x2_t a = vdupq_n_f64(t.a), b = vdupq_n_f64(t.b);
+	float64x2_t c = vdupq_n_f64(t.c), d = vdupq_n_f64(t.d);
+	float64x2_t dx = vdupq_n_f64(t.dx), dy = vdupq_n_f64(t.dy);
+	for (; i + 2 <= n; i += 2)
+	{
+		float64x2_t vx = vld1q_f64(x + i);
+		float64x2_t vy = vld1q_f64(y + i);
+		float64x2_t rx =
+		    vaddq_f64(vaddq_f64(vmulq_f64(a, vx), vmulq_f64(b, vy)), dx);
+		float64x2_t ry =
+		    vaddq_f64(vaddq_f64(vmulq_f64(c, vx), vmulq_f64(d, vy)), dy);
+		// vrndaq: round half away from zero
+		vst1_s32(outX + i, vmovn_s64(vcvtq_s64_f64(vrndaq_f64(rx))));
+		vst1_s32(outY + i, vmovn_s64(vcvtq_s64_f64(vrndaq_f64(ry))));
+	}
+#endif
+	for (; i < n; i++)
+	{
+		outX[i] = int32_t(round(t.a * x[i] + t.b * y[i] + t.dx));
+		outY[i] = int32_t(round(t.c * x[i] + t.d * y[i] + t.dy));
+	}
+}
+
+namespace
+{
+// coordinates of many contours in contiguous buffers
+struct PointBuffer
+{
+	std::vector<double> x, y;
+	std::vector<int32_t> roundedX, roundedY;
+
+	void Gather(const json &contours)
+	{
+		for (const auto &contour : contours)
+			for (const auto &point : contour)
+			{
+				x.push_back(point["x"]);
+				y.push_back(point["y"]);
+			}
+	}
+
+	void Transform(const Affine &t, bool roundToInt)
+	{
+		if (roundToInt)
+		{
+			roundedX.resize(x.size());
+			roundedY.resize(y.size());
+			AffineRound(t, x.data(), y.data(), x.size(), roundedX.data(),
+			            roundedY.data());
+		}
+		else
+			AffineApply(t, x.data(), y.data(), x.size());
+	}
+
+	// returns index past the last point scattered
+	size_t Scatter(json &contours, size_t i, bool roundToInt) const
+	{
+		for (auto &contour : contours)
+			for (auto &point : contour)
+			{
+				if (roundToInt)
+				{
+					point["x"] = roundedX[i];
+					point["y"] = roundedY[i];
+				}
+				else
+				{
+					point["x"] = x[i];
+					point["y"] = y[i];
+				}
+				i++;
+			}
+		return i;
+	}
+};
+
+/* reference is x' = a x + c y + x, y' = b x + d y + y (as otfcc dumps it).
+   its target is transformed by t as well, so the new matrix is
+   L M L⁻¹ and the new offset L o + T - L M L⁻¹ T.
+*/
+void TransformReference(json &reference, const Affine &t, bool roundToInt)
+{
+	Affine m;
+	m.a = reference.value("a", 1.0);
+	m.b = reference.value("c", 0.0);
+	m.c = reference.value("b", 0.0);
+	m.d = reference.value("d", 1.0);
+	bool uniform = t.a == t.d && t.b == 0 && t.c == 0;
+	if (!uniform)
+	{
+		Affine linear = t;
+		linear.dx = linear.dy = 0;
+		double det = t.a * t.d - t.b * t.c;
+		Affine inverse;
+		inverse.a = t.d / det;
+		inverse.b = -t.b / det;
+		inverse.c = -t.c / det;
+		inverse.d = t.a / det;
+		m = linear * m * inverse;
+		reference["a"] = m.a;
+		reference["c"] = m.b;
+		reference["b"] = m.c;
+		reference["d"] = m.d;
+	}
+	double x = reference["x"];
+	double y = reference["y"];
+	double shiftX = t.dx - (m.a * t.dx + m.b * t.dy);
+	double shiftY = t.dy - (m.c * t.dx + m.d * t.dy);
+	double newX = t.a * x + t.b * y + shiftX;
+	double newY = t.c * x + t.d * y + shiftY;
+	if (roundToInt)
+	{
+		reference["x"] = int32_t(round(newX));
+		reference["y"] = int32_t(round(newY));
+	}
+	else
+	{
+		reference["x"] = newX;
+		reference["y"] = newY;
+	}
+}
+
+// metric scaled by k, shifted by d
+void TransformMetric(json &value, double k, double d, bool roundToInt)
+{
+	double v = k * double(value) + d;
+	if (roundToInt)
+		value = int32_t(round(v));
+	else
+		value = v;
+}
+} // namespace
+
+void TransformContours(json &contours, const Affine &t, bool roundToInt)
+{
+	PointBuffer buffer;
+	buffer.Gather(contours);
+	buffer.Transform(t, roundToInt);
+	buffer.Scatter(contours, 0, roundToInt);
+}
+
+void TransformGlyphs(const std::vector<json *> &glyphs, const Affine &t,
+                     bool roundToInt)
+{
+	PointBuffer buffer;
+	for (json *glyph : glyphs)
+	{
+		auto it = glyph->find("contours");
+		if (it != glyph->end())
+			buffer.Gather(*it);
+	}
+	buffer.Transform(t, roundToInt);
+
+	size_t i = 0;
+	for (json *glyph : glyphs)
+	{
+		json &g = *glyph;
+		auto it = g.find("contours");
+		if (it != g.end())
+			i = buffer.Scatter(*it, i, roundToInt);
+		it = g.find("references");
+		if (it != g.end())
+			for (auto &reference : *it)
+				TransformReference(reference, t, roundToInt);
+		TransformMetric(g["advanceWidth"], t.a, 0, roundToInt);
+		if (g.find("advanceHeight") != g.end())
+		{
+			TransformMetric(g["advanceHeight"], t.d, 0, roundToInt);
+			TransformMetric(g["verticalOrigin"], t.d, t.dy, roundToInt);
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+// x' = a x + b y + dx
+// y' = c x + d y + dy
+struct Affine
+{
+	double a = 1, b = 0, c = 0, d = 1;
+	double dx = 0, dy = 0;
+
+	static Affine Scale(double sx, double sy)
+	{
+		Affine t;
+		t.a = sx;
+		t.d = sy;
+		return t;
+	}
+
+	static Affine Translate(double dx, double dy)
+	{
+		Affine t;
+		t.dx = dx;
+		t.dy = dy;
+		return t;
+	}
+
+	bool IsIdentity() const
+	{
+		return a == 1 && b == 0 && c == 0 && d == 1 && dx == 0 && dy == 0;
+	}
+};
+
+// t after s
+Affine operator*(const Affine &t, const Affine &s);
+
+/* transform n points given as separate x and y arrays. rounded results are
+   nearest integers, halfway cases away from zero (same as round()).
+   SSE2 or NEON is used if available.
+*/
+void AffineApply(const Affine &t, double *x, double *y, size_t n);
+void AffineRound(const Affine &t, const double *x, const double *y, size_t n,
+                 int32_t *outX, int32_t *outY);
+
+// transform all points of the contours in one pass
+void TransformContours(nlohmann::json &contours, const Affine &t,
+                       bool roundToInt);
+
+/* transform outlines, references and metrics of glyphs in one pass. a
+   referenced glyph is expected to be transformed together with the glyph
+   referencing it.
+*/
+void TransformGlyphs(const std::vector<nlohmann::json *> &glyphs,
+                     const Affine &t, bool roundToInt = true);
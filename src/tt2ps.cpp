@@ -1,9 +1,14 @@
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <utility>
+#include <vector>
 
 #include "point.hpp"
+#include "trace.h"
+#include "transform.h"
 #include "tt2ps.h"
 
 using nlohmann::json;
@@ -12,28 +17,31 @@ static void TransformInPlace(json &glyph, double a, double b, double c,
                              double d, double dx, double dy)
 {
 	if (glyph.find("contours") != glyph.end())
-		for (auto &contour : glyph["contours"])
-			for (auto &point : contour)
-			{
-				double x = point["x"];
-				double y = point["y"];
-				point["x"] = a * x + c * y + dx;
-				point["y"] = b * x + d * y + dy;
-			}
+	{
+		// x' = a x + c y + dx, y' = b x + d y + dy
+		Affine t;
+		t.a = a;
+		t.b = c;
+		t.c = b;
+		t.d = d;
+		t.dx = dx;
+		t.dy = dy;
+		TransformContours(glyph["contours"], t, false);
+	}
 	// we have dereferenced the glyph.
 }
 
-static json Dereference(json glyph, const json &glyf)
+static void Dereference(json &glyph, const json &glyf)
 {
 	if (glyph.find("references") == glyph.end())
-		return glyph;
+		return;
 	glyph["contours"] = json::array();
 
 	for (const auto &ref : glyph["references"])
 	{
 		json target = glyf[std::string(ref["glyph"])];
 		if (target.find("references") != target.end())
-			target = Dereference(std::move(target), glyf);
+			Dereference(target, glyf);
 		TransformInPlace(target, ref["a"], ref["b"], ref["c"], ref["d"],
 		                 ref["x"], ref["y"]);
 		std::copy(target["contours"].begin(), target["contours"].end(),
@@ -41,9 +49,110 @@ static json Dereference(json glyph, const json &glyf)
 	}
 
 	glyph.erase("references");
-	return glyph;
 }
 
+/* decision kernels for CombinePair and path cleanup.
+
+   FloatKernel follows afdko in double precision. ExactKernel is used when
+   every point of the contour is an integer within ±8192: on-curve points and
+   implied mid-points are then multiples of 1/2, so the tests are done on
+   doubled coordinates in int64, comparing squared quantities instead of
+   dividing or taking square roots. products stay below 2^62.
+*/
+struct FloatKernel
+{
+	static bool Collinear(Point p1, Point p2, Point p3)
+	{
+		return DistanceToLine(p1, p2, p3) < 1;
+	}
+
+	static bool Combinable(const Point *p)
+	{
+		double a = p[3].y - p[1].y;
+		double b = p[1].x - p[3].x;
+		// Not a vertical or horizontal join...
+		if ((a == 0 && p[1].y == p[2].y) || (b == 0 && p[1].x == p[2].x))
+			return false;
+		double absq = a * a + b * b;
+		if (absq == 0)
+			return false;
+		// ...that is straight...
+		double sr = a * (p[2].x - p[1].x) + b * (p[2].y - p[1].y);
+		if (!((sr * sr) / absq < 1))
+			return false;
+		// ...and without inflexion...
+		if ((a * (p[0].x - p[1].x) + b * (p[0].y - p[1].y) < 0) !=
+		    (a * (p[4].x - p[1].x) + b * (p[4].y - p[1].y) < 0))
+			return false;
+		// ...and small segment length ratio
+		double d0 = (p[2].x - p[0].x) * (p[2].x - p[0].x) +
+		            (p[2].y - p[0].y) * (p[2].y - p[0].y);
+		double d1 = (p[4].x - p[2].x) * (p[4].x - p[2].x) +
+		            (p[4].y - p[2].y) * (p[4].y - p[2].y);
+		return d0 <= 3 * d1 && d1 <= 3 * d0;
+	}
+};
+
+struct ExactKernel
+{
+	struct Fixed
+	{
+		int64_t x;
+		int64_t y;
+	};
+
+	static bool Accepts(const json &contour)
+	{
+		auto fits = [](double v) { return v == floor(v) && fabs(v) <= 8192; };
+		return std::all_of(contour.begin(), contour.end(),
+		                   [fits](const json &point) {
+			                   return fits(point["x"]) && fits(point["y"]);
+		                   });
+	}
+
+	static Fixed Fix(Point p)
+	{
+		return {int64_t(p.x * 2), int64_t(p.y * 2)};
+	}
+
+	// distance < 1  <=>  cross² < |p3 - p1|², times 4 in doubled units
+	static bool Collinear(Point p1_, Point p2_, Point p3_)
+	{
+		Fixed p1 = Fix(p1_), p2 = Fix(p2_), p3 = Fix(p3_);
+		int64_t cross = (p3.x - p1.x) * (p2.y - p1.y) -
+		                (p3.y - p1.y) * (p2.x - p1.x);
+		int64_t absq = (p3.x - p1.x) * (p3.x - p1.x) +
+		               (p3.y - p1.y) * (p3.y - p1.y);
+		return cross * cross < 4 * absq;
+	}
+
+	static bool Combinable(const Point *pt)
+	{
+		Fixed p[5];
+		for (int i = 0; i < 5; i++)
+			p[i] = Fix(pt[i]);
+		int64_t a = p[3].y - p[1].y;
+		int64_t b = p[1].x - p[3].x;
+		if ((a == 0 && p[1].y == p[2].y) || (b == 0 && p[1].x == p[2].x))
+			return false;
+		int64_t absq = a * a + b * b;
+		if (absq == 0)
+			return false;
+		// sr² / absq < 1, times 4 in doubled units
+		int64_t sr = a * (p[2].x - p[1].x) + b * (p[2].y - p[1].y);
+		if (sr * sr >= 4 * absq)
+			return false;
+		if ((a * (p[0].x - p[1].x) + b * (p[0].y - p[1].y) < 0) !=
+		    (a * (p[4].x - p[1].x) + b * (p[4].y - p[1].y) < 0))
+			return false;
+		int64_t d0 = (p[2].x - p[0].x) * (p[2].x - p[0].x) +
+		             (p[2].y - p[0].y) * (p[2].y - p[0].y);
+		int64_t d1 = (p[4].x - p[2].x) * (p[4].x - p[2].x) +
+		             (p[4].y - p[2].y) * (p[4].y - p[2].y);
+		return d0 <= 3 * d1 && d1 <= 3 * d0;
+	}
+};
+
 namespace ConstructCffPath
 {
 void Move(json &cubicContour, Point p0)
@@ -51,19 +160,14 @@ void Move(json &cubicContour, Point p0)
 	cubicContour.push_back(p0.ToJson(true));
 }
 
-void Line(json &cubicContour, Point p1)
+template <typename Kernel> void Line(json &cubicContour, Point p1)
 {
 	size_t length = cubicContour.size();
 	if (length >= 2 && cubicContour[length - 2]["on"])
 	{
 		// 2 lines, merge if the are collinear.
-		Point p2 = cubicContour[length - 1];
-		Point p3 = cubicContour[length - 2];
-		double a = p3.y - p1.y;
-		double b = p1.x - p3.x;
-		double c = p1.y * p3.x - p1.x * p3.y;
-		double distance = abs(a * p2.x + b * p2.y + c) / sqrt(a * a + b * b);
-		if (distance < 1)
+		if (Kernel::Collinear(p1, cubicContour[length - 1],
+		                      cubicContour[length - 2]))
 			cubicContour.erase(length - 1);
 	}
 	cubicContour.push_back(p1.ToJson(true));
@@ -77,7 +181,7 @@ void Curve(json &cubicContour, Point p1, Point p2, Point p3)
 }
 
 // merge the last point and the first point
-void Finish(json &cubicContour)
+template <typename Kernel> void Finish(json &cubicContour)
 {
 	size_t length = cubicContour.size();
 	// cubicContour[0] and cubicContour[-1] are implicitly on-curve
@@ -93,11 +197,7 @@ void Finish(json &cubicContour)
 		Point p1 = cubicContour[1];
 		Point p2 = cubicContour[0];
 		Point p3 = cubicContour[length - 1];
-		double a = p3.y - p1.y;
-		double b = p1.x - p3.x;
-		double c = p1.y * p3.x - p1.x * p3.y;
-		double distance = abs(a * p2.x + b * p2.y + c) / sqrt(a * a + b * b);
-		if (distance < 1)
+		if (Kernel::Collinear(p1, p2, p3))
 			cubicContour.erase(0);
 	}
 }
@@ -115,40 +215,15 @@ static void SimpleCurve(Point *p, json &cubicContour)
    if true, combine curve and save to cubicContour, else save the first segment.
    return 1 if curves combined else 0.
 */
+template <typename Kernel>
 static int CombinePair(Point *p, json &cubicContour)
 {
-	double a = p[3].y - p[1].y;
-	double b = p[1].x - p[3].x;
-	if ((a != 0 || p[1].y != p[2].y) && (b != 0 || p[1].x != p[2].x))
+	if (Kernel::Combinable(p))
 	{
-		// Not a vertical or horizontal join...
-		double absq = a * a + b * b;
-		if (absq != 0)
-		{
-			double sr = a * (p[2].x - p[1].x) + b * (p[2].y - p[1].y);
-			if ((sr * sr) / absq < 1)
-			{
-				// ...that is straight...
-				if ((a * (p[0].x - p[1].x) + b * (p[0].y - p[1].y) < 0) ==
-				    (a * (p[4].x - p[1].x) + b * (p[4].y - p[1].y) < 0))
-				{
-					// ...and without inflexion...
-					double d0 = (p[2].x - p[0].x) * (p[2].x - p[0].x) +
-					            (p[2].y - p[0].y) * (p[2].y - p[0].y);
-					double d1 = (p[4].x - p[2].x) * (p[4].x - p[2].x) +
-					            (p[4].y - p[2].y) * (p[4].y - p[2].y);
-					if (d0 <= 3 * d1 && d1 <= 3 * d0)
-					{
-						// ...and small segment length ratio; combine curve
-						ConstructCffPath::Curve(cubicContour,
-						                        (4 * p[1] - p[0]) / 3,
-						                        (4 * p[3] - p[4]) / 3, p[4]);
-						p[0] = p[4];
-						return 1;
-					}
-				}
-			}
-		}
+		ConstructCffPath::Curve(cubicContour, (4 * p[1] - p[0]) / 3,
+		                        (4 * p[3] - p[4]) / 3, p[4]);
+		p[0] = p[4];
+		return 1;
 	}
 
 	// save first curve then replace it by second curve
@@ -160,6 +235,48 @@ static int CombinePair(Point *p, json &cubicContour)
 	return 0;
 }
 
+static bool IsLineContour(const json &contour)
+{
+	return std::all_of(contour.begin(), contour.end(),
+	                   [](const json &point) { return bool(point["on"]); });
+}
+
+/* contour without off-curve points. only duplicate and collinear points are
+   removed, exactly as ConstructCffPath::Line and Finish would do.
+*/
+template <typename Kernel>
+static json ConvertLineContour(const json &contour)
+{
+	std::vector<Point> path;
+	path.reserve(contour.size());
+	auto line = [&path](Point p1) {
+		size_t length = path.size();
+		if (length >= 2 &&
+		    Kernel::Collinear(p1, path[length - 1], path[length - 2]))
+			path.pop_back();
+		path.push_back(p1);
+	};
+
+	// in reversed direction
+	path.push_back(contour[0]);
+	for (size_t i = contour.size() - 1; i > 0; i--)
+		line(contour[i]);
+
+	size_t length = path.size();
+	if (abs(path[0] - path[length - 1]) < 1)
+	{
+		path.pop_back();
+		length--;
+	}
+	if (length >= 3 && Kernel::Collinear(path[1], path[0], path[length - 1]))
+		path.erase(path.begin());
+
+	json cubicContour = json::array();
+	for (Point p : path)
+		cubicContour.push_back(p.ToJson(true));
+	return cubicContour;
+}
+
 /* reimplemented afdko’s ttread::callbackApproxPath
 
    state    sequence        points
@@ -170,164 +287,259 @@ static int CombinePair(Point *p, json &cubicContour)
    3        1 0 1           0-2
    4        1 0 1 0         0-3
 */
-static json ConvertApprox(json glyph, const json &glyf)
+static void StripInstructions(json &glyph)
 {
-	glyph = Dereference(std::move(glyph), glyf);
 	glyph.erase("instructions");
 	glyph.erase("LTSH_yPel");
+}
 
-	for (json &contour : glyph["contours"])
+template <typename Kernel>
+static json ConvertContour(const json &contour, OutlineStats &stats)
+{
+	if (IsLineContour(contour))
 	{
-		if (contour.size() <= 1)
-			continue;
+		stats.lineContours++;
+		return ConvertLineContour<Kernel>(contour);
+	}
 
-		json cubicContour = json::array();
-		Point p[6];             // points: 0,2,4-on, 1,3-off, 5-tmp
-		json::const_iterator q; // current point
-		auto beg = contour.cbegin();
-		auto end = --contour.cend();
-		size_t cnt = contour.size();
-		int state = 0;
+	size_t combined = 0;
+	json cubicContour = json::array();
+	Point p[6];             // points: 0,2,4-on, 1,3-off, 5-tmp
+	json::const_iterator q; // current point
+	auto beg = contour.cbegin();
+	auto end = --contour.cend();
+	size_t cnt = contour.size();
+	int state = 0;
 
-		// save initial on-curve point
-		if ((*beg)["on"])
-		{
-			q = beg;
-			p[0] = *q;
-		}
-		else if ((*end)["on"])
-		{
-			q = end;
-			p[0] = *q;
-		}
-		else
-		{
-			// start at mid-point
-			q = beg;
-			cnt++;
-			p[0] = (Point(*beg) + *end) / 2;
-		}
-		ConstructCffPath::Move(cubicContour, p[0]);
+	// save initial on-curve point
+	if ((*beg)["on"])
+	{
+		q = beg;
+		p[0] = *q;
+	}
+	else if ((*end)["on"])
+	{
+		q = end;
+		p[0] = *q;
+	}
+	else
+	{
+		// start at mid-point
+		q = beg;
+		cnt++;
+		p[0] = (Point(*beg) + *end) / 2;
+	}
+	ConstructCffPath::Move(cubicContour, p[0]);
 
-		while (cnt--)
-		{
-			// advance to next point, in reversed direction
-			q = (q == beg) ? end : q - 1;
+	while (cnt--)
+	{
+		// advance to next point, in reversed direction
+		q = (q == beg) ? end : q - 1;
 
-			if ((*q)["on"])
+		if ((*q)["on"])
+		{
+			// on-curve
+			switch (state)
 			{
-				// on-curve
-				switch (state)
+			case 0:
+				if (cnt > 0)
 				{
-				case 0:
-					if (cnt > 0)
-					{
-						p[0] = *q;
-						ConstructCffPath::Line(cubicContour, p[0]);
-						// stay in state 0
-					}
-					break;
-				case 1:
-					p[2] = *q;
+					p[0] = *q;
+					ConstructCffPath::Line<Kernel>(cubicContour, p[0]);
+					// stay in state 0
+				}
+				break;
+			case 1:
+				p[2] = *q;
+				state = 3;
+				break;
+			case 2:
+				p[4] = *q;
+				if (CombinePair<Kernel>(p, cubicContour))
+				{
+					combined++;
+					state = 0;
+				}
+				else
 					state = 3;
-					break;
-				case 2:
-					p[4] = *q;
-					state = CombinePair(p, cubicContour) ? 0 : 3;
-					break;
-				case 3:
-					SimpleCurve(p, cubicContour);
-					if (cnt > 0)
-					{
-						p[0] = *q;
-						ConstructCffPath::Line(cubicContour, p[0]);
-					}
+				break;
+			case 3:
+				SimpleCurve(p, cubicContour);
+				if (cnt > 0)
+				{
+					p[0] = *q;
+					ConstructCffPath::Line<Kernel>(cubicContour, p[0]);
+				}
+				state = 0;
+				break;
+			case 4:
+				p[4] = *q;
+				if (CombinePair<Kernel>(p, cubicContour))
+				{
+					combined++;
 					state = 0;
-					break;
-				case 4:
-					p[4] = *q;
-					state = CombinePair(p, cubicContour) ? 0 : 3;
-					break;
 				}
+				else
+					state = 3;
+				break;
 			}
-			else
+		}
+		else
+		{
+			// off-curve
+			switch (state)
 			{
-				// off-curve
-				switch (state)
+			case 0:
+				p[1] = *q;
+				state = 1;
+				break;
+			case 1:
+				p[3] = *q;
+				p[2] = (p[1] + p[3]) / 2;
+				state = 2;
+				break;
+			case 2:
+				p[5] = *q;
+				p[4] = (p[3] + p[5]) / 2;
+				if (CombinePair<Kernel>(p, cubicContour))
 				{
-				case 0:
-					p[1] = *q;
+					combined++;
+					p[1] = p[5];
 					state = 1;
-					break;
-				case 1:
-					p[3] = *q;
-					p[2] = (p[1] + p[3]) / 2;
-					state = 2;
-					break;
-				case 2:
-					p[5] = *q;
-					p[4] = (p[3] + p[5]) / 2;
-					if (CombinePair(p, cubicContour))
-					{
-						p[1] = p[5];
-						state = 1;
-					}
-					else
-					{
-						p[3] = p[5];
-						state = 4;
-					}
-					break;
-				case 3:
-					p[3] = *q;
+				}
+				else
+				{
+					p[3] = p[5];
 					state = 4;
-					break;
-				case 4:
-					p[5] = *q;
-					p[4] = (p[3] + p[5]) / 2;
-					if (CombinePair(p, cubicContour))
-					{
-						p[1] = p[5];
-						state = 1;
-					}
-					else
-					{
-						p[3] = p[5];
-						state = 2;
-					}
-					break;
 				}
+				break;
+			case 3:
+				p[3] = *q;
+				state = 4;
+				break;
+			case 4:
+				p[5] = *q;
+				p[4] = (p[3] + p[5]) / 2;
+				if (CombinePair<Kernel>(p, cubicContour))
+				{
+					combined++;
+					p[1] = p[5];
+					state = 1;
+				}
+				else
+				{
+					p[3] = p[5];
+					state = 2;
+				}
+				break;
 			}
 		}
+	}
 
-		// finish up
-		switch (state)
-		{
-		case 2:
-			p[3] = *q;
-			p[2] = (p[1] + p[3]) / 2;
-			[[fallthrough]];
-		case 3:
-		case 4:
-			SimpleCurve(p, cubicContour);
-			break;
-		}
+	// finish up
+	switch (state)
+	{
+	case 2:
+		p[3] = *q;
+		p[2] = (p[1] + p[3]) / 2;
+		[[fallthrough]];
+	case 3:
+	case 4:
+		SimpleCurve(p, cubicContour);
+		break;
+	}
+
+	ConstructCffPath::Finish<Kernel>(cubicContour);
+
+	// every curve not combined is an exact degree elevation
+	size_t offCurve = std::count_if(
+	    cubicContour.begin(), cubicContour.end(),
+	    [](const json &point) { return !point["on"]; });
+	if (combined)
+		stats.approxContours++;
+	else
+		stats.exactContours++;
+	stats.exactSegments += offCurve / 2 - combined;
+	stats.approxSegments += combined;
+	return cubicContour;
+}
+
+static void ConvertApprox(json &glyph, OutlineStats &stats)
+{
+	StripInstructions(glyph);
+
+	for (json &contour : glyph["contours"])
+	{
+		if (contour.size() <= 1)
+			continue;
 
-		ConstructCffPath::Finish(cubicContour);
-		contour = cubicContour;
+		json cubicContour;
+		if (ExactKernel::Accepts(contour))
+			cubicContour = ConvertContour<ExactKernel>(contour, stats);
+		else
+			cubicContour = ConvertContour<FloatKernel>(contour, stats);
+		// drop the quadratic contour right away
+		contour = std::move(cubicContour);
 	}
+}
 
-	return glyph;
+bool Tt2PsKernelsAgree(const json &contour, json &exact, json &reference)
+{
+	if (contour.size() <= 1 || !ExactKernel::Accepts(contour))
+		return true;
+	OutlineStats unused;
+	exact = ConvertContour<ExactKernel>(contour, unused);
+	reference = ConvertContour<FloatKernel>(contour, unused);
+	return exact == reference;
 }
 
-json Tt2Ps(const json &glyf, bool roundToInt)
+// convert in place, contour by contour
+json Tt2Ps(json &&glyf, bool roundToInt, OutlineStats *stats,
+           OutlineCache *cache)
 {
-	json glyfCubic;
-	for (const auto &[name, glyph] : glyf.items())
+	OutlineStats local;
+
+	// components must be read as quadratic outlines, so flatten every
+	// composite glyph before any contour is converted.
+	for (auto &[name, glyph] : glyf.items())
+		Dereference(glyph, glyf);
+
+	TraceChunks chunks("tt2ps", "convert", 1024);
+	for (auto &[name, glyph] : glyf.items())
 	{
-		glyfCubic[name] = ConvertApprox(glyph, glyf);
+		chunks.Next();
+		auto it = glyph.find("contours");
+		if (cache && it != glyph.end() && it->is_array() && !it->empty())
+		{
+			json &contours = *it;
+			uint64_t key = OutlineCache::Key(contours, OutlineCache::ToCubic,
+			                                 0, roundToInt);
+			if (cache->Lookup(key, contours))
+			{
+				StripInstructions(glyph);
+				continue;
+			}
+			auto start = std::chrono::steady_clock::now();
+			ConvertApprox(glyph, local);
+			if (roundToInt)
+				RoundInPlace(glyph);
+			cache->Store(key, contours, roundToInt,
+			             std::chrono::duration<double>(
+			                 std::chrono::steady_clock::now() - start)
+			                 .count());
+			continue;
+		}
+		ConvertApprox(glyph, local);
 		if (roundToInt)
-			RoundInPlace(glyfCubic[name]);
+			RoundInPlace(glyph);
 	}
-	return glyfCubic;
+	if (stats)
+		*stats += local;
+	return std::move(glyf);
+}
+
+json Tt2Ps(const json &glyf, bool roundToInt, OutlineStats *stats,
+           OutlineCache *cache)
+{
+	return Tt2Ps(json(glyf), roundToInt, stats, cache);
 }
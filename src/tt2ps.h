@@ -2,4 +2,17 @@
 
 #include <nlohmann/json.hpp>
 
-nlohmann::json Tt2Ps(const nlohmann::json &glyf, bool roundToInt = true);
+#include "outline-cache.h"
+#include "outline-stats.h"
+
+nlohmann::json Tt2Ps(const nlohmann::json &glyf, bool roundToInt = true,
+                     OutlineStats *stats = nullptr,
+                     OutlineCache *cache = nullptr);
+nlohmann::json Tt2Ps(nlohmann::json &&glyf, bool roundToInt = true,
+                     OutlineStats *stats = nullptr,
+                     OutlineCache *cache = nullptr);
+
+// differential check of the integer kernel against the double precision one;
+// contours the integer kernel does not take agree trivially
+bool Tt2PsKernelsAgree(const nlohmann::json &contour, nlohmann::json &exact,
+                       nlohmann::json &reference);
@@ -0,0 +1,223 @@
+﻿#ifdef _MSC_VER
+#pragma comment(lib, "shell32")
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nowide/args.hpp>
+#include <nowide/convert.hpp>
+#include <nowide/iostream.hpp>
+
+#include "merge.h"
+#include "trace.h"
+
+#ifdef _WIN32
+#define pclose _pclose
+#endif
+
+const char *usage = reinterpret_cast<const char *>(
+    u8"用法：\n"
+    u8"\t%s comp <字体> [选项]                 用 latin.ttf、cjk.ttf 补全字体\n"
+    u8"\t%s merge <英文字体> <中文字体> [选项]\n"
+    u8"\t%s merge+comp <英文字体> <中文字体> [选项]  合并后用 latin.ttf、cjk.ttf 补全\n"
+    u8"latin.ttf、cjk.ttf、otfccdump、otfccbuild 与本程序在同一目录，"
+    u8"默认输出到同一目录下的 out.ttf。\n"
+    u8"选项与 merge-otd 相同，其中 --output=<文件> 为输出的字体文件。\n");
+const char *dumpfail = reinterpret_cast<const char *>(u8"读取字体 %s 失败\n");
+const char *buildfail = reinterpret_cast<const char *>(u8"生成字体 %s 失败\n");
+const char *stagestats = reinterpret_cast<const char *>(
+    u8"读取字体 %.2f 秒，合并 %.2f 秒，生成字体 %.2f 秒\n");
+const char *tracefail = reinterpret_cast<const char *>(u8"写入跟踪文件 %s 失败\n");
+
+// quoted for the shell
+std::string Quote(const std::string &arg) {
+#ifdef _WIN32
+	return '"' + arg + '"';
+#else
+	std::string result = "'";
+	for (char c : arg)
+		if (c == '\'')
+			result += "'\\''";
+		else
+			result += c;
+	return result + "'";
+#endif
+}
+
+FILE *OpenPipe(const std::vector<std::string> &args, bool write) {
+	std::string command;
+	for (auto &arg : args)
+		command += (command.empty() ? "" : " ") + Quote(arg);
+#ifdef _WIN32
+	// cmd /c strips the outermost quotes
+	command = '"' + command + '"';
+	return _wpopen(nowide::widen(command).c_str(), write ? L"wb" : L"rb");
+#else
+	return popen(command.c_str(), write ? "w" : "r");
+#endif
+}
+
+// standard output of command, false if it fails
+bool ReadFrom(const std::vector<std::string> &args, std::string &output) {
+	FILE *pipe = OpenPipe(args, false);
+	if (!pipe)
+		return false;
+	char buffer[65536];
+	size_t n;
+	while ((n = fread(buffer, 1, sizeof buffer, pipe)) > 0)
+		output.append(buffer, n);
+	return pclose(pipe) == 0;
+}
+
+// feed input to standard input of command, false if it fails
+bool WriteTo(const std::vector<std::string> &args, const std::string &input) {
+	FILE *pipe = OpenPipe(args, true);
+	if (!pipe)
+		return false;
+	bool written = fwrite(input.data(), 1, input.size(), pipe) == input.size();
+	return pclose(pipe) == 0 && written;
+}
+
+// directory of this program, with trailing separator, or empty
+std::string SelfDirectory(const std::string &self) {
+	size_t slash = self.find_last_of("/\\");
+	return slash == std::string::npos ? "" : self.substr(0, slash + 1);
+}
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+	                                     start)
+	    .count();
+}
+
+int Run(const std::string &mode, Options &options, const char *u8argv0) {
+	static char u8buffer[4096];
+
+	std::string directory = SelfDirectory(u8argv0);
+#ifdef _WIN32
+	std::string otfccdump = directory + "otfccdump.exe";
+	std::string otfccbuild = directory + "otfccbuild.exe";
+#else
+	std::string otfccdump = directory + "otfccdump";
+	std::string otfccbuild = directory + "otfccbuild";
+#endif
+	// same order as the comp, merge and merge+comp scripts
+	std::string base = options.files[0];
+	std::string latin = directory + "latin.ttf", cjk = directory + "cjk.ttf";
+	Affine identity;
+	if (mode == "comp")
+		options.files = {base, latin, cjk};
+	else if (mode == "merge+comp")
+		options.files = {base, latin, options.files[1], cjk};
+	for (size_t i = options.adjusts.size(); i < options.files.size(); i++)
+		options.adjusts.push_back(identity);
+	if (mode == "merge+comp")
+		std::swap(options.adjusts[1], options.adjusts[2]);
+	std::string output =
+	    options.output.empty() ? directory + "out.ttf" : options.output;
+
+	// dump every font in parallel, straight into memory
+	auto start = std::chrono::steady_clock::now();
+	std::map<std::string, std::string> dumps;
+	for (auto &file : options.files)
+		dumps[file];
+	std::vector<std::thread> threads;
+	std::map<std::string, bool> dumped;
+	for (auto &[file, text] : dumps) {
+		bool &ok = dumped[file];
+		threads.emplace_back([&, file = file] {
+			auto start = TraceClock::now();
+			ok = ReadFrom({otfccdump, "--ignore-hints", "--no-bom", file}, text);
+			TraceSpan("otfccdump", "wfm", start, TraceClock::now(),
+			          {{"file", file}});
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	for (auto &[file, ok] : dumped)
+		if (!ok) {
+			snprintf(u8buffer, sizeof u8buffer, dumpfail, file.c_str());
+			nowide::cerr << u8buffer;
+			return EXIT_FAILURE;
+		}
+	double dumpSeconds = Seconds(start);
+
+	start = std::chrono::steady_clock::now();
+	std::string merged;
+	std::map<std::string, size_t> uses;
+	for (auto &file : options.files)
+		uses[file]++;
+	options.load = [&dumps, &uses](const std::string &file) {
+		// the last use takes the text
+		return --uses[file] ? dumps[file] : std::move(dumps[file]);
+	};
+	options.save = [&merged](const std::string &, std::string &&json) {
+		merged = std::move(json);
+		return true;
+	};
+	std::unique_ptr<OutlineCache> cache;
+	if (!options.cachePath.empty())
+		cache = std::make_unique<OutlineCache>(options.cachePath);
+	int result = Merge(options, cache.get(), nullptr);
+	if (cache && result == 0)
+		SaveCache(*cache, options.cachePath, options.verbose);
+	if (result != 0)
+		return result;
+	double mergeSeconds = Seconds(start);
+
+	// keep the glyph order of merge-otd, which -O3 would drop
+	start = std::chrono::steady_clock::now();
+	bool built = WriteTo({otfccbuild, "-q", "-O3", "-k", "-o", output}, merged);
+	TraceSpan("otfccbuild", "wfm", start, TraceClock::now(),
+	          {{"output", output}});
+	if (!built) {
+		snprintf(u8buffer, sizeof u8buffer, buildfail, output.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	double buildSeconds = Seconds(start);
+
+	snprintf(u8buffer, sizeof u8buffer, stagestats, dumpSeconds, mergeSeconds,
+	         buildSeconds);
+	nowide::cerr << u8buffer;
+	return 0;
+}
+
+int main(int argc, char *u8argv[]) {
+	static char u8buffer[4096];
+	nowide::args _{argc, u8argv};
+
+	std::string mode = argc > 1 ? u8argv[1] : "";
+	std::vector<std::string> args(u8argv + std::min(argc, 2), u8argv + argc);
+	Options options;
+	// one merge, run here
+	bool good = ParseOptions(args, options) && options.batchPath.empty() &&
+	            options.variants.empty() && !options.plan &&
+	            options.servePath.empty() && options.connectPath.empty();
+	size_t fonts = mode == "comp" ? 1 : 2;
+	if (!good || (mode != "comp" && mode != "merge" && mode != "merge+comp") ||
+	    options.files.size() != fonts) {
+		snprintf(u8buffer, sizeof u8buffer, usage, u8argv[0], u8argv[0],
+		         u8argv[0]);
+		nowide::cout << u8buffer << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (!options.tracePath.empty())
+		StartTrace();
+	int result = Run(mode, options, u8argv[0]);
+	if (!options.tracePath.empty() && !WriteTrace(options.tracePath)) {
+		snprintf(u8buffer, sizeof u8buffer, tracefail,
+		         options.tracePath.c_str());
+		nowide::cerr << u8buffer;
+		return EXIT_FAILURE;
+	}
+	return result;
+}